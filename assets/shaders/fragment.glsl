@@ -1,6 +1,14 @@
-#version 330 core
+#version 430 core
 out vec4 FragColor;
-uniform float uTime;
+
+// Shared per-frame data - layout must match engine::FrameUniforms
+layout (std140) uniform FrameData {
+    mat4 uView;
+    mat4 uProj;
+    mat4 uViewProj;
+    vec4 uCameraPos;
+    float uTime;
+};
 
 void main()
 {
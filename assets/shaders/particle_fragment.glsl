@@ -0,0 +1,13 @@
+#version 430 core
+in vec2 vCorner;
+in float vLife;
+out vec4 FragColor;
+
+void main()
+{
+    // Round, soft-edged dot; drawn additively, so alpha only scales the glow
+    float falloff = 1.0 - dot(vCorner, vCorner);
+    if (falloff <= 0.0) discard;
+    vec3 color = mix(vec3(1.0, 0.25, 0.05), vec3(1.0, 0.9, 0.5), vLife);
+    FragColor = vec4(color, falloff * vLife);
+}
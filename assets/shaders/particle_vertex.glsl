@@ -0,0 +1,28 @@
+#version 430 core
+// Per-instance particle from the particle renderer's mapped buffer (divisor 1):
+// xyz = world position, w = remaining fraction of its lifetime
+layout (location = 0) in vec4 aParticle;
+
+// Shared per-frame data - layout must match engine::FrameUniforms
+layout (std140) uniform FrameData {
+    mat4 uView;
+    mat4 uProj;
+    mat4 uViewProj;
+    vec4 uCameraPos;
+    float uTime;
+};
+
+out vec2 vCorner;
+out float vLife;
+void main() {
+    // Triangle strip corners from the vertex id: (-1,-1) (1,-1) (-1,1) (1,1)
+    vCorner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) * 2.0 - 1.0;
+    vLife = aParticle.w;
+
+    // Camera right and up are the first two rows of the view matrix
+    vec3 right = vec3(uView[0][0], uView[1][0], uView[2][0]);
+    vec3 up = vec3(uView[0][1], uView[1][1], uView[2][1]);
+    float size = 0.02 + 0.04 * aParticle.w;
+    vec3 position = aParticle.xyz + (right * vCorner.x + up * vCorner.y) * size;
+    gl_Position = uViewProj * vec4(position, 1.0);
+}
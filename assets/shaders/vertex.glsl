@@ -1,9 +1,21 @@
-#version 330 core
+#version 430 core
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aColor;
+// Per-instance MVP from the batch renderer's instance buffer (divisor 1,
+// offset by each indirect command's baseInstance)
+layout (location = 2) in mat4 aMVP;
+
+// Shared per-frame data - layout must match engine::FrameUniforms
+layout (std140) uniform FrameData {
+    mat4 uView;
+    mat4 uProj;
+    mat4 uViewProj;
+    vec4 uCameraPos;
+    float uTime;
+};
+
 out vec3 vColor;
-uniform mat4 uMVP;
 void main() {
-    gl_Position = uMVP * vec4(aPos, 1.0);
+    gl_Position = aMVP * vec4(aPos, 1.0);
     vColor = aColor;
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+// include/engine/core/AssetArchive.h
+#pragma once
+#include "engine/core/Platform.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine {
+
+    // Read side of the packed asset format written by packAssetArchive().
+    // The whole file is mapped once; the table of contents is an open-addressed
+    // hash table stored in the file itself, so find() is a hash plus a probe
+    // or two with no allocation, syscall or copy. Stored entries are views
+    // straight into the mapping. LZ4 entries are decompressed the first time
+    // they are looked up and kept for the archive's lifetime.
+    class AssetArchive {
+    public:
+        AssetArchive() = default;
+        ~AssetArchive() = default;
+
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+
+        bool open(const std::string& path);
+        void close();
+        bool isOpen() const { return m_file.isOpen(); }
+
+        // name is relative to the packed directory with '/' separators
+        // ("shaders/vertex.glsl"). The view lives as long as the archive.
+        bool find(std::string_view name, std::string_view& out);
+
+        std::uint32_t entryCount() const { return m_entryCount; }
+
+    private:
+        bool decompress(std::uint32_t slot, std::string_view& out);
+
+        MappedFile m_file;
+        const void* m_slots = nullptr;   // points into the mapping
+        const char* m_names = nullptr;
+        std::uint32_t m_slotMask = 0;
+        std::uint32_t m_entryCount = 0;
+
+        // Decompressed LZ4 entries, indexed by slot; filled lazily under the lock
+        std::mutex m_decodeLock;
+        std::vector<std::unique_ptr<char[]>> m_decoded;
+    };
+
+    struct AssetArchiveInput {
+        std::string name;   // lookup name, '/' separated
+        std::vector<char> data;
+    };
+
+    // Writes inputs to outputPath. With compress set, each entry is LZ4
+    // compressed when that saves at least an eighth of its size (and the
+    // build has LZ4); everything else is stored raw.
+    bool packAssetArchive(const std::string& outputPath, const std::vector<AssetArchiveInput>& inputs, bool compress);
+
+} // namespace engine
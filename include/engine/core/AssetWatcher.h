@@ -0,0 +1,56 @@
+// include/engine/core/AssetWatcher.h
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+    // Watches files from a background thread and queues the ones that change.
+    // Linux uses inotify on each file's directory (so editors that save via
+    // rename are caught); elsewhere the thread polls modification times. The
+    // frame only pays for a mutex-guarded swap in poll().
+    class AssetWatcher {
+    public:
+        AssetWatcher() = default;
+        ~AssetWatcher();
+
+        AssetWatcher(const AssetWatcher&) = delete;
+        AssetWatcher& operator=(const AssetWatcher&) = delete;
+
+        // Register before start(); poll() reports the path exactly as given here
+        void watch(const std::string& path);
+        bool start();
+        void stop();
+
+        // Moves every path changed since the last call into out (deduplicated)
+        void poll(std::vector<std::string>& out);
+
+    private:
+        void threadMain();
+        void notify(const std::string& path);
+
+        struct WatchedFile {
+            std::string path;        // as registered
+            std::string directory;   // absolute
+            std::string name;        // file name inside directory
+        };
+
+        std::vector<WatchedFile> m_files;
+        std::thread m_thread;
+        std::atomic<bool> m_quit{ false };
+
+        std::mutex m_lock;
+        std::vector<std::string> m_changed;
+
+#if defined(__linux__)
+        int m_inotify = -1;
+        int m_wakeFd = -1;   // eventfd that interrupts poll() on stop
+        std::unordered_map<int, std::string> m_watchDirs;   // inotify wd -> directory
+#endif
+    };
+
+} // namespace engine
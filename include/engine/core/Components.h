@@ -0,0 +1,57 @@
+// include/engine/core/Components.h
+#pragma once
+#include <cstdint>
+#include "engine/math/Math.h"
+
+// Plain-data components the engine's own systems operate on
+namespace engine {
+
+    struct Position {
+        math::Vec3 value;
+    };
+
+    struct Rotation {
+        math::Quat value;
+    };
+
+    struct Scale {
+        math::Vec3 value{ 1.0f, 1.0f, 1.0f };
+    };
+
+    // Position and Rotation as they were before the latest tick. Render
+    // blends from these to the live values by the leftover fraction of a
+    // tick, so motion stays smooth when frames and ticks don't line up.
+    struct PreviousTransform {
+        math::Vec3 position;
+        math::Quat rotation;
+    };
+
+    // Camera orientation in degrees. forward/right are cached from yaw and
+    // pitch by PlayerController::applyLook, so a still camera costs no trig.
+    struct CameraLook {
+        float yaw = 0.0f;
+        float pitch = 0.0f;
+        math::Vec3 forward{ 0.0f, 0.0f, -1.0f };
+        math::Vec3 right{ 1.0f, 0.0f, 0.0f };   // horizontal
+    };
+
+    // Tag: driven by PlayerController
+    struct PlayerControlled {};
+
+    struct Spin {
+        math::Vec3 axis{ 0.0f, 0.0f, 1.0f };
+        float degreesPerSecond = 90.0f;
+        float angle = 0.0f;   // degrees
+    };
+
+    // Node in the engine's TransformHierarchy. Position/Rotation/Scale are
+    // then local to the node's parent (world space for a root).
+    struct SceneNode {
+        std::uint32_t node = 0xFFFFFFFFu;
+    };
+
+    struct Renderable {
+        std::uint32_t mesh = 0;
+    };
+
+} // namespace engine
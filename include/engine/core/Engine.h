@@ -4,16 +4,41 @@
 #include <SDL.h>
 #include <glad/glad.h>
 #include "engine/render/Shader.h"
+#include "engine/render/BatchRenderer.h"
+#include "engine/render/GpuTimer.h"
+#include "engine/render/Bvh.h"
+#include "engine/render/MeshStreamer.h"
+#include "engine/render/ParticleRenderer.h"
+#include "engine/render/RenderQueue.h"
+#include "engine/render/ShaderCache.h"
+#include "engine/render/UniformBuffer.h"
+#include "engine/render/TransformHierarchy.h"
+#include "engine/render/TransformPipeline.h"
+#include "engine/core/AssetArchive.h"
+#include "engine/core/AssetWatcher.h"
+#include "engine/core/Components.h"
+#include "engine/core/EngineConfig.h"
+#include "engine/core/FramePacer.h"
+#include "engine/core/Input.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Memory.h"
+#include "engine/core/Profiler.h"
+#include "engine/core/Replay.h"
+#include "engine/core/TripleBuffer.h"
+#include "engine/core/PlayerController.h"
+#include "engine/ecs/World.h"
+#include "engine/particles/ParticleSystem.h"
+#include "engine/physics/Broadphase.h"
 #include "engine/math/Math.h"
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
 
 typedef struct SDL_Window SDL_Window;
 typedef void* SDL_GLContext;
 
-// Forward declaration  keeps compile times fast and clean
-namespace engine {
-    class PlayerController;
-}
-
 namespace engine {
 
     class Engine {
@@ -21,14 +46,37 @@ namespace engine {
         Engine();
         ~Engine();
 
-        bool initialize();
+        bool initialize(const EngineConfig& config = EngineConfig());
         void run();
         void shutdown();
 
+        // Per-pass GPU times, for budgets; readable from any thread
+        const GpuTimer& gpuTimer() const { return m_gpuTimer; }
+
     private:
+        bool initializeGL();
+        // From assets.pak when open, else from assets/shaders/ on disk
+        bool loadShader(Shader& shader, const char* vertexName, const char* fragmentName);
+        // Entity + hierarchy node, spinning in place at position (local to parent)
+        ecs::Entity spawnRenderable(const math::Vec3& position, const Spin& spin, std::uint32_t mesh,
+                                    TransformHierarchy::Node parent = TransformHierarchy::kNoNode);
         void pollEvents();
-        void update(float dt);
-        void render();
+        InputState nextInput(std::uint64_t tickEnd);
+        void update(float dt, std::uint64_t tickEnd);   // tickEnd: profiler time the tick stands for
+        struct RenderFrame;
+
+        void prepareFrame(RenderFrame& frame);   // camera, culling, transforms, draw packets; no GL
+        void render(RenderFrame& frame);         // GL thread
+        void processAssetChanges();              // GL thread
+        void pumpStreaming();                    // GL thread
+        void renderLoop();
+        void runTicks();
+        void reportFrameTime(double frameTime);
+        void endFrame(std::uint64_t heapAtStart);
+
+        // Constructed first so the constructing (main) thread owns worker slot 0
+        JobSystem m_jobs;
+        EngineConfig m_config;
 
         // === WINDOW & CONTEXT ===
         SDL_Window* m_window = nullptr;
@@ -39,26 +87,140 @@ namespace engine {
         int m_width = 800;
         int m_height = 600;
 
+        // === MEMORY ===
+        // Per-frame scratch: anything allocated from current() is gone two
+        // endFrame() calls later. A frame that still reaches operator new
+        // after warm-up trips an assert in debug builds.
+        static constexpr std::size_t kFrameArenaBytes = 4 * 1024 * 1024;
+        static constexpr std::uint64_t kHeapWarmupFrames = 10;
+        memory::FrameAllocator m_frameMemory{ kFrameArenaBytes };
+        std::uint64_t m_framesRun = 0;
+        std::uint64_t m_frameHeapAllocations = 0;   // last frame, outside AllowHeap scopes
+
         // === RENDERING ===
+        ShaderCache m_shaderCache;
         Shader m_shader;
-        unsigned int m_vao = 0;
-        unsigned int m_vbo = 0;
+        BatchRenderer m_batch;
+        MeshStreamer m_meshStreamer;
+        std::vector<std::uint32_t> m_sceneMeshes;   // triangle + --mesh requests, in that order
+        UniformBuffer m_frameBlock;
+        GpuTimer m_gpuTimer;   // queries issued and read back on the GL thread
+        std::vector<std::uint32_t> m_drawMeshes;   // mesh id per draw slot
+        std::vector<std::uint32_t> m_drawNodes;    // hierarchy index per draw slot
+        Shader m_particleShader;
+        ParticleRenderer m_particleRenderer;       // only with --particles and a GL context
+
+        // === RENDER THREAD ===
+        // Everything render() reads, built whole by prepareFrame(). In run()
+        // the main thread fills frame N + 1 while the render thread, which
+        // owns the GL context, draws frame N; fixed-tick runs use back()
+        // for both on the main thread.
+        struct RenderFrame {
+            FrameUniforms uniforms;
+            TransformPipeline transforms;
+            RenderQueue queue;
+            int particleSection = -1;                   // m_particleRenderer section to draw, -1 = none
+            std::vector<std::uint32_t> particleCounts;  // live particles per chunk of that section
+        };
+        TripleBuffer<RenderFrame> m_frames;
+        std::thread m_renderThread;
+
+        // Radii of meshes the streamer finished, handed from the GL thread to culling
+        std::mutex m_loadedMeshLock;
+        std::vector<std::pair<std::uint32_t, float>> m_loadedMeshRadius;   // guarded by m_loadedMeshLock
+        std::atomic<bool> m_loadedMeshPending{ false };
 
-        // === CAMERA & PLAYER ===
-        float m_cameraPos[3] = { 0.0f, 0.0f, 5.0f };
-        float m_cameraYaw = 0.0f;
-        float m_cameraPitch = 0.0f;
-        bool m_mouseCaptured = false;
+        // === CULLING ===
+        Bvh m_bvh;
+        std::vector<math::Aabb> m_bounds;            // world box per draw slot
+        std::vector<float> m_meshRadius;             // object-space bounding radius by mesh id
+        std::uint32_t m_boundedMeshes = 0;           // streamer loads already handed to culling (GL thread)
+        std::vector<std::uint32_t> m_visible;        // slots that passed the frustum this frame
+        std::vector<std::uint32_t> m_visibleMeshes;  // mesh id per visible slot, matching the packed MVPs
+        std::vector<std::uint32_t> m_visibleNodes;   // hierarchy index per visible slot, likewise
 
-        PlayerController* m_playerController = nullptr;
+        // === ASSETS ===
+        AssetArchive m_assets;   // open = packed build; otherwise loose files under assets/
 
-        // === TRIANGLE ANIMATION ===
-        float m_rotation = 0.0f;
+        // === HOT RELOAD ===
+        AssetWatcher m_assetWatcher;
+        std::vector<std::string> m_changedAssets;
+
+        // === SIMULATION ===
+        ecs::World m_world;
+        ecs::Entity m_camera;
+        ecs::Entity m_triangle;
+        PlayerController m_playerController;
+        TransformHierarchy m_scene;   // world matrices of every SceneNode entity
+
+        // === PARTICLES ===
+        // Visual only: stepped once per prepared frame by the time that frame
+        // covers, not by the fixed tick, and never read by the simulation
+        ParticleSystem m_particles;
+        float m_frameDt = 0.0f;
+
+        // === PHYSICS ===
+        // Broadphase over the renderables' world boxes (--broadphase). There
+        // is no narrowphase yet; the pairs only feed the benchmark report.
+        SweepAndPrune m_sweepAndPrune;
+        SpatialHashGrid m_spatialHash;
+
+        // === INPUT ===
+        InputQueue m_input;   // SDL events, timestamped, consumed tick by tick
+        InputState m_tickInput;
+        InputRecorder m_recorder;
+        InputReplay m_replay;
+        static constexpr std::uint64_t kDefaultHeadlessTicks = 600;
+
+        // === STATE REPLAY ===
+        // The whole simulation state is SimulationState followed by every
+        // component column of m_world, one flat block of stateBytes(). It is
+        // recorded after each tick; a replayed run starts from the recorded
+        // state at the seek tick, takes the recorded input from there on and
+        // checks every tick it simulates against the stream.
+        std::size_t stateBytes() const;
+        void captureState(std::byte* out) const;
+        void restoreState(const std::byte* in);
+        StateRecorder m_stateRecorder;
+        StateReplay m_stateReplay;
+        std::vector<std::byte> m_stateBuffer;
+        double m_seekMs = 0.0;
+        std::uint64_t m_replayChecked = 0;
+        std::uint64_t m_replayDiverged = 0;
+        std::uint64_t m_firstDivergence = 0;
 
         // === TIMING ===
         double m_lastTime = 0.0;
-        double m_accumulator = 0.0;
         const double m_fixedTimestep = 1.0 / 60.0;
+        // Catch-up bound: a frame that falls further behind than this drops
+        // the rest of its backlog, so a stall slows the world for a moment
+        // instead of making every following frame slower still
+        static constexpr int kMaxTicksPerFrame = 5;
+        std::uint64_t m_droppedTicks = 0;
+        FramePacer m_pacer;
+
+        // Camera state before the latest tick, blended with the live one like PreviousTransform
+        struct CameraSnapshot {
+            math::Vec3 position;
+            CameraLook look;
+        };
+
+        // Everything the simulation carries between ticks outside m_world.
+        // Plain data with no padding, so a state snapshot copies it whole.
+        struct SimulationState {
+            std::uint64_t tick = 0;          // fixed ticks simulated
+            double time = 0.0;               // seconds simulated, advanced by update()
+            CameraSnapshot previousCamera;
+            // Wall-clock side: restored with the rest, left out of replay checks
+            float renderAlpha = 1.0f;        // leftover fraction of a tick the frame renders at
+            double accumulator = 0.0;        // frame time not yet simulated
+        };
+        static_assert(sizeof(SimulationState) == 72, "SimulationState must not gain padding");
+        static constexpr std::size_t kCheckedStateBytes = offsetof(SimulationState, renderAlpha);
+        SimulationState m_sim;
+        FrameTimeStats m_frameStats;
+        double m_statsTimer = 0.0;
+
     };
 
 } // namespace engine
\ No newline at end of file
@@ -0,0 +1,75 @@
+// include/engine/core/EngineConfig.h
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace engine {
+
+    enum class DisplayMode {
+        Windowed,    // normal interactive window
+        Offscreen,   // hidden window + real GL context (software GL on CI boxes)
+        Headless,    // no window, no GL - simulation and CPU render prep only
+    };
+
+    enum class VsyncMode {
+        Off,
+        On,
+        Adaptive,    // vsync, but a late frame swaps immediately instead of waiting a whole refresh
+    };
+
+    enum class BroadphaseMode {
+        Off,
+        SweepAndPrune,
+        SpatialHash,
+    };
+
+    // Launch options, filled from the command line by main()
+    struct EngineConfig {
+        DisplayMode display = DisplayMode::Windowed;
+
+        // > 0: run exactly this many fixed ticks as fast as possible, then
+        // print throughput, tick-time distribution and peak memory
+        std::uint64_t ticks = 0;
+
+        // Extra spinning renderables on top of the default scene, for load
+        std::uint32_t extraEntities = 0;
+
+        // Particle pool size; 0 = no particles. A fountain emits enough to keep it about full.
+        std::uint32_t particles = 0;
+
+        // Overlap pairs among the renderables' world boxes, every prepared frame
+        BroadphaseMode broadphase = BroadphaseMode::Off;
+
+        std::string recordInputPath;   // write per-tick input here
+        std::string replayInputPath;   // drive ticks from this recording instead of SDL
+
+        // Append-only stream of each tick's input and resulting state, for
+        // crash repro. Replaying one restores the state at seekTick (-1: its
+        // first tick), then drives ticks from its input and checks each one.
+        std::string recordStatePath;
+        std::string replayStatePath;
+        std::int64_t seekTick = -1;
+
+        // Read assets/ from disk (with shader hot reload) even when assets.pak exists
+        bool looseAssets = false;
+
+        // .emesh files (on disk or in assets.pak) streamed in after startup
+        std::vector<std::string> meshPaths;
+
+        // Swap interval, and an optional frame rate cap the engine paces to on
+        // its own (works with vsync off, or below the display's refresh)
+        VsyncMode vsync = VsyncMode::Adaptive;
+        double frameCap = 0.0;   // frames per second, 0 = uncapped
+
+        bool hasGL() const { return display != DisplayMode::Headless; }
+    };
+
+    // Parses --headless, --offscreen, --ticks N, --entities N, --particles N,
+    // --broadphase sap|hash, --record FILE, --replay FILE, --record-state FILE,
+    // --replay-state FILE, --seek N, --loose-assets, --mesh FILE,
+    // --vsync on|off|adaptive, --fps-cap N. Prints usage and returns false
+    // on anything unknown.
+    bool parseEngineConfig(int argc, char* argv[], EngineConfig& out);
+
+} // namespace engine
@@ -0,0 +1,48 @@
+// include/engine/core/FramePacer.h
+#pragma once
+#include <cstdint>
+#include "engine/core/EngineConfig.h"
+
+namespace engine {
+
+    // Sets the swap interval and, when a frame cap is given, holds each
+    // frame until its deadline. Waiting sleeps for all but the last stretch
+    // and spins (yielding) through that, so the wake-up lands on time
+    // without burning a core for the whole wait. The stretch is learned
+    // from how late the OS actually wakes us. Main thread only.
+    class FramePacer {
+    public:
+        struct Stats {
+            std::uint64_t frames = 0;        // wait() calls with a cap
+            std::uint64_t lateFrames = 0;    // already past the deadline on entry
+            std::uint64_t sleptNs = 0;
+            std::uint64_t spunNs = 0;
+        };
+
+        FramePacer() = default;
+        ~FramePacer();
+
+        FramePacer(const FramePacer&) = delete;
+        FramePacer& operator=(const FramePacer&) = delete;
+
+        // GL context must be current. Adaptive falls back to plain vsync
+        // where the driver lacks late swap tearing.
+        void configure(VsyncMode vsync, double frameCap);
+
+        // Blocks until the next frame may start; returns at once when uncapped
+        void wait();
+
+        VsyncMode vsync() const { return m_vsync; }
+        std::uint64_t spinWindowNs() const { return m_spinWindowNs; }
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        VsyncMode m_vsync = VsyncMode::Off;
+        std::uint64_t m_periodNs = 0;         // 0 = uncapped
+        std::uint64_t m_deadline = 0;         // profiler clock
+        std::uint64_t m_spinWindowNs = 2000000;
+        bool m_fineTimer = false;             // raised OS timer resolution to release
+        Stats m_stats;
+    };
+
+} // namespace engine
@@ -0,0 +1,100 @@
+// include/engine/core/Input.h
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace engine {
+
+    enum InputButton : std::uint32_t {
+        kInputForward = 1u << 0,
+        kInputBack    = 1u << 1,
+        kInputLeft    = 1u << 2,
+        kInputRight   = 1u << 3,
+        kInputLook    = 1u << 4,   // right mouse held: mouse deltas turn the camera
+    };
+
+    // Everything gameplay reads from the player for one fixed tick. Built
+    // once per tick from the event queue, so it can be recorded and replayed
+    // to drive the simulation bit-for-bit without SDL.
+    struct InputState {
+        std::uint32_t buttons = 0;
+        std::int32_t mouseDX = 0;
+        std::int32_t mouseDY = 0;
+
+        bool held(InputButton button) const { return (buttons & button) != 0; }
+    };
+
+    // === EVENTS ===
+    enum class InputEventType : std::uint8_t { ButtonDown, ButtonUp, MouseMotion };
+
+    struct InputEvent {
+        std::uint64_t time = 0;        // profiler::now() clock, nanoseconds
+        InputEventType type = InputEventType::MouseMotion;
+        std::uint32_t buttons = 0;     // InputButton bits for ButtonDown/ButtonUp
+        std::int32_t dx = 0;           // MouseMotion, relative
+        std::int32_t dy = 0;
+    };
+
+    // Timestamped input events on their way to the fixed-tick simulation.
+    // The event pump pushes; the simulation pulls each tick's share by
+    // timestamp, so several ticks in one frame split the frame's input
+    // instead of the first tick getting all of it. Lock-free single
+    // producer / single consumer: push() from one thread, everything else
+    // from one (possibly different) thread.
+    class InputQueue {
+    public:
+        static constexpr std::size_t kCapacity = 1024;   // power of two
+
+        // False (and the event dropped) when the consumer is kCapacity behind
+        bool push(const InputEvent& event);
+
+        // Consumes every event stamped before tickEnd. Buttons pressed and
+        // released inside the tick still show as held for it.
+        InputState nextTick(std::uint64_t tickEnd);
+
+        // Look motion not yet consumed by a tick, without consuming it: lets
+        // the camera turn with the newest mouse motion right before render
+        void pendingMouse(std::int32_t& dx, std::int32_t& dy) const;
+
+        std::uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+        InputEvent m_events[kCapacity];
+        alignas(64) std::atomic<std::size_t> m_head{ 0 };   // next write, producer owned
+        alignas(64) std::atomic<std::size_t> m_tail{ 0 };   // next read, consumer owned
+        std::atomic<std::uint64_t> m_dropped{ 0 };
+        std::uint32_t m_held = 0;   // consumer: buttons down as of the last consumed event
+    };
+
+    // Appends one InputState per tick to a binary file
+    class InputRecorder {
+    public:
+        bool open(const std::string& path);
+        bool isOpen() const { return m_file.is_open(); }
+        void write(const InputState& input);
+        void close();
+
+    private:
+        std::ofstream m_file;
+        std::uint32_t m_ticks = 0;
+    };
+
+    // Reads back a file written by InputRecorder
+    class InputReplay {
+    public:
+        bool open(const std::string& path);
+        bool isOpen() const { return m_file.is_open(); }
+        // False once the recording is exhausted
+        bool next(InputState& out);
+        std::uint32_t tickCount() const { return m_ticks; }
+
+    private:
+        std::ifstream m_file;
+        std::uint32_t m_ticks = 0;
+        std::uint32_t m_read = 0;
+    };
+
+} // namespace engine
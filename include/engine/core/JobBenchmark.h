@@ -0,0 +1,10 @@
+// include/engine/core/JobBenchmark.h
+#pragma once
+
+namespace engine {
+
+    // Runs fixed workloads through JobSystem with 1..maxWorkers workers and
+    // prints time and speedup per worker count. maxWorkers 0 = hardware threads.
+    int runJobBenchmark(unsigned maxWorkers = 0);
+
+} // namespace engine
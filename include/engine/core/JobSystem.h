@@ -0,0 +1,191 @@
+// include/engine/core/JobSystem.h
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace engine {
+
+    struct Job;
+
+    // Counts outstanding jobs. Jobs submitted with a counter bump it on
+    // submit and drop it when they finish; wait() blocks until it reaches
+    // zero. Jobs queued with runAfter() are released when it hits zero.
+    class JobCounter {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool done() const { return m_value.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class JobSystem;
+        std::atomic<int> m_value{ 0 };
+        std::mutex m_continuationLock;
+        Job* m_continuations = nullptr;
+    };
+
+    struct Job {
+        static constexpr std::size_t kStorage = 48;
+
+        void (*invoke)(Job*) = nullptr;
+        JobCounter* counter = nullptr;
+        Job* next = nullptr;                  // continuation list link
+        std::atomic<bool> inUse{ false };
+        bool heapAllocated = false;
+        alignas(16) unsigned char storage[kStorage];
+    };
+
+    class JobSystem {
+    public:
+        // workerCount includes the calling (main) thread; 0 = one per hardware thread
+        explicit JobSystem(unsigned workerCount = 0);
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        unsigned workerCount() const { return static_cast<unsigned>(m_queues.size()); }
+
+        // === SUBMISSION ===
+        template <typename Fn> void run(Fn&& fn, JobCounter* counter = nullptr);
+        // Held back until dependency reaches zero
+        template <typename Fn> void runAfter(JobCounter& dependency, Fn&& fn, JobCounter* counter = nullptr);
+        // Queued for the thread that constructed the JobSystem (SDL/GL calls)
+        template <typename Fn> void runOnMainThread(Fn&& fn, JobCounter* counter = nullptr);
+
+        // Executes other jobs until the counter reaches zero
+        void wait(JobCounter& counter);
+
+        // fn(begin, end) over [0, count) in grain-sized slices; returns when all are done
+        template <typename Fn> void parallelFor(std::size_t count, std::size_t grain, Fn&& fn);
+
+        // === MAIN THREAD LANE ===
+        bool isMainThread() const { return std::this_thread::get_id() == m_mainThread; }
+        void pumpMainThread();
+
+    private:
+        // Chase-Lev work-stealing deque: the owner pushes/pops at the bottom,
+        // thieves take from the top.
+        class WorkQueue {
+        public:
+            static constexpr std::int64_t kCapacity = 4096;
+
+            bool push(Job* job);
+            Job* pop();
+            Job* steal();
+
+        private:
+            alignas(64) std::atomic<std::int64_t> m_top{ 0 };
+            alignas(64) std::atomic<std::int64_t> m_bottom{ 0 };
+            std::atomic<Job*> m_jobs[kCapacity];
+        };
+
+        template <typename Fn> Job* makeJob(Fn&& fn, JobCounter* counter);
+        Job* allocateJob();
+        void submit(Job* job);
+        void execute(Job* job);
+        Job* findJob(unsigned self);
+        void workerLoop(unsigned index);
+        void finish(JobCounter* counter);
+
+        std::vector<std::unique_ptr<WorkQueue>> m_queues;
+        std::vector<std::thread> m_threads;
+        std::thread::id m_mainThread;
+
+        // Submissions from threads that own no queue
+        std::mutex m_injectLock;
+        std::deque<Job*> m_injected;
+
+        // Both reserved once so pumping every frame never touches the heap.
+        // m_mainRun is main-thread only; a job that waits, and so pumps
+        // again, carries on from m_mainRunNext instead of starting over.
+        std::mutex m_mainLaneLock;
+        std::vector<Job*> m_mainLane;
+        std::vector<Job*> m_mainRun;
+        std::size_t m_mainRunNext = 0;
+
+        // Sleeping workers wake when m_pending rises above zero
+        std::atomic<int> m_pending{ 0 };
+        std::atomic<int> m_sleepers{ 0 };
+        std::mutex m_sleepLock;
+        std::condition_variable m_wake;
+        std::atomic<bool> m_quit{ false };
+    };
+
+    // === TEMPLATE IMPLEMENTATION ===
+    template <typename Fn>
+    Job* JobSystem::makeJob(Fn&& fn, JobCounter* counter) {
+        using Callable = std::decay_t<Fn>;
+        static_assert(sizeof(Callable) <= Job::kStorage, "job capture too large - capture by reference or pointer");
+        static_assert(alignof(Callable) <= 16, "job capture over-aligned");
+
+        Job* job = allocateJob();
+        new (job->storage) Callable(std::forward<Fn>(fn));
+        job->invoke = [](Job* j) {
+            Callable* callable = std::launder(reinterpret_cast<Callable*>(j->storage));
+            (*callable)();
+            callable->~Callable();
+        };
+        job->counter = counter;
+        if (counter) counter->m_value.fetch_add(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    template <typename Fn>
+    void JobSystem::run(Fn&& fn, JobCounter* counter) {
+        submit(makeJob(std::forward<Fn>(fn), counter));
+    }
+
+    template <typename Fn>
+    void JobSystem::runAfter(JobCounter& dependency, Fn&& fn, JobCounter* counter) {
+        Job* job = makeJob(std::forward<Fn>(fn), counter);
+        {
+            std::lock_guard<std::mutex> lock(dependency.m_continuationLock);
+            if (!dependency.done()) {
+                job->next = dependency.m_continuations;
+                dependency.m_continuations = job;
+                return;
+            }
+        }
+        submit(job);
+    }
+
+    template <typename Fn>
+    void JobSystem::runOnMainThread(Fn&& fn, JobCounter* counter) {
+        Job* job = makeJob(std::forward<Fn>(fn), counter);
+        std::lock_guard<std::mutex> lock(m_mainLaneLock);
+        m_mainLane.push_back(job);
+    }
+
+    template <typename Fn>
+    void JobSystem::parallelFor(std::size_t count, std::size_t grain, Fn&& fn) {
+        if (count == 0) return;
+        if (grain == 0) grain = 1;
+        if (count <= grain || workerCount() == 1) {
+            fn(std::size_t(0), count);
+            return;
+        }
+
+        JobCounter counter;
+        auto* body = &fn;
+        // The caller keeps the first slice for itself
+        for (std::size_t begin = grain; begin < count; begin += grain) {
+            std::size_t end = begin + grain < count ? begin + grain : count;
+            run([body, begin, end] { (*body)(begin, end); }, &counter);
+        }
+        fn(std::size_t(0), grain);
+        wait(counter);
+    }
+
+} // namespace engine
@@ -0,0 +1,174 @@
+// include/engine/core/Memory.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace engine::memory {
+
+    // === TAGGED BUDGETS ===
+    // Every allocator below charges its memory to one subsystem tag. A tag
+    // with a budget warns once when it first goes over.
+    enum class Tag : std::uint8_t { General, Ecs, Render, Shaders, Assets, Frame, Count };
+
+    struct TagStats {
+        std::size_t current = 0;
+        std::size_t peak = 0;
+        std::size_t budget = 0;        // 0 = unlimited
+        std::uint64_t allocations = 0;
+    };
+
+    const char* tagName(Tag tag);
+    void setBudget(Tag tag, std::size_t bytes);
+    TagStats stats(Tag tag);
+    void noteAlloc(Tag tag, std::size_t bytes);
+    void noteFree(Tag tag, std::size_t bytes);
+    void printStats();
+
+    // === GLOBAL HEAP ===
+    // operator new is replaced to count calls. Threads marked as frame
+    // threads (main + job workers) also bump frameHeapAllocations(), which
+    // the engine's debug check expects to stay flat across a steady frame.
+    std::uint64_t heapAllocations();
+    std::uint64_t frameHeapAllocations();
+    void markFrameThread();
+
+    // Work that is allowed to allocate inside a frame (asset reloads,
+    // streaming, structural changes) runs under one of these
+    class AllowHeap {
+    public:
+        AllowHeap();
+        ~AllowHeap();
+        AllowHeap(const AllowHeap&) = delete;
+        AllowHeap& operator=(const AllowHeap&) = delete;
+    };
+
+    // Forwards to new/delete and charges the tag; one shared instance per tag
+    class TaggedResource : public std::pmr::memory_resource {
+    public:
+        explicit TaggedResource(Tag tag) : m_tag(tag) {}
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        Tag m_tag;
+    };
+
+    std::pmr::memory_resource* resource(Tag tag);
+
+    // === LINEAR ARENA ===
+    // Bump allocator over one fixed block. deallocate is a no-op; reset()
+    // frees everything at once. Running out never fails: the request falls
+    // back to the heap (counted and warned about once) and is released on
+    // the next reset. Not thread-safe.
+    class LinearArena : public std::pmr::memory_resource {
+    public:
+        explicit LinearArena(std::size_t capacity, Tag tag = Tag::Frame);
+        ~LinearArena() override;
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        void reset();
+
+        std::size_t used() const { return m_used; }
+        std::size_t capacity() const { return m_capacity; }
+        std::size_t highWater() const { return m_highWater; }
+        std::uint64_t overflows() const { return m_overflows; }
+
+    private:
+        struct Overflow {
+            Overflow* next;
+            std::size_t bytes;      // header included
+            std::size_t alignment;
+        };
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        std::byte* m_base = nullptr;
+        std::size_t m_capacity = 0;
+        std::size_t m_used = 0;
+        std::size_t m_highWater = 0;
+        std::uint64_t m_overflows = 0;
+        Overflow* m_overflow = nullptr;
+        Tag m_tag;
+    };
+
+    // Two arenas, swapped by endFrame(). Data allocated during frame N stays
+    // valid through frame N + 1, so a consumer one frame behind can still
+    // read it; the arena being reused is reset as it becomes current.
+    class FrameAllocator {
+    public:
+        explicit FrameAllocator(std::size_t bytesPerFrame, Tag tag = Tag::Frame);
+
+        LinearArena& current() { return *m_arenas[m_index]; }
+        const LinearArena& previous() const { return *m_arenas[m_index ^ 1]; }
+        void endFrame();
+
+    private:
+        std::unique_ptr<LinearArena> m_arenas[2];
+        unsigned m_index = 0;
+    };
+
+    // === POOLS ===
+    // Fixed-size blocks carved from slabs of blocksPerSlab; freed blocks go
+    // on an intrusive free list and slabs are only returned on destruction.
+    // Not thread-safe.
+    class PoolAllocator {
+    public:
+        PoolAllocator(std::size_t blockSize, std::size_t blocksPerSlab, Tag tag, std::size_t alignment = alignof(std::max_align_t));
+        ~PoolAllocator();
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        void* allocate();
+        void deallocate(void* block);
+
+        std::size_t blockSize() const { return m_blockSize; }
+        std::size_t alignment() const { return m_alignment; }
+        std::size_t blocksInUse() const { return m_inUse; }
+        std::size_t slabCount() const { return m_slabs.size(); }
+
+    private:
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        void grow();
+
+        std::size_t m_blockSize;
+        std::size_t m_blocksPerSlab;
+        std::size_t m_alignment;
+        Tag m_tag;
+        FreeBlock* m_free = nullptr;
+        std::size_t m_inUse = 0;
+        std::vector<void*> m_slabs;
+    };
+
+    // pmr view of a pool: requests that fit a block come from the pool,
+    // anything larger or more aligned goes upstream
+    class PoolResource : public std::pmr::memory_resource {
+    public:
+        explicit PoolResource(PoolAllocator& pool, std::pmr::memory_resource* upstream = resource(Tag::General))
+            : m_pool(pool), m_upstream(upstream) {}
+
+    private:
+        bool fits(std::size_t bytes, std::size_t alignment) const {
+            return bytes <= m_pool.blockSize() && alignment <= m_pool.alignment();
+        }
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        PoolAllocator& m_pool;
+        std::pmr::memory_resource* m_upstream;
+    };
+
+} // namespace engine::memory
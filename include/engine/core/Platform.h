@@ -0,0 +1,37 @@
+// include/engine/core/Platform.h
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace engine {
+
+    // Peak resident set size of this process in bytes (0 if unavailable)
+    std::size_t peakResidentBytes();
+
+    // Read-only memory mapping of a whole file. Pages fault in on first touch;
+    // after open() reading costs no syscalls and no copies.
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool open(const std::string& path);
+        void close();
+
+        bool isOpen() const { return m_data != nullptr; }
+        const char* data() const { return m_data; }
+        std::size_t size() const { return m_size; }
+
+    private:
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+#if defined(_WIN32)
+        void* m_file = nullptr;      // HANDLE
+        void* m_mapping = nullptr;   // HANDLE
+#endif
+    };
+
+} // namespace engine
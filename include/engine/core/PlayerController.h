@@ -1,17 +1,38 @@
 // include/engine/core/PlayerController.h
 #pragma once
 #include <SDL.h>
+#include <cstdint>
+#include "engine/core/Input.h"
+#include "engine/ecs/World.h"
 
 namespace engine {
 
+    struct CameraLook;
+
+    // System: WASD fly movement and right-mouse look for every entity with
+    // Position + CameraLook + PlayerControlled. Reads only the per-tick
+    // InputState, so it is deterministic and safe to run as a job.
     class PlayerController {
     public:
+        static constexpr float kLookDegreesPerCount = 0.22f;
+
         PlayerController();
-        void update(float dt, float cameraPos[3], float& yaw, float& pitch, bool& mouseCaptured);
-        void handleEvent(const SDL_Event& event);
+        void update(ecs::World& world, float dt, const InputState& input);
+
+        // Translates one SDL event into the queue, stamped with time (same
+        // clock as InputEvent::time), and toggles relative mouse mode while
+        // the look button is held. Main thread only.
+        void handleEvent(const SDL_Event& event, std::uint64_t time, InputQueue& queue);
+
+        // The one mouse-to-angle mapping, shared by the tick and by render's
+        // late look sampling so both turn the camera identically. Refreshes
+        // the cached basis when the angles move.
+        static void applyLook(CameraLook& look, std::int32_t dx, std::int32_t dy);
+        // Recomputes look.forward/right from yaw and pitch
+        static void updateLookBasis(CameraLook& look);
 
     private:
-        bool m_rightMouseDown = false;
+        bool m_mouseCaptured = false;
     };
 
-} // namespace engine
\ No newline at end of file
+} // namespace engine
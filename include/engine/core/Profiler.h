@@ -0,0 +1,95 @@
+// include/engine/core/Profiler.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Scope markers compile to nothing unless ENGINE_PROFILING is non-zero
+// (set from the ENGINE_PROFILING CMake option)
+#ifndef ENGINE_PROFILING
+#define ENGINE_PROFILING 1
+#endif
+
+namespace engine {
+
+    // Rolling window of frame times with percentile summary. Always compiled
+    // in - one store per frame is cheap enough to keep in release builds.
+    class FrameTimeStats {
+    public:
+        static constexpr std::size_t kWindow = 240;
+
+        struct Summary {
+            double p50 = 0.0, p95 = 0.0, p99 = 0.0;
+            double mean = 0.0, max = 0.0;   // milliseconds
+            std::size_t samples = 0;
+        };
+
+        void add(double milliseconds);
+        Summary summary() const;
+
+        // Percentiles over an arbitrary sample set; sorts samples in place
+        static Summary summarize(double* samples, std::size_t count);
+
+    private:
+        double m_samples[kWindow] = {};
+        std::size_t m_next = 0;
+        std::size_t m_count = 0;
+    };
+
+    namespace profiler {
+
+        // Nanoseconds on a monotonic clock shared by every thread
+        std::uint64_t now();
+
+#if ENGINE_PROFILING
+        // Appends a completed scope to the calling thread's ring. name must
+        // outlive the profiler (string literals).
+        void record(const char* name, std::uint64_t begin, std::uint64_t end);
+
+        // Appends a completed GPU pass to the trace's "GPU" row; begin/end
+        // already on now()'s clock. Called from the GL thread only.
+        void recordGpu(const char* name, std::uint64_t begin, std::uint64_t end);
+
+        // Label shown for the calling thread in the trace viewer
+        void setThreadName(const char* name);
+
+        // Moves every thread's ring into the trace history. Call once per
+        // frame from the main thread; producers never block on it.
+        void collect();
+
+        // Writes the trace history as Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev)
+        bool dumpChromeTrace(const std::string& path);
+
+        class Scope {
+        public:
+            explicit Scope(const char* name) : m_name(name), m_begin(now()) {}
+            ~Scope() { record(m_name, m_begin, now()); }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            const char* m_name;
+            std::uint64_t m_begin;
+        };
+#else
+        inline void record(const char*, std::uint64_t, std::uint64_t) {}
+        inline void recordGpu(const char*, std::uint64_t, std::uint64_t) {}
+        inline void setThreadName(const char*) {}
+        inline void collect() {}
+        inline bool dumpChromeTrace(const std::string&) { return false; }
+#endif
+
+    } // namespace profiler
+
+} // namespace engine
+
+#define ENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_INNER(a, b)
+
+#if ENGINE_PROFILING
+#define ENGINE_PROFILE_SCOPE(name) ::engine::profiler::Scope ENGINE_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#else
+#define ENGINE_PROFILE_SCOPE(name) ((void)0)
+#endif
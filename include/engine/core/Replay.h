@@ -0,0 +1,100 @@
+// include/engine/core/Replay.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "engine/core/Input.h"
+
+namespace engine {
+
+    // === DELTAS ===
+    // The XOR of two equally sized states, run-length coded as repeated
+    // (unchanged bytes to skip, changed bytes, those bytes XORed) with
+    // LEB128 counts. Runs are found eight bytes at a time. Applying XORs in
+    // place, so one delta turns the older state into the newer and back.
+
+    // Worst case encodeDelta() output for a state of this size
+    std::size_t maxDeltaBytes(std::size_t stateBytes);
+    // Returns the bytes written to out; 0 when the states are identical
+    std::size_t encodeDelta(const std::byte* from, const std::byte* to, std::size_t stateBytes, std::byte* out);
+    // False (state partly updated) if the delta is malformed or overruns the state
+    bool applyDelta(const std::byte* delta, std::size_t deltaBytes, std::byte* state, std::size_t stateBytes);
+
+    // === STREAM ===
+    // Append-only replay stream: a header naming the state size and world
+    // layout, then one record per fixed tick holding that tick's input and
+    // the state it left - either a keyframe (the whole state) or a delta
+    // from the record before. A new keyframe starts once the deltas since
+    // the last one add up to a whole state, so rebuilding any tick costs at
+    // most one state copy plus one state's worth of deltas. Records are
+    // flushed as they are written; a crash loses at most the tick in flight.
+    class StateRecorder {
+    public:
+        struct Stats {
+            std::uint64_t records = 0;
+            std::uint64_t keyframes = 0;
+            std::uint64_t bytes = 0;   // written, headers included
+        };
+
+        bool open(const std::string& path, std::size_t stateBytes, std::uint64_t layout);
+        bool isOpen() const { return m_file.is_open(); }
+        // Ticks must be consecutive after the first
+        void write(std::uint64_t tick, const InputState& input, const std::byte* state);
+        void close();
+
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        std::ofstream m_file;
+        std::size_t m_stateBytes = 0;
+        std::vector<std::byte> m_previous;
+        std::vector<std::byte> m_delta;
+        std::size_t m_deltaBytesSinceKeyframe = 0;
+        Stats m_stats;
+    };
+
+    // Reads a stream written by StateRecorder into memory and rebuilds the
+    // state after any recorded tick. A torn last record, from a writer that
+    // died mid-tick, is ignored.
+    class StateReplay {
+    public:
+        bool open(const std::string& path, std::size_t stateBytes, std::uint64_t layout);
+        bool isOpen() const { return !m_records.empty(); }
+
+        std::uint64_t firstTick() const { return m_firstTick; }
+        std::uint64_t lastTick() const { return m_firstTick + m_records.size() - 1; }
+
+        // State after tick into state(). Goes forward from the current tick,
+        // back from it by undoing deltas, or forward from the nearest
+        // keyframe, whichever touches fewer records.
+        bool seek(std::uint64_t tick);
+        std::uint64_t tick() const { return m_tick; }
+        const std::byte* state() const { return m_state.data(); }
+        std::size_t recordsApplied() const { return m_applied; }   // by the last seek
+
+        // The input that drove tick; firstTick() < tick <= lastTick()
+        InputState input(std::uint64_t tick) const { return m_records[tick - m_firstTick].input; }
+
+    private:
+        struct Record {
+            std::size_t payload;    // offset into m_stream
+            std::uint32_t bytes;
+            bool keyframe;
+            InputState input;
+        };
+
+        bool apply(std::size_t record);   // keyframe: copy; delta: XOR in
+
+        std::vector<std::byte> m_stream;
+        std::vector<Record> m_records;            // by tick - m_firstTick
+        std::vector<std::uint32_t> m_keyframeOf;  // per record, the keyframe at or before it
+        std::vector<std::byte> m_state;
+        std::uint64_t m_firstTick = 0;
+        std::uint64_t m_tick = 0;
+        bool m_valid = false;                     // m_state holds m_tick
+        std::size_t m_applied = 0;
+    };
+
+} // namespace engine
@@ -0,0 +1,41 @@
+// include/engine/core/Systems.h
+#pragma once
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+#include "engine/ecs/World.h"
+#include "engine/math/Math.h"
+
+namespace engine {
+
+    class JobSystem;
+    class TransformHierarchy;
+
+    // Systems keep their per-call working lists in scratch; pass the frame
+    // arena so a steady frame does not touch the heap.
+
+    // Copies Position/Rotation into PreviousTransform; run at the start of every tick
+    void snapshotSystem(ecs::World& world, JobSystem& jobs,
+                        std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+    // Advances Spin angles and writes the result into Rotation, one job per chunk
+    void spinSystem(ecs::World& world, float dt, JobSystem& jobs,
+                    std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+    // Pushes the local transform of every SceneNode entity, blended alpha of
+    // the way from its PreviousTransform to Position/Rotation, into the
+    // hierarchy. Nodes whose blended value did not change stay clean.
+    void sceneSyncSystem(ecs::World& world, TransformHierarchy& scene, float alpha, JobSystem& jobs,
+                         std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+    // Gives every Renderable with a SceneNode a slot: its mesh id goes in
+    // meshes, its hierarchy index in nodes, and bounds gets a world box from
+    // meshRadius (object-space radius around the origin, by mesh id) and the
+    // node's updated world matrix. The box ignores rotation, so spinning
+    // never moves it.
+    void renderPrepSystem(ecs::World& world, const TransformHierarchy& scene, std::vector<std::uint32_t>& meshes,
+                          std::vector<std::uint32_t>& nodes, std::vector<math::Aabb>& bounds,
+                          const std::vector<float>& meshRadius, JobSystem& jobs,
+                          std::pmr::memory_resource* scratch = std::pmr::get_default_resource());
+
+} // namespace engine
@@ -0,0 +1,101 @@
+// include/engine/core/TripleBuffer.h
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace engine {
+
+    // Single-producer / single-consumer exchange of whole T objects. The
+    // producer fills back() and publishes it; the consumer acquires the
+    // newest published slot as front(). Three slots mean neither side ever
+    // touches the one the other is using, and the handoff itself is one
+    // atomic exchange per side - no locks.
+    //
+    // The wait* calls are for a side with nothing to do. They sleep on a
+    // condition variable, which publish()/acquire() only touch while
+    // someone is actually asleep.
+    template <typename T>
+    class TripleBuffer {
+    public:
+        TripleBuffer() = default;
+        TripleBuffer(const TripleBuffer&) = delete;
+        TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+        // === PRODUCER ===
+        T& back() { return m_slots[m_back]; }
+
+        // Hands back() over as the newest slot and takes a free one in its
+        // place. False when it replaced a slot the consumer never took.
+        bool publish() {
+            unsigned old = m_middle.exchange(m_back | kFresh);
+            m_back = old & kIndexMask;
+            wake();
+            return !(old & kFresh);
+        }
+
+        // Blocks while a published slot is still waiting for the consumer
+        void waitUntilTaken() {
+            sleepUntil([this] { return !(m_middle.load() & kFresh) || m_closed.load(); });
+        }
+
+        // === CONSUMER ===
+        T& front() { return m_slots[m_front]; }
+
+        // Takes the newest published slot; false (front() unchanged) when none
+        bool acquire() {
+            if (!(m_middle.load() & kFresh)) return false;
+            m_front = m_middle.exchange(m_front) & kIndexMask;
+            wake();
+            return true;
+        }
+
+        // Blocks until a slot is published, then acquires it; false once closed
+        bool waitAndAcquire() {
+            sleepUntil([this] { return (m_middle.load() & kFresh) || m_closed.load(); });
+            return !m_closed.load() && acquire();
+        }
+
+        // Releases every waiter, now and later
+        void close() {
+            m_closed.store(true);
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_wake.notify_all();
+        }
+
+    private:
+        static constexpr unsigned kIndexMask = 3;
+        static constexpr unsigned kFresh = 4;   // middle holds a slot the consumer has not taken
+
+        // Sleepers announce themselves before checking, and wakers exchange
+        // before looking for sleepers (both sequentially consistent), so a
+        // sleeper either sees the change or is seen and notified under the lock
+        template <typename Ready>
+        void sleepUntil(Ready ready) {
+            if (ready()) return;
+            m_sleepers.fetch_add(1);
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_wake.wait(lock, ready);
+            }
+            m_sleepers.fetch_sub(1);
+        }
+
+        void wake() {
+            if (m_sleepers.load() == 0) return;
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_wake.notify_all();
+        }
+
+        T m_slots[3];
+        unsigned m_back = 0;                 // producer only
+        std::atomic<unsigned> m_middle{ 1 };
+        unsigned m_front = 2;                // consumer only
+        std::atomic<bool> m_closed{ false };
+
+        std::atomic<int> m_sleepers{ 0 };
+        std::mutex m_lock;
+        std::condition_variable m_wake;
+    };
+
+} // namespace engine
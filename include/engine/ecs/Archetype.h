@@ -0,0 +1,62 @@
+// include/engine/ecs/Archetype.h
+#pragma once
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "engine/ecs/Entity.h"
+#include "engine/core/Memory.h"
+
+namespace engine::ecs {
+
+    // All entities with exactly the same component set. Storage is a list of
+    // fixed-size chunks; inside a chunk every component is one contiguous
+    // column starting on a cache line. Rows are kept dense: entity i lives in
+    // chunk i / capacity, row i % capacity. Chunks come from the world's
+    // pool and go back to it when the archetype shrinks.
+    class Archetype {
+    public:
+        static constexpr std::size_t kChunkBytes = 16 * 1024;
+        static constexpr std::size_t kColumnAlign = 64;
+
+        Archetype(ComponentMask mask, memory::PoolAllocator& chunkPool);
+        ~Archetype();
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        ComponentMask mask() const { return m_mask; }
+        bool has(ComponentId id) const { return (m_mask & componentBit(id)) != 0; }
+        const std::vector<ComponentId>& components() const { return m_components; }
+
+        std::size_t size() const { return m_count; }
+        std::size_t chunkCapacity() const { return m_capacity; }
+        std::size_t chunkCount() const { return (m_count + m_capacity - 1) / m_capacity; }
+        std::size_t chunkSize(std::size_t chunk) const {
+            std::size_t begin = chunk * m_capacity;
+            return m_count - begin < m_capacity ? m_count - begin : m_capacity;
+        }
+        std::byte* chunkData(std::size_t chunk) const { return m_chunks[chunk]; }
+        std::size_t columnOffset(ComponentId id) const { return m_offsets[id]; }
+
+        Entity* entities(std::size_t chunk) const { return reinterpret_cast<Entity*>(m_chunks[chunk]); }
+        void* component(std::size_t row, ComponentId id) const {
+            return m_chunks[row / m_capacity] + m_offsets[id] + (row % m_capacity) * componentInfo(id).size;
+        }
+        Entity entityAt(std::size_t row) const { return entities(row / m_capacity)[row % m_capacity]; }
+
+        // Appends a row for e; component data is left uninitialized
+        std::size_t allocate(Entity e);
+        // Moves the last row into row and shrinks; returns the entity that moved (null if none)
+        Entity removeSwap(std::size_t row);
+
+    private:
+        memory::PoolAllocator& m_chunkPool;   // blocks of kChunkBytes, kColumnAlign aligned
+        ComponentMask m_mask = 0;
+        std::vector<ComponentId> m_components;
+        std::array<std::size_t, kMaxComponents> m_offsets{};
+        std::size_t m_capacity = 0;
+        std::size_t m_count = 0;
+        std::vector<std::byte*> m_chunks;
+    };
+
+} // namespace engine::ecs
@@ -0,0 +1,76 @@
+// include/engine/ecs/CommandBuffer.h
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "engine/core/Memory.h"
+#include "engine/ecs/World.h"
+
+namespace engine::ecs {
+
+    // Records structural changes (create/destroy/add/remove) while a query is
+    // iterating, so archetypes are never reshuffled under the iterator.
+    // playback() applies them in record order and clears the buffer.
+    //
+    // Commands are written back to back, each followed by its component
+    // bytes, into fixed-size pages from the buffer's own pool. clear() hands
+    // the pages back, so a buffer reused every frame stops allocating once it
+    // has seen its busiest frame.
+    class CommandBuffer {
+    public:
+        static constexpr std::size_t kPageBytes = 4096;
+
+        CommandBuffer() = default;
+        ~CommandBuffer();
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        // Returns a placeholder that is only meaningful to this buffer's
+        // add/remove/destroy calls until playback creates the real entity.
+        Entity create();
+        void destroy(Entity e);
+
+        template <typename T> void add(Entity e, const T& value) { record(Op::Add, e, componentId<T>(), &value, sizeof(T)); }
+        template <typename T> void remove(Entity e) { record(Op::Remove, e, componentId<T>(), nullptr, 0); }
+
+        void playback(World& world);
+        void clear();
+        bool empty() const { return m_commandCount == 0; }
+
+    private:
+        enum class Op : std::uint8_t { Create, Destroy, Add, Remove };
+
+        struct Command {
+            Op op;
+            ComponentId component;
+            std::uint32_t payloadSize;    // component bytes directly after the command
+            Entity entity;
+        };
+
+        // Header at the start of every page; records follow at kRecordAlign
+        struct Page {
+            Page* next;
+            std::size_t used;             // bytes from the page start, header included
+        };
+
+        static constexpr std::size_t kRecordAlign = alignof(std::max_align_t);
+        static constexpr std::size_t kPageHeader = (sizeof(Page) + kRecordAlign - 1) & ~(kRecordAlign - 1);
+        static constexpr std::size_t kPagesPerSlab = 16;
+
+        // Placeholders carry this generation; real entities never reach it
+        static constexpr std::uint32_t kPendingGeneration = 0xFFFFFFFFu;
+
+        static std::size_t recordBytes(std::size_t payload) {
+            return (sizeof(Command) + payload + kRecordAlign - 1) & ~(kRecordAlign - 1);
+        }
+
+        void record(Op op, Entity e, ComponentId id, const void* data, std::size_t size);
+
+        memory::PoolAllocator m_pages{ kPageBytes, kPagesPerSlab, memory::Tag::Ecs };
+        Page* m_first = nullptr;
+        Page* m_last = nullptr;
+        std::size_t m_commandCount = 0;
+        std::vector<Entity> m_created;    // playback: placeholder index -> real entity
+        std::uint32_t m_pendingCount = 0;
+    };
+
+} // namespace engine::ecs
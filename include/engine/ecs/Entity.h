@@ -0,0 +1,51 @@
+// include/engine/ecs/Entity.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace engine::ecs {
+
+    // Generational handle: index into the world's entity table plus a
+    // generation that invalidates stale handles once the slot is reused.
+    struct Entity {
+        std::uint32_t index = 0;
+        std::uint32_t generation = 0;   // 0 is never issued, so Entity{} is null
+
+        bool isNull() const { return generation == 0; }
+        bool operator==(const Entity& o) const { return index == o.index && generation == o.generation; }
+        bool operator!=(const Entity& o) const { return !(*this == o); }
+    };
+
+    using ComponentId = std::uint32_t;
+    using ComponentMask = std::uint64_t;
+    constexpr ComponentId kMaxComponents = 64;
+
+    struct ComponentInfo {
+        std::size_t size = 0;
+        std::size_t align = 0;
+        bool tag = false;   // empty type: still gets a column, but holds no state
+    };
+
+    namespace detail {
+        ComponentId registerComponent(std::size_t size, std::size_t align, bool tag);
+    }
+
+    const ComponentInfo& componentInfo(ComponentId id);
+
+    // Components are plain data moved with memcpy between chunks
+    template <typename T>
+    ComponentId componentId() {
+        static_assert(std::is_trivially_copyable_v<T>, "ECS components must be trivially copyable");
+        static const ComponentId id = detail::registerComponent(sizeof(T), alignof(T), std::is_empty_v<T>);
+        return id;
+    }
+
+    inline ComponentMask componentBit(ComponentId id) { return ComponentMask(1) << id; }
+
+    template <typename... Ts>
+    ComponentMask componentMask() {
+        return (ComponentMask(0) | ... | componentBit(componentId<Ts>()));
+    }
+
+} // namespace engine::ecs
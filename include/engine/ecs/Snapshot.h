@@ -0,0 +1,27 @@
+// include/engine/ecs/Snapshot.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "engine/ecs/World.h"
+
+namespace engine::ecs {
+
+    // Raw copies of a world's component data, for state snapshots and replay.
+    // Every column of every archetype goes out back to back, chunk by chunk,
+    // one memcpy each; tag components hold nothing and are skipped. Entities
+    // and archetypes are not part of it: a snapshot only loads into a world
+    // of the same structure - same archetypes, same entities in the same
+    // rows - which layoutHash() identifies. The engine creates its entities
+    // up front, so ticks change values and never this layout.
+
+    // Bytes saveColumns() writes for this world
+    std::size_t columnBytes(const World& world);
+
+    // Archetype masks, sizes and every row's entity handle, hashed
+    std::uint64_t layoutHash(const World& world);
+
+    void saveColumns(const World& world, std::byte* out);
+    // in must come from saveColumns() on a world with the same layoutHash()
+    void loadColumns(World& world, const std::byte* in);
+
+} // namespace engine::ecs
@@ -0,0 +1,147 @@
+// include/engine/ecs/World.h
+#pragma once
+#include <cstring>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "engine/ecs/Archetype.h"
+
+namespace engine::ecs {
+
+    class World {
+    public:
+        World();
+        ~World();
+
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+
+        // === STRUCTURAL CHANGES ===
+        Entity create();
+        template <typename... Ts>
+        Entity create(const Ts&... components);
+        void destroy(Entity e);
+        bool alive(Entity e) const;
+        std::size_t entityCount() const { return m_alive; }
+
+        template <typename T> void add(Entity e, const T& value) { addRaw(e, componentId<T>(), &value); }
+        template <typename T> void remove(Entity e) { removeRaw(e, componentId<T>()); }
+
+        // Type-erased forms used by CommandBuffer playback
+        void addRaw(Entity e, ComponentId id, const void* data);
+        void removeRaw(Entity e, ComponentId id);
+
+        // === ACCESS ===
+        template <typename T> T* get(Entity e);
+        template <typename T> bool has(Entity e) const;
+
+        // === QUERIES ===
+        // fn(Ts&...) for every entity that has all of Ts. Iteration walks
+        // matching archetypes chunk by chunk over raw column pointers; the
+        // callable is a template parameter, so there is no indirect call.
+        template <typename... Ts, typename Fn> void each(Fn&& fn);
+        // fn(Entity, Ts&...)
+        template <typename... Ts, typename Fn> void eachEntity(Fn&& fn);
+        // fn(count, const Entity*, Ts*...) once per chunk - for SIMD or job splitting
+        template <typename... Ts, typename Fn> void eachChunk(Fn&& fn);
+
+        const std::vector<std::unique_ptr<Archetype>>& archetypes() const { return m_archetypes; }
+
+    private:
+        struct Record {
+            Archetype* archetype = nullptr;
+            std::size_t row = 0;
+            std::uint32_t generation = 1;
+        };
+
+        Entity allocateEntity();
+        Archetype& archetypeFor(ComponentMask mask);
+        void moveToArchetype(Entity e, Archetype& target);
+        void relocated(Entity moved, std::size_t row);
+
+        // Declared before the archetypes so it outlives them
+        static constexpr std::size_t kChunksPerSlab = 16;
+        memory::PoolAllocator m_chunkPool{ Archetype::kChunkBytes, kChunksPerSlab, memory::Tag::Ecs, Archetype::kColumnAlign };
+        std::vector<std::unique_ptr<Archetype>> m_archetypes;
+        std::unordered_map<ComponentMask, Archetype*> m_archetypeByMask;
+        std::vector<Record> m_records;
+        std::vector<std::uint32_t> m_freeList;
+        std::size_t m_alive = 0;
+    };
+
+    // === TEMPLATE IMPLEMENTATION ===
+    template <typename... Ts>
+    Entity World::create(const Ts&... components) {
+        Entity e = allocateEntity();
+        Archetype& arch = archetypeFor(componentMask<Ts...>());
+        std::size_t row = arch.allocate(e);
+        m_records[e.index].archetype = &arch;
+        m_records[e.index].row = row;
+        (std::memcpy(arch.component(row, componentId<Ts>()), &components, sizeof(Ts)), ...);
+        return e;
+    }
+
+    template <typename T>
+    T* World::get(Entity e) {
+        if (!alive(e)) return nullptr;
+        const Record& r = m_records[e.index];
+        ComponentId id = componentId<T>();
+        if (!r.archetype->has(id)) return nullptr;
+        return static_cast<T*>(r.archetype->component(r.row, id));
+    }
+
+    template <typename T>
+    bool World::has(Entity e) const {
+        return alive(e) && m_records[e.index].archetype->has(componentId<T>());
+    }
+
+    namespace detail {
+
+        inline void prefetchChunk(const std::byte* data) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(data);
+#else
+            (void)data;
+#endif
+        }
+
+        template <typename... Ts, typename Fn, std::size_t... I>
+        void forEachArchetypeChunk(const std::vector<std::unique_ptr<Archetype>>& archetypes, Fn&& fn, std::index_sequence<I...>) {
+            const ComponentMask required = componentMask<Ts...>();
+            const ComponentId ids[] = { componentId<Ts>()..., 0 };
+            for (const auto& arch : archetypes) {
+                if ((arch->mask() & required) != required || arch->size() == 0) continue;
+                const std::size_t offsets[] = { arch->columnOffset(ids[I])..., 0 };
+                std::size_t chunks = arch->chunkCount();
+                for (std::size_t c = 0; c < chunks; ++c) {
+                    std::byte* base = arch->chunkData(c);
+                    if (c + 1 < chunks) prefetchChunk(arch->chunkData(c + 1));
+                    fn(arch->chunkSize(c), arch->entities(c), reinterpret_cast<Ts*>(base + offsets[I])...);
+                }
+            }
+        }
+
+    } // namespace detail
+
+    template <typename... Ts, typename Fn>
+    void World::eachChunk(Fn&& fn) {
+        detail::forEachArchetypeChunk<Ts...>(m_archetypes, fn, std::index_sequence_for<Ts...>{});
+    }
+
+    template <typename... Ts, typename Fn>
+    void World::each(Fn&& fn) {
+        eachChunk<Ts...>([&fn](std::size_t count, const Entity*, Ts*... columns) {
+            for (std::size_t i = 0; i < count; ++i) fn(columns[i]...);
+        });
+    }
+
+    template <typename... Ts, typename Fn>
+    void World::eachEntity(Fn&& fn) {
+        eachChunk<Ts...>([&fn](std::size_t count, const Entity* entities, Ts*... columns) {
+            for (std::size_t i = 0; i < count; ++i) fn(entities[i], columns[i]...);
+        });
+    }
+
+} // namespace engine::ecs
@@ -1,6 +1,7 @@
 // include/engine/math/Math.h
 #pragma once
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 
 namespace engine::math {
@@ -10,7 +11,13 @@ namespace engine::math {
         Vec3(float a = 0, float b = 0, float c = 0) : x(a), y(b), z(c) {}
     };
 
-    struct Mat4 {
+    struct Quat {
+        float x, y, z, w;
+        Quat(float a = 0, float b = 0, float c = 0, float d = 1) : x(a), y(b), z(c), w(d) {}
+    };
+
+    // 16-byte aligned so arrays of Mat4 can be fed straight to the SIMD batch kernels
+    struct alignas(16) Mat4 {
         float m[16];
         Mat4() { std::memset(m, 0, sizeof(m)); m[0] = m[5] = m[10] = m[15] = 1.0f; }
     };
@@ -22,6 +29,67 @@ namespace engine::math {
     Mat4 translate(const Mat4& m, const Vec3& v);
     Mat4 rotate(const Mat4& m, float angle, const Vec3& axis);
     Mat4 scale(const Mat4& m, const Vec3& v);
+    Quat quatFromAxisAngle(const Vec3& axis, float angle);
+    void composeTRS(float* out, const Vec3& t, const Quat& r, const Vec3& s);   // T * R * S
+    Vec3 lerp(const Vec3& a, const Vec3& b, float t);
+    Quat nlerp(const Quat& a, const Quat& b, float t);   // shortest arc, renormalized
+
+    // Matrices are column-major (GL layout). mul() multiplies the arrays as if
+    // they were row-major, so mul(out, a, b) composes "apply a, then b":
+    // mul(mvp, model, viewProj) yields proj * view * model.
+    void transpose(float* out, const float* m);
+    bool inverse(float* out, const float* m);   // false (out untouched) if singular
+    Vec3 transformPoint(const float* m, const Vec3& p);   // m * (p, 1), no divide
+
+    // Batch entry points. Mat4 is 16-byte aligned, so plain Mat4 arrays qualify.
+    void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count);
+    void mulBatch(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count);   // same b for every a
+    void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count);
+
+    // === CULLING ===
+    struct Aabb {
+        Vec3 min, max;
+    };
+
+    // Six planes (a, b, c, d) with inward normals: a point is inside a plane
+    // when a*x + b*y + c*z + d >= 0. Order: left, right, bottom, top, near, far.
+    struct Frustum {
+        float planes[6][4];
+    };
+
+    // Gribb-Hartmann: the planes of a GL clip-space viewProj, normalized
+    Frustum extractFrustum(const Mat4& viewProj);
+
+    // Tests kFrustumLanes boxes stored SoA - minX[8] minY[8] minZ[8] maxX[8]
+    // maxY[8] maxZ[8], 32-byte aligned - and returns a mask with bit i set
+    // unless box i lies wholly outside one plane. Conservative: a box near a
+    // frustum corner can pass without touching the frustum.
+    constexpr std::size_t kFrustumLanes = 8;
+    unsigned frustumTest8(const Frustum& frustum, const float* boxes);
+
+    // Runtime CPU dispatch. The best supported level is picked on first use;
+    // ENGINE_SIMD=scalar|sse2|avx2|neon in the environment overrides it.
+    enum class SimdLevel { Scalar, SSE2, AVX2, NEON };
+
+    SimdLevel simdLevel();
+    bool setSimdLevel(SimdLevel level);   // false if the CPU/build lacks it
+    bool simdLevelSupported(SimdLevel level);
+    const char* simdLevelName(SimdLevel level);
+
+    // Runs every SIMD kernel against the scalar reference on generated input
+    bool verifySimdKernels();
+
+    // Scalar reference kernels - always available, never dispatched
+    namespace scalar {
+        void mul(float* out, const float* a, const float* b);
+        void transpose(float* out, const float* m);
+        bool inverse(float* out, const float* m);
+        Vec3 transformPoint(const float* m, const Vec3& p);
+        void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count);
+        void mulBatch(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count);
+        void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count);
+        unsigned frustumTest8(const Frustum& frustum, const float* boxes);
+    }
 
     // Helper: convert Mat4 to float*
     inline const float* value_ptr(const Mat4& mat) { return mat.m; }
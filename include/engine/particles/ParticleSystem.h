@@ -0,0 +1,107 @@
+// include/engine/particles/ParticleSystem.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/math/Math.h"
+
+namespace engine {
+
+    class JobSystem;
+
+    // One particle as the renderer reads it: 16 bytes, a per-instance vec4.
+    // The x86 kernels write it with aligned streaming stores, so any array of
+    // instances must be 16-byte aligned; alignas makes that hold by construction.
+    struct alignas(16) ParticleInstance {
+        float x, y, z;
+        float life;   // remaining fraction of its lifetime, 1 at birth down to 0
+    };
+    static_assert(sizeof(ParticleInstance) == 16, "ParticleInstance is read as one vec4 attribute");
+    static_assert(alignof(ParticleInstance) == 16, "streaming stores need 16-byte aligned instances");
+
+    struct ParticleEmitter {
+        math::Vec3 position;
+        math::Vec3 velocity;           // mean launch velocity
+        float positionJitter = 0.0f;   // half-extent of the spawn box around position
+        float velocityJitter = 0.0f;   // added per axis, uniform in [-jitter, jitter]
+        float rate = 0.0f;             // particles per second
+        float lifeMin = 1.0f;          // seconds
+        float lifeMax = 2.0f;
+    };
+
+    // Fixed-capacity particle pool, stored SoA in chunks of kChunkSize. Each
+    // chunk keeps its live particles packed at its front, so one job owns one
+    // chunk: it emits into the chunk's free tail, integrates, kills the
+    // expired, compacts the survivors in place and streams them out - all
+    // SIMD at the active math::simdLevel(). Nothing is allocated after create().
+    //
+    // Output goes to a ParticleInstance array of capacity() entries (a
+    // mapped vertex buffer); chunk c's survivors start at c * kChunkSize,
+    // so a draw per chunk takes chunkCount(c) instances from there.
+    class ParticleSystem {
+    public:
+        static constexpr std::size_t kChunkSize = 8192;
+        static constexpr std::size_t kMaxEmitters = 16;
+
+        struct Stats {
+            std::size_t alive = 0;
+            std::size_t emitted = 0;   // by the last update()
+            std::size_t killed = 0;
+            std::uint64_t dropped = 0; // emissions that found the pool full, since create()
+        };
+
+        ParticleSystem() = default;
+        ~ParticleSystem();
+        ParticleSystem(const ParticleSystem&) = delete;
+        ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+        // Capacity rounds up to whole chunks
+        bool create(std::size_t capacity);
+        void destroy();
+
+        // False when kMaxEmitters are in use
+        bool addEmitter(const ParticleEmitter& emitter, std::uint32_t* id = nullptr);
+        ParticleEmitter& emitter(std::uint32_t id) { return m_emitters[id]; }
+
+        void setGravity(const math::Vec3& gravity) { m_gravity = gravity; }
+        void setDrag(float perSecond) { m_drag = perSecond; }   // fraction of velocity lost per second
+
+        // One step: emit, integrate, kill, compact and stream into out
+        // (nullptr: simulate only). Chunks are spread over jobs when given.
+        void update(float dt, JobSystem* jobs, ParticleInstance* out);
+
+        std::size_t capacity() const { return m_capacity; }
+        std::size_t chunkCount() const { return m_counts.size(); }
+        // Live particles per chunk, i.e. instances written at c * kChunkSize
+        const std::uint32_t* chunkCounts() const { return m_counts.data(); }
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        struct EmitSpan {
+            std::uint32_t chunk;
+            std::uint32_t first;   // index within the chunk
+            std::uint32_t count;
+            std::uint32_t emitter;
+        };
+
+        void planEmission(float dt);
+
+        // === POOL (SoA) ===
+        float* m_pool = nullptr;   // kStreams arrays of m_capacity floats, one allocation
+        std::size_t m_capacity = 0;
+        std::vector<std::uint32_t> m_counts;   // live particles per chunk
+
+        // === EMISSION ===
+        ParticleEmitter m_emitters[kMaxEmitters];
+        float m_emitDebt[kMaxEmitters] = {};   // fractional particles carried to the next update
+        std::size_t m_emitterCount = 0;
+        std::vector<EmitSpan> m_spans;         // this update's emissions; reserved once
+        std::size_t m_emitCursor = 0;          // chunk the next emission starts looking at
+        std::uint32_t m_seed = 0x9E3779B9u;
+
+        math::Vec3 m_gravity{ 0.0f, -9.81f, 0.0f };
+        float m_drag = 0.1f;
+        Stats m_stats;
+    };
+
+} // namespace engine
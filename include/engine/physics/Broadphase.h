@@ -0,0 +1,137 @@
+// include/engine/physics/Broadphase.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/math/Math.h"
+
+namespace engine {
+
+    class JobSystem;
+
+    // Two bodies whose boxes overlap (touching counts), a < b. Bodies are
+    // indices into the bounds array given to update().
+    struct BodyPair {
+        std::uint32_t a, b;
+        bool operator==(const BodyPair& other) const { return a == other.a && b == other.b; }
+    };
+
+    // Both broadphases below take the same input and produce the same pairs;
+    // which is faster depends on the scene. Sweep-and-prune is cheapest when
+    // bodies move little between updates and spread out along one axis; the
+    // hash grid does not care about motion or layout, but wants bodies of
+    // roughly similar size.
+    //
+    // Pair generation is split into fixed slices of the work, each slice
+    // writes its own list and the lists are joined in slice order, so the
+    // result depends only on the input - never on thread count or timing.
+    // Growing an output past its high-water mark is the only allocation.
+
+    // Sweep-and-prune along one axis. Bodies stay sorted by their minimum on
+    // that axis across updates, so a frame of coherent motion re-sorts with
+    // a few insertion-sort moves instead of a full sort. The sorted endpoints
+    // are kept SoA and padded, and each body scans its successors four at a
+    // time until one starts past its own maximum.
+    class SweepAndPrune {
+    public:
+        struct Stats {
+            std::size_t bodies = 0;
+            std::size_t pairs = 0;
+            std::size_t sortMoves = 0;      // insertion-sort moves in the last update
+            std::uint32_t fullSorts = 0;    // since creation: body count changed or too much moved
+            int axis = 0;                   // 0 = x, 1 = y, 2 = z
+        };
+
+        // Overlapping pairs in sweep order: by the first body's position
+        // along the axis, then the second's
+        void update(const math::Aabb* bounds, std::size_t count, JobSystem* jobs);
+
+        const std::vector<BodyPair>& pairs() const { return m_pairs; }
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        static constexpr std::size_t kPadding = 4;   // +inf sentinels past the last body, one SIMD width
+        static constexpr std::size_t kSliceBodies = 1024;
+
+        void fullSort(const math::Aabb* bounds, std::size_t count);
+        bool insertionSort(std::size_t moveLimit);   // false once the limit is hit
+        void scanSlice(std::size_t slice, std::vector<BodyPair>& out) const;
+
+        std::vector<std::uint32_t> m_order;   // body per sorted position
+        std::vector<float> m_keys;            // sweep-axis minimum per sorted position
+        // Endpoints per sorted position: the sweep axis, then the other two
+        std::vector<float> m_sweepMax;
+        std::vector<float> m_min[2];
+        std::vector<float> m_max[2];
+        int m_axes[3] = { 0, 1, 2 };          // sweep axis first
+
+        std::vector<std::vector<BodyPair>> m_slicePairs;
+        std::vector<std::size_t> m_sliceOffsets;
+        std::vector<BodyPair> m_pairs;
+        Stats m_stats;
+    };
+
+    // Uniform grid hashed into a bucket table rebuilt every update. Each body
+    // goes into every cell its box touches; a pair is reported only by the
+    // cell holding the low corner of the two boxes' intersection, so bodies
+    // sharing several cells are still reported once. Bodies spanning more than
+    // kMaxCellsPerBody cells skip the grid and are tested against everything.
+    class SpatialHashGrid {
+    public:
+        static constexpr std::size_t kMaxCellsPerBody = 64;
+
+        struct Stats {
+            std::size_t bodies = 0;
+            std::size_t pairs = 0;
+            std::size_t entries = 0;        // body-in-cell records
+            std::size_t buckets = 0;
+            std::size_t largeBodies = 0;    // over kMaxCellsPerBody, tested against every body
+            float cellSize = 0.0f;
+        };
+
+        // 0 (the default) sizes cells at twice the mean body extent each update
+        void setCellSize(float size) { m_fixedCellSize = size; }
+
+        // Overlapping pairs grouped by bucket, then by body
+        void update(const math::Aabb* bounds, std::size_t count, JobSystem* jobs);
+
+        const std::vector<BodyPair>& pairs() const { return m_pairs; }
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        static constexpr std::size_t kSliceBodies = 4096;
+        static constexpr std::size_t kSliceBuckets = 4096;
+
+        // The box rides along so the bucket scan never gathers from bounds
+        struct Entry {
+            std::uint64_t cell;     // packed cell coordinates
+            std::uint32_t body;
+            math::Aabb box;
+        };
+
+        struct CellRange {
+            std::int32_t lo[3], hi[3];
+        };
+
+        CellRange cellRange(const math::Aabb& box) const;
+        void scanBuckets(std::size_t slice, std::vector<BodyPair>& out) const;
+        void scanLarge(std::size_t large, const math::Aabb* bounds, std::size_t count, std::vector<BodyPair>& out) const;
+
+        float m_fixedCellSize = 0.0f;
+        float m_invCellSize = 1.0f;
+        int m_bucketBits = 0;
+
+        std::vector<std::uint32_t> m_entryStart;   // per body, plus the end; large bodies have none
+        std::vector<Entry> m_entries;              // by body, then cell
+        std::vector<std::uint32_t> m_bucketStart;  // per bucket, plus the end
+        std::vector<Entry> m_bucketed;             // m_entries grouped by bucket, body order kept
+        std::vector<std::uint32_t> m_large;        // bodies over kMaxCellsPerBody, ascending
+        std::vector<double> m_sliceExtent;         // per body slice, summed in slice order
+
+        std::vector<std::vector<BodyPair>> m_slicePairs;
+        std::vector<std::size_t> m_sliceOffsets;
+        std::vector<BodyPair> m_pairs;
+        Stats m_stats;
+    };
+
+} // namespace engine
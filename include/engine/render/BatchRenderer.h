@@ -0,0 +1,92 @@
+// include/engine/render/BatchRenderer.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/math/Math.h"
+#include "engine/render/PersistentBuffer.h"
+#include "engine/render/RenderQueue.h"
+
+namespace engine {
+
+    // Draws any number of mesh instances with one glMultiDrawElementsIndirect
+    // per render-queue batch. All meshes share one vertex and one index
+    // buffer; per-instance MVPs go into a triple-buffered persistently mapped
+    // vertex buffer read as a per-instance mat4 attribute (location 2..5), so
+    // baseInstance in each indirect command selects that run of matrices.
+    class BatchRenderer {
+    public:
+        struct Vertex {
+            float position[3];
+            float color[3];
+        };
+
+        struct Stats {
+            std::size_t instances = 0;
+            std::size_t commands = 0;     // indirect commands (one per run of equal mesh in a batch)
+            std::size_t drawCalls = 0;    // GL draw calls issued - one per non-empty batch
+            std::uint64_t fenceStalls = 0;
+        };
+
+        BatchRenderer() = default;
+        ~BatchRenderer();
+
+        BatchRenderer(const BatchRenderer&) = delete;
+        BatchRenderer& operator=(const BatchRenderer&) = delete;
+
+        bool initialize(std::size_t initialInstances = 4096);
+        void shutdown();
+
+        // Returns the mesh id stored in Renderable::mesh; uploads immediately
+        std::uint32_t addMesh(const Vertex* vertices, std::size_t vertexCount, const std::uint32_t* indices, std::size_t indexCount);
+        // An id with no geometry yet (draws nothing) - for meshes still streaming in
+        std::uint32_t reserveMesh();
+        // Fills a reserved mesh by GPU-side copy out of source: vertexCount
+        // Vertex structs at vertexOffset, indexCount uint32 indices at indexOffset
+        bool setMeshFromBuffer(std::uint32_t mesh, unsigned int source, std::size_t vertexOffset, std::size_t vertexCount, std::size_t indexOffset, std::size_t indexCount);
+        std::size_t meshCount() const { return m_meshes.size(); }
+
+        // Sorted packets from a RenderQueue: writes every instance and
+        // indirect command for the frame in one pass (adjacent packets with
+        // the same mesh share a command), then drawBatch(b) issues batch b's
+        // multi-draw once the caller has set its state. Packets with unknown
+        // or not yet streamed meshes are skipped. False = nothing to draw.
+        bool beginPackets(const math::Mat4* mvps, const DrawPacket* packets, std::size_t count, const DrawBatch* batches, std::size_t batchCount);
+        void drawBatch(std::size_t batch);
+        void endPackets();
+
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        struct MeshRange {
+            std::uint32_t firstIndex;
+            std::uint32_t indexCount;
+            std::int32_t baseVertex;
+        };
+
+        bool reserveGeometry(std::size_t vertexCount, std::size_t indexCount);
+        bool reserveInstances(std::size_t count);
+        bool reserveCommands(std::size_t count);
+
+        // === GEOMETRY ===
+        // Append-only GPU arenas shared by every mesh; growing one is a
+        // GPU-side copy into a bigger buffer, nothing is kept on the CPU
+        std::vector<MeshRange> m_meshes;
+        unsigned int m_vao = 0;
+        unsigned int m_vertexBuffer = 0;
+        unsigned int m_indexBuffer = 0;
+        std::size_t m_vertexCapacity = 0;   // in vertices
+        std::size_t m_vertexCount = 0;
+        std::size_t m_indexCapacity = 0;    // in indices
+        std::size_t m_indexCount = 0;
+
+        // === PER FRAME ===
+        PersistentBuffer m_instances;
+        PersistentBuffer m_commands;
+        std::size_t m_instanceCapacity = 0;
+        std::size_t m_commandCapacity = 0;
+        std::vector<std::uint32_t> m_batchCommands;   // first command of each batch, plus the end
+        Stats m_stats;
+    };
+
+} // namespace engine
@@ -0,0 +1,87 @@
+// include/engine/render/Bvh.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/math/Math.h"
+
+namespace engine {
+
+    // Eight-wide bounding volume hierarchy over object AABBs, used for frustum
+    // culling. Each node keeps its children's boxes side by side in SoA form,
+    // so one math::frustumTest8 call classifies all eight at once and a whole
+    // subtree outside the frustum costs a single test.
+    //
+    // Objects are identified by index into the bounds array given to update().
+    // Moved objects are refit in place (only the nodes above them are touched);
+    // the tree is rebuilt when the object count changes or refitting has let
+    // the boxes grow loose.
+    class Bvh {
+    public:
+        static constexpr std::size_t kWidth = math::kFrustumLanes;
+
+        struct Stats {
+            std::uint32_t builds = 0;
+            std::uint64_t refitNodes = 0;     // nodes recomputed by refits, all time
+            std::size_t nodesTested = 0;      // frustum tests issued by the last cull()
+        };
+
+        // Rebuilds on a count change, otherwise refits the objects whose bounds differ
+        void update(const math::Aabb* bounds, std::size_t count);
+        void build(const math::Aabb* bounds, std::size_t count);
+
+        // Appends the index of every object whose box intersects the frustum
+        void cull(const math::Frustum& frustum, std::vector<std::uint32_t>& visible);
+
+        std::size_t objectCount() const { return m_objects.size(); }
+        std::size_t nodeCount() const { return m_nodes.size(); }
+        const Stats& stats() const { return m_stats; }
+
+        // Refit is abandoned for a rebuild once the summed node surface area
+        // exceeds the freshly built tree's by this factor
+        static constexpr double kRebuildRatio = 1.5;
+
+    private:
+        static constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+
+        // Children are laid out after their parent, so walking the array
+        // backwards visits every child before the node that contains it
+        struct alignas(32) Node {
+            float bounds[6][kWidth];      // minX minY minZ maxX maxY maxZ, one lane per child
+            std::int32_t child[kWidth];   // >= 0 node index, < 0 is ~object index
+            std::uint32_t parent;
+            std::uint32_t parentLane;
+            std::uint32_t count;          // lanes in use, packed from lane 0
+            bool dirty;
+        };
+
+        struct ObjectRef {
+            math::Aabb bounds;
+            std::uint32_t node;
+            std::uint32_t lane;
+        };
+
+        // Build scratch: partitioning these in place keeps the sort keys contiguous
+        struct BuildRef {
+            float centroid[3];            // min + max, the factor of 2 does not matter for ordering
+            std::uint32_t object;
+        };
+
+        math::Aabb buildNode(std::uint32_t parent, std::uint32_t parentLane, BuildRef* begin, BuildRef* end);
+        void setLane(Node& node, std::uint32_t lane, const math::Aabb& box);
+        math::Aabb nodeBounds(const Node& node) const;
+        void markDirty(std::uint32_t node);
+        void refit();
+
+        std::vector<Node> m_nodes;
+        std::vector<ObjectRef> m_objects;
+        std::vector<BuildRef> m_order;
+        std::vector<std::uint32_t> m_dirty;      // nodes waiting for refit()
+        std::vector<std::uint32_t> m_stack;      // cull() traversal
+        math::Aabb m_rootBounds;
+        double m_area = 0.0;                     // summed surface area of every node's box
+        double m_builtArea = 0.0;                // m_area right after the last build
+        Stats m_stats;
+    };
+
+} // namespace engine
@@ -0,0 +1,82 @@
+// include/engine/render/GLDevice.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Thin layer over the GL context's binding and fixed-function state. Every
+// setter compares against a shadow copy and only reaches the driver when the
+// value actually changes; the counters show how much that filtered out.
+//
+// GL thread only. Code that changes state behind the device's back (a
+// third-party library, a debug overlay) must call invalidate() afterwards.
+// Objects are created with direct state access, so nothing has to be bound
+// to be edited; deleting through the device also clears it from the shadow,
+// so a recycled GL name is never mistaken for the old binding.
+namespace engine::gldevice {
+
+    enum class CompareFunc : std::uint8_t { Never, Less, Equal, LessEqual, Greater, NotEqual, GreaterEqual, Always };
+    enum class BlendFactor : std::uint8_t { Zero, One, SrcAlpha, OneMinusSrcAlpha, SrcColor, OneMinusSrcColor, DstAlpha, OneMinusDstAlpha };
+    enum class CullMode : std::uint8_t { None, Back, Front };
+
+    // Defaults match a fresh GL context
+    struct DepthState {
+        bool test = false;
+        bool write = true;
+        CompareFunc func = CompareFunc::Less;
+    };
+
+    struct BlendState {
+        bool enabled = false;
+        BlendFactor src = BlendFactor::One;
+        BlendFactor dst = BlendFactor::Zero;
+    };
+
+    struct RasterState {
+        CullMode cull = CullMode::None;
+        bool frontFaceCCW = true;
+        bool scissor = false;
+        bool wireframe = false;
+    };
+
+    // Buffer targets with a single (non-indexed) binding point worth shadowing
+    enum class BufferTarget : std::uint8_t { DrawIndirect, PixelUnpack, CopyRead, CopyWrite, Count };
+    constexpr unsigned kMaxUniformBindings = 16;
+
+    struct Stats {
+        std::uint64_t issued = 0;     // calls that reached the driver
+        std::uint64_t filtered = 0;   // calls dropped because the state already matched
+    };
+
+    // Forgets everything, then forces the shadowed state to the defaults
+    // above so both sides agree. Once, right after the context is made current.
+    void reset();
+    // Marks every shadow entry unknown; the next set of each goes through
+    void invalidate();
+
+    // === BINDINGS ===
+    void useProgram(unsigned program);
+    void bindVertexArray(unsigned vao);
+    void bindBuffer(BufferTarget target, unsigned buffer);
+    void bindUniformBuffer(unsigned index, unsigned buffer, std::size_t offset, std::size_t bytes);
+
+    // === FIXED FUNCTION ===
+    void setDepth(const DepthState& state);
+    void setBlend(const BlendState& state);
+    void setRaster(const RasterState& state);
+    void setClearColor(float r, float g, float b, float a);
+
+    // === OBJECTS (DSA) ===
+    // Immutable storage; flags are GL_*_BIT storage flags
+    unsigned createBuffer(std::size_t bytes, const void* data, unsigned flags);
+    // Write-only, persistent, coherent mapping of a new buffer; nullptr (and
+    // buffer = 0) when mapping fails
+    void* createMappedBuffer(std::size_t bytes, unsigned& buffer);
+    unsigned createVertexArray();
+    // Each zeroes the name and clears any shadowed binding to it
+    void deleteBuffer(unsigned& buffer);
+    void deleteVertexArray(unsigned& vao);
+    void deleteProgram(unsigned& program);
+
+    const Stats& stats();
+
+} // namespace engine::gldevice
@@ -0,0 +1,102 @@
+// include/engine/render/GpuTimer.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "engine/core/Profiler.h"
+
+namespace engine {
+
+    // GPU time per render pass, from GL_TIMESTAMP queries issued around each
+    // pass. Queries are kept in a ring of kFrames frames and read back only
+    // once the GPU reports them available, so the CPU never waits on them;
+    // results arrive a few frames late. A frame still unfinished when its
+    // ring slot comes round again is dropped rather than waited for.
+    //
+    // Timestamps are shifted onto profiler::now()'s clock (recalibrated every
+    // kCalibrateFrames), so resolved passes go into the trace on a "GPU" row
+    // lined up with the CPU scopes that submitted them.
+    //
+    // Record/resolve calls belong to the GL thread; the readers at the bottom
+    // may be called from any thread.
+    class GpuTimer {
+    public:
+        static constexpr std::size_t kFrames = 5;          // ring depth: render-thread frames in flight plus slack
+        static constexpr std::size_t kMaxPasses = 16;      // per frame; extra passes go untimed
+        static constexpr std::uint64_t kCalibrateFrames = 240;
+
+        struct Pass {
+            const char* name = nullptr;   // string literal given to beginPass()
+            std::uint64_t begin = 0;      // profiler clock, nanoseconds
+            std::uint64_t end = 0;
+            double milliseconds() const { return (end - begin) / 1e6; }
+        };
+
+        struct Stats {
+            std::uint64_t resolved = 0;   // frames read back
+            std::uint64_t dropped = 0;    // frames whose ring slot was reused before the GPU finished them
+        };
+
+        GpuTimer() = default;
+        GpuTimer(const GpuTimer&) = delete;
+        GpuTimer& operator=(const GpuTimer&) = delete;
+
+        // False (and every call below a no-op) when the context has no timestamp counter
+        bool create();
+        void destroy();
+        bool enabled() const { return m_enabled; }
+
+        // === GL THREAD ===
+        // Reads back finished frames, then opens the next ring slot
+        void beginFrame();
+        void endFrame();
+        // Passes may nest; each is timed on its own
+        void beginPass(const char* name);
+        void endPass();
+
+        // === ANY THREAD ===
+        // Whole-frame GPU time (first to last query of a frame) over the last
+        // FrameTimeStats::kWindow resolved frames, in milliseconds
+        FrameTimeStats::Summary frameSummary() const;
+        // The same for one pass; all zero for a name never resolved. Meant
+        // for budgets: compare p95 against what the pass may cost.
+        FrameTimeStats::Summary passSummary(const char* name) const;
+        // Passes of the newest resolved frame; returns how many were written
+        std::size_t latestPasses(Pass* out, std::size_t capacity) const;
+        Stats stats() const;
+
+    private:
+        struct Slot {
+            unsigned queries[2 + 2 * kMaxPasses] = {};   // frame begin/end, then begin/end per pass
+            const char* names[kMaxPasses] = {};
+            std::size_t passes = 0;
+            bool pending = false;   // issued, not yet read back
+        };
+
+        struct PassHistory {
+            const char* name = nullptr;
+            FrameTimeStats times;
+        };
+
+        bool resolve(Slot& slot);   // false while the GPU is still behind
+        void calibrate();
+        std::uint64_t toProfilerClock(std::uint64_t gpuTime) const;
+
+        bool m_enabled = false;
+        Slot m_slots[kFrames];
+        std::size_t m_current = 0;
+        std::size_t m_oldest = 0;        // next slot to read back
+        std::size_t m_open[kMaxPasses];  // pass indices of unclosed beginPass() calls
+        std::size_t m_openCount = 0;
+        std::int64_t m_clockOffset = 0;  // profiler clock minus GPU clock
+        std::uint64_t m_frames = 0;
+
+        mutable std::mutex m_lock;       // guards everything below
+        FrameTimeStats m_frameTimes;
+        PassHistory m_history[kMaxPasses];
+        Pass m_latest[kMaxPasses];
+        std::size_t m_latestCount = 0;
+        Stats m_stats;
+    };
+
+} // namespace engine
@@ -0,0 +1,49 @@
+// include/engine/render/MeshFormat.h
+#pragma once
+#include <cstdint>
+
+namespace engine {
+
+    // On-disk layout of a converted mesh (.emesh), written by mesh_converter
+    // and read by MeshStreamer. Everything is already in the form the GPU
+    // wants: the vertex block is BatchRenderer::Vertex structs and the index
+    // block is uint32 triangles, so loading is two memcpys.
+    //
+    //   MeshFileHeader
+    //   MeshFileSubmesh[submeshCount]
+    //   vertices (vertexOffset, 16-byte aligned)
+    //   indices  (indexOffset, 16-byte aligned)
+    namespace meshfile {
+
+        constexpr std::uint32_t kMagic = 0x48534D45;   // "EMSH"
+        constexpr std::uint32_t kVersion = 1;
+        constexpr std::uint32_t kVertexStride = 24;    // sizeof(BatchRenderer::Vertex)
+        constexpr std::uint32_t kAlignment = 16;
+
+        struct Bounds {
+            float min[3];
+            float max[3];
+        };
+
+        struct Header {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t vertexStride;
+            std::uint32_t vertexCount;
+            std::uint32_t indexCount;
+            std::uint32_t submeshCount;
+            std::uint64_t vertexOffset;
+            std::uint64_t indexOffset;
+            Bounds bounds;                 // whole mesh, object space
+        };
+
+        // A run of indices sharing a material (an OBJ group / usemtl block)
+        struct Submesh {
+            std::uint32_t firstIndex;
+            std::uint32_t indexCount;
+            Bounds bounds;
+        };
+
+    } // namespace meshfile
+
+} // namespace engine
@@ -0,0 +1,118 @@
+// include/engine/render/MeshStreamer.h
+#pragma once
+#include "engine/render/MeshFormat.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+    class AssetArchive;
+    class BatchRenderer;
+
+    // Streams .emesh files into the BatchRenderer without blocking the frame.
+    // request() hands back a mesh id at once (it draws nothing until loaded).
+    // A loader thread reads the file and memcpys vertices and indices
+    // straight into a persistently mapped staging ring. pump(), on the GL
+    // thread, turns finished loads into GPU-side copies into the renderer's
+    // geometry arenas and fences the ring space so the loader can reuse it.
+    // The frame never waits; only the loader does, when the ring is full.
+    class MeshStreamer {
+    public:
+        struct Stats {
+            std::uint32_t loaded = 0;
+            std::uint32_t failed = 0;
+            std::uint64_t bytesUploaded = 0;
+            std::uint32_t ringFullWaits = 0;   // loader found no staging space and had to wait
+        };
+
+        struct MeshInfo {
+            meshfile::Bounds bounds;
+            std::vector<meshfile::Submesh> submeshes;
+        };
+
+        MeshStreamer() = default;
+        ~MeshStreamer();
+
+        MeshStreamer(const MeshStreamer&) = delete;
+        MeshStreamer& operator=(const MeshStreamer&) = delete;
+
+        // GL thread. With an open archive, names are looked up there first.
+        bool start(BatchRenderer& batch, AssetArchive* archive = nullptr, std::size_t ringBytes = 16u << 20);
+        void stop();
+
+        // GL thread; the returned id goes in Renderable::mesh right away
+        std::uint32_t request(const std::string& path);
+
+        // GL thread, once per frame. Uploads at most byteBudget bytes of
+        // finished loads (at least one mesh, so a huge one cannot starve).
+        void pump(std::size_t byteBudget = 8u << 20);
+
+        // Requests not yet uploaded (queued, loading or waiting for pump)
+        std::size_t inFlight() const { return m_inFlight; }
+        const MeshInfo* info(std::uint32_t mesh) const;
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        struct Request {
+            std::string path;
+            std::uint32_t mesh;
+        };
+
+        // A load sitting in the staging ring, waiting for pump()
+        struct Staged {
+            std::uint32_t mesh;
+            bool failed;               // rejected; pump() only counts it and frees its ring space
+            std::uint64_t ringEnd;     // monotonic ring position after this load
+            std::size_t vertexOffset;  // byte offsets inside the ring buffer
+            std::size_t vertexCount;
+            std::size_t indexOffset;
+            std::size_t indexCount;
+            MeshInfo info;
+        };
+
+        struct Retiring {
+            void* fence;               // GLsync
+            std::uint64_t ringEnd;
+        };
+
+        void loaderMain();
+        bool load(const Request& request);
+        bool allocate(std::size_t bytes, std::uint64_t& position);   // loader thread; false on quit
+        void retireFences();
+
+        BatchRenderer* m_batch = nullptr;
+        AssetArchive* m_archive = nullptr;
+        std::thread m_loader;
+        bool m_quit = false;   // guarded by m_lock
+
+        // === STAGING RING ===
+        // Positions only ever grow; position % m_ringBytes is the byte offset.
+        // The loader owns m_head, pump() advances m_tail as fences signal.
+        unsigned int m_ringBuffer = 0;
+        unsigned char* m_ringMapped = nullptr;
+        std::size_t m_ringBytes = 0;
+        std::uint64_t m_head = 0;
+        std::atomic<std::uint64_t> m_tail{ 0 };
+        std::deque<Retiring> m_retiring;
+
+        // === QUEUES ===
+        std::mutex m_lock;
+        std::condition_variable m_wake;   // new request, ring space freed, or quit
+        std::deque<Request> m_requests;
+        std::deque<Staged> m_staged;
+
+        std::size_t m_inFlight = 0;
+        std::unordered_map<std::uint32_t, MeshInfo> m_info;
+        Stats m_stats;
+        std::atomic<std::uint32_t> m_ringFullWaits{ 0 };
+    };
+
+} // namespace engine
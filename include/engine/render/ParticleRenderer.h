@@ -0,0 +1,72 @@
+// include/engine/render/ParticleRenderer.h
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "engine/particles/ParticleSystem.h"
+
+namespace engine {
+
+    class Shader;
+
+    // Draws a ParticleSystem's output as instanced camera-facing quads. The
+    // instances live in one persistently mapped buffer of kSections sections,
+    // each capacity ParticleInstances; ParticleSystem::update() streams
+    // straight into a section, and a draw reads it in place.
+    //
+    // Unlike PersistentBuffer, writer and reader are different threads: the
+    // main thread acquires a free section, the GL thread draws and fences it,
+    // and reclaim() frees it once the fence has passed. Nobody waits - with
+    // every section still in flight, acquire() fails and that frame simply
+    // has no new particles to show.
+    class ParticleRenderer {
+    public:
+        static constexpr int kSections = 5;   // three frames in the exchange + two the GPU may still read
+
+        struct Stats {
+            std::size_t instances = 0;    // last draw
+            std::size_t drawCalls = 0;    // one per non-empty chunk
+            std::uint64_t starved = 0;    // acquire() found no free section, since initialize()
+        };
+
+        ParticleRenderer() = default;
+        ~ParticleRenderer();
+
+        ParticleRenderer(const ParticleRenderer&) = delete;
+        ParticleRenderer& operator=(const ParticleRenderer&) = delete;
+
+        // GL thread; capacity is the ParticleSystem's
+        bool initialize(std::size_t capacity);
+        // GL thread; waits for the GPU to finish with every section
+        void shutdown();
+        bool valid() const { return m_buffer != 0; }
+
+        // === WRITER (any one thread) ===
+        // A free section for ParticleSystem::update() to write, or -1
+        int acquire();
+        ParticleInstance* section(int section) { return m_mapped + static_cast<std::size_t>(section) * m_capacity; }
+
+        // === GL THREAD ===
+        // Frees the sections whose draws the GPU has finished
+        void reclaim();
+        // Draws counts[c] instances from chunk c of the section with shader
+        // (bound here), then fences the section; it is free again once the
+        // fence passes. Blend and depth state are the caller's.
+        void draw(Shader& shader, int section, const std::uint32_t* counts, std::size_t chunkCount);
+        // Hands back a section that will not be drawn (no fence needed)
+        void release(int section);
+
+        const Stats& stats() const { return m_stats; }
+
+    private:
+        unsigned int m_buffer = 0;
+        unsigned int m_vao = 0;
+        ParticleInstance* m_mapped = nullptr;
+        std::size_t m_capacity = 0;   // instances per section
+
+        std::atomic<bool> m_free[kSections] = {};
+        void* m_fences[kSections] = {};   // GLsync; GL thread only
+        Stats m_stats;
+    };
+
+} // namespace engine
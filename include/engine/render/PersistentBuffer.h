@@ -0,0 +1,53 @@
+// include/engine/render/PersistentBuffer.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace engine {
+
+    // GL buffer split into kSections equal parts that stay mapped for the
+    // buffer's lifetime. Each frame the CPU writes one section while the GPU
+    // may still be reading the previous ones; a fence per section keeps the
+    // CPU from overwriting data the GPU has not consumed yet.
+    class PersistentBuffer {
+    public:
+        static constexpr unsigned kSections = 3;
+
+        PersistentBuffer() = default;
+        ~PersistentBuffer();
+
+        PersistentBuffer(const PersistentBuffer&) = delete;
+        PersistentBuffer& operator=(const PersistentBuffer&) = delete;
+
+        // sectionBytes is rounded up to `alignment` so every section start
+        // satisfies binding-offset rules (SSBO/UBO/vertex buffers)
+        bool create(std::size_t sectionBytes, std::size_t alignment = 256);
+        // Waits for all in-flight sections, then unmaps and deletes
+        void destroy();
+        bool valid() const { return m_buffer != 0; }
+
+        // Advances to the next section, waiting on its fence if the GPU still
+        // owns it, and returns the CPU pointer to write into
+        void* beginSection();
+        // Fences the current section; call after the draws that read it
+        void endSection();
+
+        unsigned int buffer() const { return m_buffer; }
+        std::size_t sectionBytes() const { return m_sectionBytes; }
+        std::size_t sectionOffset() const { return m_current * m_sectionBytes; }
+
+        // Times beginSection() found its section still in use by the GPU
+        std::uint64_t stallCount() const { return m_stalls; }
+
+    private:
+        void waitFence(unsigned section);
+
+        unsigned int m_buffer = 0;
+        unsigned char* m_mapped = nullptr;
+        std::size_t m_sectionBytes = 0;
+        unsigned m_current = kSections - 1;
+        void* m_fences[kSections] = {};   // GLsync, kept opaque to avoid GL headers here
+        std::uint64_t m_stalls = 0;
+    };
+
+} // namespace engine
@@ -0,0 +1,112 @@
+// include/engine/render/RenderQueue.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/core/JobSystem.h"
+#include "engine/math/Math.h"
+
+namespace engine {
+
+    class BatchRenderer;
+    class Shader;
+
+    enum class RenderPass : std::uint8_t { Opaque, Transparent };
+
+    // 64-bit draw sort key, most significant field first:
+    //   Opaque:       pass:4 | shader:8 | material:12 | mesh:16 | depth:24
+    //   Transparent:  pass:4 | ~depth:24 | shader:8 | material:12 | mesh:16
+    // Opaque draws group by state and go front to back inside a mesh run;
+    // transparent ones must blend back to front, so depth outranks state.
+    namespace sortkey {
+
+        constexpr unsigned kPassBits = 4, kShaderBits = 8, kMaterialBits = 12, kMeshBits = 16, kDepthBits = 24;
+        constexpr std::uint64_t kDepthMax = (std::uint64_t(1) << kDepthBits) - 1;
+
+        // View depth in [0, farPlane] -> kDepthBits of fixed point; out of range clamps
+        inline std::uint32_t quantizeDepth(float viewDepth, float farPlane) {
+            float t = viewDepth / farPlane;
+            if (!(t > 0.0f)) return 0;   // also catches NaN
+            if (t >= 1.0f) return static_cast<std::uint32_t>(kDepthMax);
+            return static_cast<std::uint32_t>(t * static_cast<float>(kDepthMax));
+        }
+
+        inline std::uint64_t make(RenderPass pass, std::uint32_t shader, std::uint32_t material, std::uint32_t mesh, std::uint32_t depth) {
+            std::uint64_t state = (std::uint64_t(shader & 0xFFu) << 28) | (std::uint64_t(material & 0xFFFu) << 16) | (mesh & 0xFFFFu);
+            std::uint64_t key = std::uint64_t(pass) << 60;
+            if (pass == RenderPass::Transparent) return key | ((kDepthMax - (depth & kDepthMax)) << 36) | state;
+            return key | (state << 24) | (depth & kDepthMax);
+        }
+
+        inline RenderPass pass(std::uint64_t key) { return static_cast<RenderPass>(key >> 60); }
+        inline std::uint64_t state(std::uint64_t key) {
+            return pass(key) == RenderPass::Transparent ? key & 0xFFFFFFFFFull : (key >> 24) & 0xFFFFFFFFFull;
+        }
+        inline std::uint32_t shader(std::uint64_t key) { return static_cast<std::uint32_t>(state(key) >> 28); }
+        inline std::uint32_t material(std::uint64_t key) { return static_cast<std::uint32_t>(state(key) >> 16) & 0xFFFu; }
+
+    } // namespace sortkey
+
+    // One draw of one instance: 16 bytes, sorted as a unit
+    struct DrawPacket {
+        std::uint64_t key;
+        std::uint32_t instance;   // index into the MVP array handed to execute()
+        std::uint32_t mesh;       // BatchRenderer mesh id
+    };
+
+    // Consecutive sorted packets sharing pass, shader and material: one
+    // multi-draw, with state set only where it differs from the batch before
+    struct DrawBatch {
+        std::uint32_t first;
+        std::uint32_t count;
+        RenderPass pass;
+        std::uint32_t shader;
+        std::uint32_t material;
+    };
+
+    // Draw packets are recorded in parallel by jobs (each job writes its
+    // own slice of one array, so there is nothing to merge), radix-sorted by
+    // key, and executed on the GL thread. Storage is reused between frames.
+    class RenderQueue {
+    public:
+        struct Stats {
+            std::size_t packets = 0;
+            std::size_t batches = 0;
+            std::size_t shaderBinds = 0;
+            std::size_t materialChanges = 0;
+            std::size_t sortPasses = 0;   // 8-bit radix passes that were not skipped
+        };
+
+        // fn(i) returns packet i; called for every i in [0, count) across the job system
+        template <typename Fn> void record(std::size_t count, JobSystem& jobs, Fn&& fn);
+
+        // Radix sort by key (stable, so equal keys keep record order), then split into batches
+        void sort();
+
+        // GL thread. shaders[id] is bound for batches keyed with that shader id;
+        // mvps are indexed by DrawPacket::instance.
+        void execute(BatchRenderer& batch, const math::Mat4* mvps, Shader* const* shaders, std::size_t shaderCount);
+
+        const std::vector<DrawPacket>& packets() const { return m_packets; }
+        const std::vector<DrawBatch>& batches() const { return m_batches; }
+        const Stats& stats() const { return m_stats; }
+
+        static constexpr std::size_t kRecordGrain = 1024;
+
+    private:
+        std::vector<DrawPacket> m_packets;
+        std::vector<DrawPacket> m_scratch;   // radix sort ping-pong
+        std::vector<DrawBatch> m_batches;
+        Stats m_stats;
+    };
+
+    template <typename Fn>
+    void RenderQueue::record(std::size_t count, JobSystem& jobs, Fn&& fn) {
+        m_packets.resize(count);
+        DrawPacket* out = m_packets.data();
+        jobs.parallelFor(count, kRecordGrain, [out, &fn](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) out[i] = fn(i);
+        });
+    }
+
+} // namespace engine
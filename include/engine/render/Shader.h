@@ -1,38 +1,96 @@
 #pragma once
+#include <chrono>
+#include <cstdint>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
+#include "engine/core/Memory.h"
 
 namespace engine {
 
+    class ShaderCache;
+
+    // Pre-resolved uniform: an index into the shader's uniform table, so
+    // setting it is one array read - no string build, no hashing. Stays
+    // valid across hot reloads (locations are re-resolved on relink).
+    struct UniformHandle {
+        int index = -1;
+        bool valid() const { return index >= 0; }
+    };
+
     class Shader {
     public:
         Shader() = default;
         ~Shader();
 
-        bool loadFromFile(const std::string& vertexPath, const std::string& fragmentPath);
+        // defines: "#define X 1" lines inserted after each stage's #version
+        bool loadFromFile(const std::string& vertexPath, const std::string& fragmentPath, const std::string& defines = "");
+        // Sources already in memory (e.g. AssetArchive views); such a shader has no files to hot-reload
+        bool loadFromSource(std::string_view vertexSource, std::string_view fragmentSource, const std::string& defines = "");
         void bind() const;
         void unbind() const;
 
-        void setMat4(const std::string& name, const float* value);
-        void setFloat(const std::string& name, float value);
+        // Resolve once (e.g. at load) and keep the handle for per-draw use.
+        // Setters write the program directly; it does not have to be bound.
+        UniformHandle uniform(std::string_view name);
+        void setMat4(UniformHandle handle, const float* value);
+        void setFloat(UniformHandle handle, float value);
+
+        // Convenience for one-off calls; resolves the name every time
+        void setMat4(std::string_view name, const float* value);
+        void setFloat(std::string_view name, float value);
 
-        bool needsReload();
-        void reloadIfNeeded();
+        // Hot reload: re-reads both files and issues the compile without waiting
+        // on it. pollReload() swaps the program in once it has linked; a failed
+        // build is reported and the old program keeps running.
+        bool dependsOn(const std::string& path) const { return path == m_vertexPath || path == m_fragmentPath; }
+        void beginReload();
+        bool pollReload();   // once per frame; true when a new program was swapped in
+
+        // Whole file as a string; empty (and an error printed) when it cannot be opened
+        static std::string readFile(const std::string& path);
+
+        // Program binary cache used by every Shader; nullptr = always compile
+        static void setProgramCache(ShaderCache* cache) { s_cache = cache; }
+        // Set when the context has GL_KHR_parallel_shader_compile; without it
+        // pollReload() blocks on the driver the frame after beginReload()
+        static void setParallelCompile(bool enabled) { s_parallelCompile = enabled; }
 
     private:
-        unsigned int compileShader(unsigned int type, const std::string& source);
+        struct PendingBuild {
+            unsigned int program = 0;
+            unsigned int vertex = 0;     // 0 when the program came from the cache
+            unsigned int fragment = 0;
+            std::uint64_t key = 0;
+            std::chrono::steady_clock::time_point start;
+        };
+
+        unsigned int compileShader(unsigned int type, std::string_view source);
+        bool buildNow(std::string_view vertexCode, std::string_view fragmentCode);
+        void startBuild(std::string_view vertexCode, std::string_view fragmentCode, PendingBuild& build);
+        bool buildReady(const PendingBuild& build) const;
+        unsigned int finishBuild(PendingBuild& build);   // 0 = failed, errors printed
+        void discardBuild(PendingBuild& build);
+        void adoptProgram(unsigned int program);
         bool checkCompileErrors(unsigned int shader, const std::string& type);
-        int getUniformLocation(const std::string& name);
+        int getUniformLocation(std::string_view name);
+        void resolveUniforms();
 
         unsigned int m_program = 0;
         std::string m_vertexPath;
         std::string m_fragmentPath;
-        std::unordered_map<std::string, int> m_uniformLocationCache;
+        std::string m_defines;
+        static inline ShaderCache* s_cache = nullptr;
+        static inline bool s_parallelCompile = false;
+        PendingBuild m_pending;
 
-        std::string readFile(const std::string& path);
-        long getFileTime(const std::string& path);
-        long m_vertexTime = 0;
-        long m_fragmentTime = 0;
+        // A handful of entries per program, so a linear name search beats
+        // hashing; the table is charged to the Shaders memory tag
+        struct UniformSlot {
+            std::pmr::string name;
+            int location;
+        };
+        std::pmr::vector<UniformSlot> m_uniforms{ memory::resource(memory::Tag::Shaders) };
     };
 
 }  // namespace engine
\ No newline at end of file
@@ -0,0 +1,48 @@
+// include/engine/render/ShaderCache.h
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace engine {
+
+    // On-disk cache of linked program binaries (glGetProgramBinary). Entries
+    // are keyed by a hash of both stage sources, the defines and the driver's
+    // vendor/renderer/version strings, so a driver update or an edited shader
+    // simply misses. A binary the driver rejects is deleted and the caller
+    // falls back to a normal compile.
+    class ShaderCache {
+    public:
+        struct Stats {
+            std::uint32_t hits = 0;
+            std::uint32_t misses = 0;
+            std::uint32_t rejected = 0;    // found on disk but refused by the driver
+            double loadMs = 0.0;           // time spent in glProgramBinary on hits
+            double savedMs = 0.0;          // recorded compile time of hits minus their load time
+        };
+
+        explicit ShaderCache(std::string directory = "shader_cache");
+
+        // False when the driver exposes no binary formats; every lookup then misses
+        bool enabled();
+
+        std::uint64_t key(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines);
+
+        // Loads the binary for key into program. False = compile from source.
+        bool load(std::uint64_t key, unsigned int program);
+        // Saves a freshly linked program (created with the retrievable hint)
+        void store(std::uint64_t key, unsigned int program, double compileMs);
+
+        const Stats& stats() const { return m_stats; }
+        void printStats() const;
+
+    private:
+        std::string pathFor(std::uint64_t key) const;
+
+        std::string m_directory;
+        std::string m_driver;   // vendor|renderer|version, part of every key
+        int m_enabled = -1;     // -1 = not queried yet
+        Stats m_stats;
+    };
+
+} // namespace engine
@@ -0,0 +1,82 @@
+// include/engine/render/TransformHierarchy.h
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/math/Math.h"
+
+namespace engine {
+
+    class JobSystem;
+
+    // Parent/child transforms. Nodes live in flat arrays in depth-first
+    // order - every parent before its children, every subtree contiguous -
+    // so update() is one linear pass: a node's world matrix is rebuilt only
+    // when its local TRS changed or its parent's world matrix was rebuilt
+    // earlier in the same pass. When nothing changed, update() does nothing.
+    //
+    // Node handles stay valid until destroyed; the depth-first index behind
+    // them moves when nodes are created or destroyed, which is a structural
+    // change and costs O(nodes). Setting locals is not.
+    class TransformHierarchy {
+    public:
+        using Node = std::uint32_t;
+        static constexpr Node kNoNode = 0xFFFFFFFFu;
+
+        struct Stats {
+            std::size_t recomputed = 0;   // world matrices rebuilt by the last update()
+        };
+
+        TransformHierarchy() = default;
+        TransformHierarchy(const TransformHierarchy&) = delete;
+        TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+
+        // New node as the last child of parent (kNoNode: a new root)
+        Node create(Node parent, const math::Vec3& position, const math::Quat& rotation, const math::Vec3& scale);
+        // Removes the node and its whole subtree
+        void destroy(Node node);
+
+        // Marks the node dirty only when the value actually differs. Safe to
+        // call from several threads at once as long as each touches its own nodes.
+        void setLocal(Node node, const math::Vec3& position, const math::Quat& rotation, const math::Vec3& scale);
+
+        // Rebuilds dirty world matrices, root subtrees split across the job system when one is given
+        void update(JobSystem* jobs = nullptr);
+
+        std::size_t size() const { return m_parent.size(); }
+        std::uint32_t indexOf(Node node) const { return m_indexOf[node]; }
+        const math::Mat4& world(Node node) const { return m_world[m_indexOf[node]]; }
+        // By depth-first index, see indexOf()
+        const math::Mat4* worldMatrices() const { return m_world.data(); }
+        const Stats& stats() const { return m_stats; }
+
+        // Nodes per job in update(); stretched to whole root subtrees
+        static constexpr std::size_t kChunkSize = 4096;
+
+    private:
+        void updateRange(std::size_t begin, std::size_t end);
+        std::size_t nextRoot(std::size_t index) const;   // first root at or after index
+        void renumber(std::size_t from);                 // m_indexOf for every index >= from
+
+        // === DEPTH-FIRST ARRAYS ===
+        std::vector<std::uint32_t> m_parent;        // depth-first index, kNoNode for roots
+        std::vector<std::uint32_t> m_subtreeSize;   // this node and all its descendants
+        std::vector<math::Vec3> m_position;
+        std::vector<math::Quat> m_rotation;
+        std::vector<math::Vec3> m_scale;
+        std::vector<math::Mat4> m_world;
+        std::vector<std::uint8_t> m_dirty;     // local TRS changed since the last update
+        std::vector<std::uint8_t> m_rebuilt;   // world rebuilt by the current/last update
+        std::vector<Node> m_nodeAt;            // handle of each depth-first index
+
+        // === HANDLES ===
+        std::vector<std::uint32_t> m_indexOf;  // depth-first index by handle
+        std::vector<Node> m_freeNodes;
+
+        std::atomic<bool> m_anyDirty{ false };
+        std::atomic<std::size_t> m_recomputed{ 0 };
+        Stats m_stats;
+    };
+
+} // namespace engine
@@ -0,0 +1,65 @@
+// include/engine/render/TransformPipeline.h
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "engine/math/Math.h"
+
+namespace engine {
+
+    class JobSystem;
+
+    // Structure-of-arrays transform stage. Positions, rotations and scales live
+    // in separate float streams; update() turns them into world and MVP
+    // matrices for every entity in parallel chunks. The MVP array is tightly
+    // packed column-major Mat4s, so it can be handed to glBufferData as-is.
+    class TransformPipeline {
+    public:
+        TransformPipeline() = default;
+
+        std::size_t add(const math::Vec3& position, const math::Quat& rotation, const math::Vec3& scale);
+        void reserve(std::size_t count);
+        void resize(std::size_t count);
+        void clear();
+        std::size_t size() const { return m_posX.size(); }
+
+        void setPosition(std::size_t index, const math::Vec3& position);
+        void setRotation(std::size_t index, const math::Quat& rotation);
+        void setScale(std::size_t index, const math::Vec3& scale);
+
+        // Computes world = T * R * S and mvp = viewProj * world for every entity,
+        // split into kChunkSize slices across the job system when one is given
+        void update(const math::Mat4& viewProj, JobSystem* jobs = nullptr);
+
+        // Same, for the listed slots only (e.g. what survived culling). The
+        // output is packed: world and MVP k belong to slots[k].
+        void update(const math::Mat4& viewProj, const std::uint32_t* slots, std::size_t count, JobSystem* jobs = nullptr);
+
+        // MVPs for world matrices built elsewhere (TransformHierarchy): world
+        // and MVP k come from worlds[indices[k]]. The TRS streams are not used.
+        void update(const math::Mat4& viewProj, const math::Mat4* worlds, const std::uint32_t* indices, std::size_t count,
+                    JobSystem* jobs = nullptr);
+
+        const math::Mat4* worldMatrices() const { return m_world.data(); }
+        const math::Mat4* mvpMatrices() const { return m_mvp.data(); }
+        std::size_t mvpBytes() const { return m_mvp.size() * sizeof(math::Mat4); }
+
+        // Entities per job; below this everything runs on the caller
+        static constexpr std::size_t kChunkSize = 4096;
+
+    private:
+        // Output k is computed from input slotOf(k)
+        template <typename SlotOf>
+        void updateRange(std::size_t begin, std::size_t end, const math::Mat4& viewProj, SlotOf slotOf);
+
+        // === SoA STREAMS ===
+        std::vector<float> m_posX, m_posY, m_posZ;
+        std::vector<float> m_rotX, m_rotY, m_rotZ, m_rotW;
+        std::vector<float> m_scaleX, m_scaleY, m_scaleZ;
+
+        // === OUTPUT ===
+        std::vector<math::Mat4> m_world;
+        std::vector<math::Mat4> m_mvp;
+    };
+
+} // namespace engine
@@ -0,0 +1,43 @@
+// include/engine/render/UniformBuffer.h
+#pragma once
+#include <cstddef>
+#include "engine/math/Math.h"
+#include "engine/render/PersistentBuffer.h"
+
+namespace engine {
+
+    // === FRAME DATA (std140) ===
+    // Mirrors the FrameData block in assets/shaders/*.glsl. Every Shader binds
+    // a block with this name to kFrameUniformBinding when it links, so one
+    // upload per frame reaches every program.
+    constexpr const char* kFrameUniformBlockName = "FrameData";
+    constexpr unsigned kFrameUniformBinding = 0;
+
+    struct alignas(16) FrameUniforms {
+        math::Mat4 view;
+        math::Mat4 proj;
+        math::Mat4 viewProj;
+        float cameraPos[4];   // xyz, w unused
+        float time;           // seconds
+        float pad[3];
+    };
+    static_assert(sizeof(FrameUniforms) == 3 * 64 + 16 + 16, "FrameUniforms must match the std140 FrameData layout");
+
+    // Triple-buffered uniform buffer bound to a fixed binding point. update()
+    // writes the next section and binds it; endFrame() fences it after the
+    // frame's draws have been issued.
+    class UniformBuffer {
+    public:
+        bool create(unsigned binding, std::size_t bytes);
+        void destroy() { m_buffer.destroy(); }
+
+        void update(const void* data, std::size_t bytes);
+        void endFrame() { m_buffer.endSection(); }
+
+    private:
+        PersistentBuffer m_buffer;
+        unsigned m_binding = 0;
+        std::size_t m_bytes = 0;
+    };
+
+} // namespace engine
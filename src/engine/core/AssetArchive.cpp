@@ -0,0 +1,269 @@
+// src/engine/core/AssetArchive.cpp
+#include "engine/core/AssetArchive.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#if ENGINE_HAS_LZ4
+#include <lz4.h>
+#include <lz4hc.h>
+#endif
+
+namespace engine {
+
+    namespace {
+
+        constexpr std::uint32_t kMagic = 0x4B415045;   // "EPAK"
+        constexpr std::uint32_t kVersion = 1;
+        constexpr std::uint64_t kEntryAlignment = 64;  // cache line; enough for any SIMD load
+        constexpr std::uint64_t kMaxLZ4Bytes = 0x7E000000;   // LZ4_MAX_INPUT_SIZE
+        constexpr std::uint64_t kMaxLZ4Ratio = 255;          // no LZ4 block expands further
+
+        enum Compression : std::uint32_t {
+            kStored = 0,
+            kLZ4 = 1,
+        };
+
+        struct FileHeader {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint32_t slotCount;    // power of two, at least twice the entry count
+            std::uint32_t entryCount;
+            std::uint64_t slotsOffset;
+            std::uint64_t namesOffset;
+            std::uint64_t namesSize;
+        };
+
+        // One hash table slot; nameLength == 0 marks an empty slot
+        struct Slot {
+            std::uint64_t hash;
+            std::uint64_t offset;       // from the start of the file, kEntryAlignment aligned
+            std::uint64_t size;         // bytes in the file
+            std::uint64_t rawSize;      // bytes after decompression
+            std::uint32_t nameOffset;   // into the names block
+            std::uint32_t nameLength;
+            std::uint32_t compression;
+            std::uint32_t reserved;
+        };
+        static_assert(sizeof(Slot) == 48, "Slot is part of the file format");
+
+        // FNV-1a, 64 bit
+        std::uint64_t hashName(std::string_view name) {
+            std::uint64_t hash = 0xCBF29CE484222325ull;
+            for (unsigned char c : name) {
+                hash ^= c;
+                hash *= 0x100000001B3ull;
+            }
+            return hash;
+        }
+
+        std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+    } // namespace
+
+    // === READING ===
+    bool AssetArchive::open(const std::string& path) {
+        close();
+        if (!m_file.open(path)) return false;
+
+        const char* base = m_file.data();
+        std::uint64_t fileSize = m_file.size();
+        FileHeader header;
+        bool valid = fileSize >= sizeof(header);
+        if (valid) std::memcpy(&header, base, sizeof(header));
+        valid = valid && header.magic == kMagic && header.version == kVersion
+            && header.slotCount && (header.slotCount & (header.slotCount - 1)) == 0
+            && header.slotsOffset % alignof(Slot) == 0
+            && header.slotsOffset <= fileSize
+            && std::uint64_t(header.slotCount) * sizeof(Slot) <= fileSize - header.slotsOffset
+            && header.namesOffset <= fileSize && header.namesSize <= fileSize - header.namesOffset;
+
+        // Bounds-check every entry once here so find() never has to. Probing
+        // stops at an empty slot, so the table must really be at most half full.
+        const Slot* slots = valid ? reinterpret_cast<const Slot*>(base + header.slotsOffset) : nullptr;
+        std::uint32_t occupied = 0;
+        for (std::uint32_t i = 0; valid && i < header.slotCount; ++i) {
+            const Slot& slot = slots[i];
+            if (!slot.nameLength) continue;
+            ++occupied;
+            valid = slot.offset <= fileSize && slot.size <= fileSize - slot.offset
+                && std::uint64_t(slot.nameOffset) + slot.nameLength <= header.namesSize;
+            if (slot.compression == kStored) valid = valid && slot.size == slot.rawSize;
+            else valid = valid && slot.compression == kLZ4 && slot.size <= kMaxLZ4Bytes
+                && slot.rawSize <= kMaxLZ4Bytes && slot.rawSize <= slot.size * kMaxLZ4Ratio;
+        }
+        valid = valid && occupied == header.entryCount && occupied <= header.slotCount / 2;
+
+        if (!valid) {
+            std::cerr << "Asset archive " << path << " is corrupt or from another version" << std::endl;
+            close();
+            return false;
+        }
+
+        m_slots = slots;
+        m_names = base + header.namesOffset;
+        m_slotMask = header.slotCount - 1;
+        m_entryCount = header.entryCount;
+        m_decoded.resize(header.slotCount);
+        return true;
+    }
+
+    void AssetArchive::close() {
+        m_file.close();
+        m_slots = nullptr;
+        m_names = nullptr;
+        m_slotMask = 0;
+        m_entryCount = 0;
+        m_decoded.clear();
+    }
+
+    bool AssetArchive::find(std::string_view name, std::string_view& out) {
+        if (!m_slots) return false;
+        const Slot* slots = static_cast<const Slot*>(m_slots);
+        std::uint64_t hash = hashName(name);
+
+        // Linear probing; the table is at most half full so an empty slot always ends the run
+        for (std::uint32_t i = static_cast<std::uint32_t>(hash) & m_slotMask;; i = (i + 1) & m_slotMask) {
+            const Slot& slot = slots[i];
+            if (!slot.nameLength) return false;
+            if (slot.hash != hash || std::string_view(m_names + slot.nameOffset, slot.nameLength) != name) continue;
+
+            if (slot.compression == kStored) {
+                out = std::string_view(m_file.data() + slot.offset, static_cast<std::size_t>(slot.size));
+                return true;
+            }
+            return decompress(i, out);
+        }
+    }
+
+    bool AssetArchive::decompress(std::uint32_t index, std::string_view& out) {
+        const Slot& slot = static_cast<const Slot*>(m_slots)[index];
+        std::lock_guard<std::mutex> lock(m_decodeLock);
+        if (!m_decoded[index]) {
+#if ENGINE_HAS_LZ4
+            std::unique_ptr<char[]> buffer(new char[slot.rawSize]);
+            int written = LZ4_decompress_safe(m_file.data() + slot.offset, buffer.get(), static_cast<int>(slot.size), static_cast<int>(slot.rawSize));
+            if (written < 0 || static_cast<std::uint64_t>(written) != slot.rawSize) {
+                std::cerr << "Asset archive: corrupt LZ4 entry " << std::string_view(m_names + slot.nameOffset, slot.nameLength) << std::endl;
+                return false;
+            }
+            m_decoded[index] = std::move(buffer);
+#else
+            std::cerr << "Asset archive: " << std::string_view(m_names + slot.nameOffset, slot.nameLength)
+                << " is LZ4 compressed but this build has no LZ4" << std::endl;
+            return false;
+#endif
+        }
+        out = std::string_view(m_decoded[index].get(), static_cast<std::size_t>(slot.rawSize));
+        return true;
+    }
+
+    // === WRITING ===
+    bool packAssetArchive(const std::string& outputPath, const std::vector<AssetArchiveInput>& inputs, bool compress) {
+#if !ENGINE_HAS_LZ4
+        if (compress) std::cerr << "Asset packer: built without LZ4, storing every entry raw" << std::endl;
+        compress = false;
+#endif
+        std::uint32_t slotCount = 8;
+        while (slotCount < inputs.size() * 2) slotCount *= 2;
+
+        std::vector<Slot> slots(slotCount, Slot{});
+        std::vector<std::uint32_t> slotOf(inputs.size());
+        std::string names;
+        std::vector<std::vector<char>> payloads(inputs.size());
+
+        for (std::size_t e = 0; e < inputs.size(); ++e) {
+            const AssetArchiveInput& input = inputs[e];
+            if (input.name.empty()) {
+                std::cerr << "Asset packer: entry with an empty name" << std::endl;
+                return false;
+            }
+
+            Slot entry{};
+            entry.hash = hashName(input.name);
+            entry.nameOffset = static_cast<std::uint32_t>(names.size());
+            entry.nameLength = static_cast<std::uint32_t>(input.name.size());
+            entry.rawSize = input.data.size();
+            entry.compression = kStored;
+
+#if ENGINE_HAS_LZ4
+            if (compress && !input.data.empty()) {
+                std::vector<char> packed(static_cast<std::size_t>(LZ4_compressBound(static_cast<int>(input.data.size()))));
+                int size = LZ4_compress_HC(input.data.data(), packed.data(), static_cast<int>(input.data.size()), static_cast<int>(packed.size()), LZ4HC_CLEVEL_DEFAULT);
+                if (size > 0 && static_cast<std::size_t>(size) <= input.data.size() - input.data.size() / 8) {
+                    packed.resize(static_cast<std::size_t>(size));
+                    payloads[e] = std::move(packed);
+                    entry.compression = kLZ4;
+                }
+            }
+#endif
+            if (entry.compression == kStored) payloads[e] = input.data;
+            entry.size = payloads[e].size();
+
+            std::uint32_t i = static_cast<std::uint32_t>(entry.hash) & (slotCount - 1);
+            for (; slots[i].nameLength; i = (i + 1) & (slotCount - 1)) {
+                if (slots[i].hash == entry.hash && names.compare(slots[i].nameOffset, slots[i].nameLength, input.name) == 0) {
+                    std::cerr << "Asset packer: duplicate entry " << input.name << std::endl;
+                    return false;
+                }
+            }
+            names += input.name;
+            slots[i] = entry;
+            slotOf[e] = i;
+        }
+
+        FileHeader header{};
+        header.magic = kMagic;
+        header.version = kVersion;
+        header.slotCount = slotCount;
+        header.entryCount = static_cast<std::uint32_t>(inputs.size());
+        header.slotsOffset = alignUp(sizeof(FileHeader), alignof(Slot));
+        header.namesOffset = header.slotsOffset + std::uint64_t(slotCount) * sizeof(Slot);
+        header.namesSize = names.size();
+
+        // Payloads follow the names in input order, each on an aligned offset
+        std::uint64_t cursor = header.namesOffset + header.namesSize;
+        for (std::size_t e = 0; e < inputs.size(); ++e) {
+            cursor = alignUp(cursor, kEntryAlignment);
+            slots[slotOf[e]].offset = cursor;
+            cursor += payloads[e].size();
+        }
+
+        // Write-then-rename so a running engine never maps a half-written archive
+        std::string temp = outputPath + ".tmp";
+        {
+            std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                std::cerr << "Asset packer: cannot write " << temp << std::endl;
+                return false;
+            }
+            const char zeros[kEntryAlignment] = {};
+            std::uint64_t written = 0;
+            auto put = [&](const void* data, std::uint64_t size) {
+                file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+                written += size;
+            };
+            auto padTo = [&](std::uint64_t offset) { put(zeros, offset - written); };
+
+            put(&header, sizeof(header));
+            padTo(header.slotsOffset);
+            put(slots.data(), slots.size() * sizeof(Slot));
+            put(names.data(), names.size());
+            for (std::size_t e = 0; e < inputs.size(); ++e) {
+                padTo(slots[slotOf[e]].offset);
+                put(payloads[e].data(), payloads[e].size());
+            }
+            if (!file) {
+                std::cerr << "Asset packer: write to " << temp << " failed" << std::endl;
+                return false;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temp, outputPath, error);
+        return !error;
+    }
+
+} // namespace engine
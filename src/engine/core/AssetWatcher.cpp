@@ -0,0 +1,141 @@
+// src/engine/core/AssetWatcher.cpp
+#include "engine/core/AssetWatcher.h"
+#include "engine/core/Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace engine {
+
+    AssetWatcher::~AssetWatcher() {
+        stop();
+    }
+
+    void AssetWatcher::watch(const std::string& path) {
+        std::filesystem::path absolute = std::filesystem::absolute(path).lexically_normal();
+        m_files.push_back({ path, absolute.parent_path().string(), absolute.filename().string() });
+    }
+
+    void AssetWatcher::notify(const std::string& path) {
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (std::find(m_changed.begin(), m_changed.end(), path) == m_changed.end()) m_changed.push_back(path);
+    }
+
+    void AssetWatcher::poll(std::vector<std::string>& out) {
+        std::lock_guard<std::mutex> lock(m_lock);
+        for (std::string& path : m_changed) out.push_back(std::move(path));
+        m_changed.clear();
+    }
+
+#if defined(__linux__)
+    // === INOTIFY ===
+    bool AssetWatcher::start() {
+        if (m_thread.joinable()) return true;
+
+        m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (m_inotify < 0 || m_wakeFd < 0) {
+            std::cerr << "AssetWatcher: inotify unavailable, hot reload disabled" << std::endl;
+            stop();
+            return false;
+        }
+
+        for (const WatchedFile& file : m_files) {
+            int wd = inotify_add_watch(m_inotify, file.directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+            if (wd < 0) {
+                std::cerr << "AssetWatcher: cannot watch " << file.directory << std::endl;
+                continue;
+            }
+            m_watchDirs[wd] = file.directory;
+        }
+
+        m_quit.store(false);
+        m_thread = std::thread([this] { threadMain(); });
+        return true;
+    }
+
+    void AssetWatcher::stop() {
+        if (m_thread.joinable()) {
+            m_quit.store(true);
+            std::uint64_t one = 1;
+            (void)!write(m_wakeFd, &one, sizeof(one));
+            m_thread.join();
+        }
+        if (m_inotify >= 0) close(m_inotify);
+        if (m_wakeFd >= 0) close(m_wakeFd);
+        m_inotify = m_wakeFd = -1;
+        m_watchDirs.clear();
+    }
+
+    void AssetWatcher::threadMain() {
+        profiler::setThreadName("AssetWatcher");
+        alignas(inotify_event) char buffer[4096];
+
+        while (!m_quit.load()) {
+            pollfd fds[2] = { { m_inotify, POLLIN, 0 }, { m_wakeFd, POLLIN, 0 } };
+            if (::poll(fds, 2, -1) <= 0 || m_quit.load()) continue;
+
+            ssize_t length;
+            while ((length = read(m_inotify, buffer, sizeof(buffer))) > 0) {
+                for (char* cursor = buffer; cursor < buffer + length;) {
+                    const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+                    cursor += sizeof(inotify_event) + event->len;
+                    if (!event->len) continue;
+
+                    auto dir = m_watchDirs.find(event->wd);
+                    if (dir == m_watchDirs.end()) continue;
+                    for (const WatchedFile& file : m_files)
+                        if (file.directory == dir->second && file.name == event->name) notify(file.path);
+                }
+            }
+        }
+    }
+#else
+    // === POLLING FALLBACK ===
+    bool AssetWatcher::start() {
+        if (m_thread.joinable()) return true;
+        m_quit.store(false);
+        m_thread = std::thread([this] { threadMain(); });
+        return true;
+    }
+
+    void AssetWatcher::stop() {
+        if (!m_thread.joinable()) return;
+        m_quit.store(true);
+        m_thread.join();
+    }
+
+    void AssetWatcher::threadMain() {
+        profiler::setThreadName("AssetWatcher");
+        using Time = std::filesystem::file_time_type;
+        auto stamp = [](const WatchedFile& file) {
+            std::error_code error;
+            Time time = std::filesystem::last_write_time(std::filesystem::path(file.directory) / file.name, error);
+            return error ? Time::min() : time;
+        };
+
+        std::vector<Time> times;
+        for (const WatchedFile& file : m_files) times.push_back(stamp(file));
+
+        while (!m_quit.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+            for (std::size_t i = 0; i < m_files.size(); ++i) {
+                Time time = stamp(m_files[i]);
+                if (time != times[i]) {
+                    times[i] = time;
+                    notify(m_files[i].path);
+                }
+            }
+        }
+    }
+#endif
+
+} // namespace engine
@@ -3,25 +3,115 @@
 #include <SDL.h>
 #include <glad/glad.h>
 #include "engine/math/Math.h"
+#include "engine/core/Components.h"
+#include "engine/core/Systems.h"
+#include "engine/core/Memory.h"
+#include "engine/core/Profiler.h"
+#include "engine/core/Platform.h"
+#include "engine/ecs/Snapshot.h"
+#include "engine/render/GLDevice.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <filesystem>
-#include <windows.h>
+#include <vector>
 
 namespace engine {
 
+    namespace {
+
+        bool hasGLExtension(const char* name) {
+            GLint count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+            for (GLint i = 0; i < count; ++i) {
+                const GLubyte* extension = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i));
+                if (extension && std::strcmp(reinterpret_cast<const char*>(extension), name) == 0) return true;
+            }
+            return false;
+        }
+
+        // Not in the generated loader; fetched by hand when the extension is present
+        typedef void (APIENTRYP MaxShaderCompilerThreadsProc)(GLuint count);
+
+        // Mesh 0: the spinning triangle every scene starts with
+        const BatchRenderer::Vertex kTriangle[] = {
+            { { -1.0f, -1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } },   // bottom left
+            { {  1.0f, -1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } },   // bottom right
+            { {  0.0f,  1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f } },   // top
+        };
+        const std::uint32_t kTriangleIndices[] = { 0, 1, 2 };
+
+        constexpr float kFarPlane = 100.0f;
+
+        // Render queue ids; the scene has one program and no materials yet
+        constexpr std::uint32_t kSceneShader = 0;
+        constexpr std::uint32_t kDefaultMaterial = 0;
+
+        // The scene is drawn in queue order with depth testing off
+        constexpr gldevice::DepthState kSceneDepth{ false, true, gldevice::CompareFunc::Less };
+        constexpr gldevice::BlendState kSceneBlend{};
+        // Particles glow: unsorted, so additive, which does not care about order
+        constexpr gldevice::BlendState kParticleBlend{ true, gldevice::BlendFactor::SrcAlpha, gldevice::BlendFactor::One };
+
+        // GPU timer pass names; budgets look them up by these
+        constexpr const char* kClearPass = "Clear";
+        constexpr const char* kScenePass = "Scene";
+        constexpr const char* kParticlePass = "Particles";
+
+        // Radius of the sphere around the object origin that contains the box,
+        // so the world bounds hold under any rotation
+        float radiusAboutOrigin(const float* min, const float* max) {
+            float sum = 0.0f;
+            for (int i = 0; i < 3; ++i) {
+                float extent = std::max(std::fabs(min[i]), std::fabs(max[i]));
+                sum += extent * extent;
+            }
+            return std::sqrt(sum);
+        }
+
+        float radiusAboutOrigin(const BatchRenderer::Vertex* vertices, std::size_t count) {
+            float radius = 0.0f;
+            for (std::size_t i = 0; i < count; ++i) radius = std::max(radius, radiusAboutOrigin(vertices[i].position, vertices[i].position));
+            return radius;
+        }
+
+    } // namespace
+
     Engine::Engine() = default;
 
     Engine::~Engine() {
         shutdown();
     }
 
-    bool Engine::initialize() {
+    bool Engine::initialize(const EngineConfig& config) {
+        m_config = config;
         std::cout << "GROK ENGINE STARTING...\n";
 
-        // GROK CWD FIX
-        char exePath[MAX_PATH];
-        if (GetModuleFileNameA(NULL, exePath, MAX_PATH) != 0) {
-            std::filesystem::path p = std::filesystem::path(exePath).parent_path();
+        // Over-budget tags warn once; the frame arenas are fixed, so theirs is exact
+        memory::setBudget(memory::Tag::Ecs, 256 * 1024 * 1024);
+        memory::setBudget(memory::Tag::Shaders, 1024 * 1024);
+        memory::setBudget(memory::Tag::Frame, 2 * kFrameArenaBytes);
+
+        // Paths on the command line are relative to where we were launched, not the asset root
+        for (std::string* path : { &m_config.recordInputPath, &m_config.replayInputPath, &m_config.recordStatePath, &m_config.replayStatePath })
+            if (!path->empty()) *path = std::filesystem::absolute(*path).string();
+        // Meshes that aren't files here are archive names or relative to the asset root
+        for (std::string& path : m_config.meshPaths)
+            if (std::filesystem::exists(path)) path = std::filesystem::absolute(path).string();
+
+        // ASSETS: assets.pak next to the executable is one open + mmap, no directory search
+        char* basePath = SDL_GetBasePath();
+        std::string exeDir = basePath ? basePath : "";
+        SDL_free(basePath);
+        if (!m_config.looseAssets && m_assets.open(exeDir + "assets.pak")) {
+            std::cout << "Assets: " << m_assets.entryCount() << " entries mapped from " << exeDir << "assets.pak\n";
+        }
+        // GROK CWD FIX - walk up from the executable's directory until assets/ shows up
+        else if (!exeDir.empty()) {
+            std::filesystem::path p = std::filesystem::path(exeDir).parent_path();
             for (int i = 0; i < 10; ++i) {
                 if (std::filesystem::exists(p / "assets" / "shaders" / "vertex.glsl")) {
                     std::filesystem::current_path(p);
@@ -32,11 +122,106 @@ namespace engine {
             }
         }
 
-        if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+        if (SDL_Init(m_config.hasGL() ? SDL_INIT_VIDEO : SDL_INIT_TIMER) != 0) {
             std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
             return false;
         }
 
+        // PARTICLES: the pool comes first so the renderer can size its buffer to it.
+        // A fountain below the triangle, emitting just enough to keep the pool full.
+        if (m_config.particles > 0) {
+            m_particles.create(m_config.particles);
+            ParticleEmitter fountain;
+            fountain.position = math::Vec3(0.0f, -1.5f, 0.0f);
+            fountain.velocity = math::Vec3(0.0f, 6.0f, 0.0f);
+            fountain.positionJitter = 0.1f;
+            fountain.velocityJitter = 1.5f;
+            fountain.lifeMin = 1.5f;
+            fountain.lifeMax = 2.5f;
+            fountain.rate = static_cast<float>(m_config.particles) / (0.5f * (fountain.lifeMin + fountain.lifeMax));
+            m_particles.addEmitter(fountain);
+        }
+
+        if (m_config.hasGL() && !initializeGL()) return false;
+
+        profiler::setThreadName("Main");
+        std::cout << "Job workers: " << m_jobs.workerCount() << std::endl;
+        std::cout << "Math kernels: " << math::simdLevelName(math::simdLevel()) << std::endl;
+#ifndef NDEBUG
+        if (!math::verifySimdKernels()) {
+            std::cerr << "WARNING: SIMD math kernels disagree with the scalar reference!\n";
+        }
+#endif
+
+        // SCENE: player camera + the spinning triangle (+ optional load for benchmarks)
+        m_camera = m_world.create(Position{ math::Vec3(0.0f, 0.0f, 5.0f) }, CameraLook{}, PlayerControlled{});
+        m_sim.previousCamera = { m_world.get<Position>(m_camera)->value, CameraLook{} };
+        m_triangle = spawnRenderable(math::Vec3(), Spin{}, 0);
+        if (m_sceneMeshes.empty()) m_sceneMeshes.push_back(0);   // headless: nothing streamed
+        m_meshRadius.assign(1, radiusAboutOrigin(kTriangle, 3));
+        for (std::size_t i = 1; i < m_sceneMeshes.size(); ++i)
+            spawnRenderable(math::Vec3(3.0f * static_cast<float>(i), 0.0f, 0.0f), Spin{}, m_sceneMeshes[i]);
+        for (std::uint32_t i = 0; i < m_config.extraEntities; ++i) {
+            Spin spin;
+            spin.axis = math::Vec3(0.0f, 1.0f, 0.0f);
+            spin.degreesPerSecond = 30.0f + (i % 7) * 20.0f;
+            math::Vec3 position((i % 100) * 2.5f - 125.0f, ((i / 100) % 100) * 2.5f - 125.0f, -10.0f - (i / 10000) * 2.5f);
+            spawnRenderable(position, spin, m_sceneMeshes[i % m_sceneMeshes.size()]);
+        }
+
+        // INPUT RECORD / REPLAY
+        if (!m_config.replayInputPath.empty()) {
+            if (!m_replay.open(m_config.replayInputPath)) return false;
+            std::cout << "Replaying " << m_replay.tickCount() << " input ticks from " << m_config.replayInputPath << std::endl;
+        }
+        if (!m_config.recordInputPath.empty() && !m_recorder.open(m_config.recordInputPath)) return false;
+
+        // STATE RECORD / REPLAY: the scene is complete, so the state layout is final
+        if (!m_config.replayStatePath.empty() || !m_config.recordStatePath.empty()) {
+            std::size_t bytes = stateBytes();
+            std::uint64_t layout = ecs::layoutHash(m_world);
+            m_stateBuffer.resize(bytes);
+            if (!m_config.replayStatePath.empty()) {
+                const std::string& path = m_config.replayStatePath;
+                if (!m_stateReplay.open(path, bytes, layout)) return false;
+                std::uint64_t seek = m_config.seekTick < 0 ? m_stateReplay.firstTick() : static_cast<std::uint64_t>(m_config.seekTick);
+                std::uint64_t start = profiler::now();
+                if (!m_stateReplay.seek(seek)) {
+                    std::cerr << "Tick " << seek << " is not in " << path << " (ticks " << m_stateReplay.firstTick()
+                        << " to " << m_stateReplay.lastTick() << ")" << std::endl;
+                    return false;
+                }
+                restoreState(m_stateReplay.state());
+                m_seekMs = (profiler::now() - start) / 1e6;
+                std::cout << "Resumed tick " << seek << " of " << path << " in " << m_seekMs << " ms ("
+                    << m_stateReplay.recordsApplied() << " records applied)" << std::endl;
+            }
+            if (!m_config.recordStatePath.empty()) {
+                if (!m_stateRecorder.open(m_config.recordStatePath, bytes, layout)) return false;
+                captureState(m_stateBuffer.data());
+                m_stateRecorder.write(m_sim.tick, InputState{}, m_stateBuffer.data());
+            }
+        }
+
+        // Nothing can close a headless run, so it always runs a fixed tick count
+        if (m_config.display == DisplayMode::Headless && m_config.ticks == 0) {
+            if (m_stateReplay.isOpen()) m_config.ticks = std::max<std::uint64_t>(m_stateReplay.lastTick() - m_sim.tick, 1);
+            else m_config.ticks = m_replay.isOpen() ? m_replay.tickCount() : kDefaultHeadlessTicks;
+        }
+
+        m_lastTime = SDL_GetPerformanceCounter() / (double)SDL_GetPerformanceFrequency();
+        m_running = true;
+        std::cout << "GROK ENGINE READY  TRIANGLE WILL SPIN!\n";
+        return true;
+    }
+
+    ecs::Entity Engine::spawnRenderable(const math::Vec3& position, const Spin& spin, std::uint32_t mesh, TransformHierarchy::Node parent) {
+        Scale scale;
+        SceneNode node{ m_scene.create(parent, position, math::Quat(), scale.value) };
+        return m_world.create(Position{ position }, Rotation{}, PreviousTransform{ position, math::Quat() }, scale, spin, node, Renderable{ mesh });
+    }
+
+    bool Engine::initializeGL() {
         // FORCE MODERN OPENGL + DEBUG + NO COMPATIBILITY CRAP
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 6);
@@ -49,7 +234,8 @@ namespace engine {
             "GROK ENGINE  SPINNING RAINBOW TRIANGLE",
             SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
             m_width, m_height,
-            SDL_WINDOW_OPENGL | SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE
+            SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE |
+            (m_config.display == DisplayMode::Offscreen ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN)
         );
 
         if (!m_window) {
@@ -58,6 +244,11 @@ namespace engine {
         }
 
         m_glContext = SDL_GL_CreateContext(m_window);
+        if (!m_glContext) {
+            // Software rasterizers (llvmpipe) and older drivers top out at 4.5
+            SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
+            m_glContext = SDL_GL_CreateContext(m_window);
+        }
         if (!m_glContext) {
             std::cerr << "SDL_GL_CreateContext Error: " << SDL_GetError() << std::endl;
             return false;
@@ -81,219 +272,553 @@ namespace engine {
         std::cout << "OpenGL Version: " << glGetString(GL_VERSION) << std::endl;
         std::cout << "GLSL Version: " << glGetString(GL_SHADING_LANGUAGE_VERSION) << std::endl;
 
-        glEnable(GL_DEPTH_TEST);
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);  // PURE BLACK
+        // All binding and fixed-function state goes through the device from here on
+        gldevice::reset();
+        gldevice::setClearColor(0.0f, 0.0f, 0.0f, 1.0f);  // PURE BLACK
+        m_pacer.configure(m_config.vsync, m_config.frameCap);
+
+        Shader::setProgramCache(&m_shaderCache);
+        // Let the driver compile on its own threads so hot reloads never wait on it
+        if (hasGLExtension("GL_KHR_parallel_shader_compile")) {
+            auto maxThreads = (MaxShaderCompilerThreadsProc)SDL_GL_GetProcAddress("glMaxShaderCompilerThreadsKHR");
+            if (maxThreads) {
+                maxThreads(0xFFFFFFFFu);   // implementation-chosen thread count
+                Shader::setParallelCompile(true);
+                std::cout << "Parallel shader compile: enabled\n";
+            }
+        }
 
         // LOAD SHADERS  WILL STOP IF FAIL
-        if (!m_shader.loadFromFile("assets/shaders/vertex.glsl", "assets/shaders/fragment.glsl")) {
+        bool shadersLoaded = loadShader(m_shader, "vertex.glsl", "fragment.glsl");
+        if (shadersLoaded && m_particles.capacity() > 0)
+            shadersLoaded = loadShader(m_particleShader, "particle_vertex.glsl", "particle_fragment.glsl");
+        if (!shadersLoaded) {
             std::cerr << "\nFATAL: SHADERS FAILED TO LOAD OR COMPILE!\n";
             std::cerr << "Check console above for GL errors.\n\n";
+#ifdef _WIN32
             system("pause");
+#endif
             return false;
         }
         std::cout << "SHADERS LOADED AND LINKED SUCCESSFULLY!\n";
+        m_shaderCache.printStats();
+
+        // Packed assets are immutable; only loose files hot-reload
+        if (!m_assets.isOpen()) {
+            m_assetWatcher.watch("assets/shaders/vertex.glsl");
+            m_assetWatcher.watch("assets/shaders/fragment.glsl");
+            if (m_particles.capacity() > 0) {
+                m_assetWatcher.watch("assets/shaders/particle_vertex.glsl");
+                m_assetWatcher.watch("assets/shaders/particle_fragment.glsl");
+            }
+            m_assetWatcher.start();
+        }
 
-        float vertices[] = {
-            -1.0f, -1.0f, 0.0f,  1.0f, 0.0f, 0.0f,  // bottom left  RED
-             1.0f, -1.0f, 0.0f,  1.0f, 0.0f, 0.0f,  // bottom right  RED
-             0.0f,  1.0f, 0.0f,  1.0f, 0.0f, 0.0f   // top  RED
-        };
-
-        glGenVertexArrays(1, &m_vao);
-        glGenBuffers(1, &m_vbo);
-        glBindVertexArray(m_vao);
-        glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(float), (void*)(3 * sizeof(float)));
-        glEnableVertexAttribArray(1);
-
-        glBindVertexArray(0);
+        // MESHES: every Renderable::mesh indexes into the batch renderer
+        if (!m_batch.initialize()) return false;
+        if (!m_frameBlock.create(kFrameUniformBinding, sizeof(FrameUniforms))) return false;
+        m_gpuTimer.create();   // optional: without a timestamp counter frames just go untimed
+        if (m_particles.capacity() > 0 && !m_particleRenderer.initialize(m_particles.capacity())) return false;
+        m_sceneMeshes.push_back(m_batch.addMesh(kTriangle, 3, kTriangleIndices, 3));
 
-        m_lastTime = SDL_GetPerformanceCounter() / (double)SDL_GetPerformanceFrequency();
-        m_running = true;
-        std::cout << "GROK ENGINE READY  TRIANGLE WILL SPIN!\n";
+        // Streamed meshes get their ids now and appear once the loader has them
+        if (!m_meshStreamer.start(m_batch, &m_assets)) return false;
+        for (const std::string& path : m_config.meshPaths) m_sceneMeshes.push_back(m_meshStreamer.request(path));
         return true;
     }
 
+    bool Engine::loadShader(Shader& shader, const char* vertexName, const char* fragmentName) {
+        std::string vertexPath = std::string("shaders/") + vertexName;
+        std::string fragmentPath = std::string("shaders/") + fragmentName;
+        if (m_assets.isOpen()) {
+            std::string_view vertexSource, fragmentSource;
+            return m_assets.find(vertexPath, vertexSource)
+                && m_assets.find(fragmentPath, fragmentSource)
+                && shader.loadFromSource(vertexSource, fragmentSource);
+        }
+        return shader.loadFromFile("assets/" + vertexPath, "assets/" + fragmentPath);
+    }
+
     void Engine::pollEvents() {
+        ENGINE_PROFILE_SCOPE("Engine::pollEvents");
+        // SDL stamps events in milliseconds on its own clock; shift them onto
+        // the profiler clock the ticks are cut on
+        std::uint64_t nowNs = profiler::now();
+        std::uint64_t nowMs = SDL_GetTicks();
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) m_running = false;
             if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) m_running = false;
+            if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_F9) {
+                memory::AllowHeap allow;
+                profiler::dumpChromeTrace("profile_trace.json");
+            }
+            std::uint64_t ageMs = nowMs > event.common.timestamp ? nowMs - event.common.timestamp : 0;
+            std::uint64_t ageNs = ageMs * 1000000ull;
+            m_playerController.handleEvent(event, nowNs > ageNs ? nowNs - ageNs : 0, m_input);
         }
     }
     
-    void Engine::update(float dt) {
-        const Uint8* keys = SDL_GetKeyboardState(nullptr);
-        float moveSpeed = 5.0f * dt;
-        float rotSpeed = 90.0f * dt;
-
-        // Toggle mouse capture with RIGHT CLICK
-        if (SDL_GetMouseState(nullptr, nullptr) & SDL_BUTTON(SDL_BUTTON_RIGHT)) {
-            if (!m_mouseCaptured) {
-                SDL_SetRelativeMouseMode(SDL_TRUE);
-                m_mouseCaptured = true;
-            }
-        }
-        else {
-            if (m_mouseCaptured) {
-                SDL_SetRelativeMouseMode(SDL_FALSE);
-                m_mouseCaptured = false;
+    void Engine::update(float dt, std::uint64_t tickEnd) {
+        ENGINE_PROFILE_SCOPE("Engine::update");
+        m_tickInput = nextInput(tickEnd);
+
+        // What this tick starts from is what render blends away from
+        snapshotSystem(m_world, m_jobs, &m_frameMemory.current());
+        m_sim.previousCamera = { m_world.get<Position>(m_camera)->value, *m_world.get<CameraLook>(m_camera) };
+        m_sim.time += dt;
+        ++m_sim.tick;
+
+        // Player input runs as its own job next to the chunked spin jobs
+        JobCounter player;
+        m_jobs.run([this, dt] { m_playerController.update(m_world, dt, m_tickInput); }, &player);
+        spinSystem(m_world, dt, m_jobs, &m_frameMemory.current());
+        m_jobs.wait(player);
+
+        if (m_stateRecorder.isOpen() || m_stateReplay.isOpen()) {
+            captureState(m_stateBuffer.data());
+            m_stateRecorder.write(m_sim.tick, m_tickInput, m_stateBuffer.data());
+            // One delta forward per tick. The accumulator and render alpha
+            // follow the wall clock, so only the simulated part is compared.
+            if (m_stateReplay.isOpen() && m_sim.tick <= m_stateReplay.lastTick() && m_stateReplay.seek(m_sim.tick)) {
+                const std::byte* recorded = m_stateReplay.state();
+                bool same = std::memcmp(m_stateBuffer.data(), recorded, kCheckedStateBytes) == 0
+                    && std::memcmp(m_stateBuffer.data() + sizeof(SimulationState), recorded + sizeof(SimulationState),
+                                   m_stateBuffer.size() - sizeof(SimulationState)) == 0;
+                ++m_replayChecked;
+                if (!same && m_replayDiverged++ == 0) m_firstDivergence = m_sim.tick;
             }
         }
+    }
 
-        // Mouse look
-        if (m_mouseCaptured) {
-            int dx, dy;
-            SDL_GetRelativeMouseState(&dx, &dy);
-            m_cameraYaw -= dx * 0.2f;
-            m_cameraPitch -= dy * 0.2f;
-            if (m_cameraPitch > 89.0f) m_cameraPitch = 89.0f;
-            if (m_cameraPitch < -89.0f) m_cameraPitch = -89.0f;
-        }
+    std::size_t Engine::stateBytes() const {
+        return sizeof(SimulationState) + ecs::columnBytes(m_world);
+    }
+
+    void Engine::captureState(std::byte* out) const {
+        std::memcpy(out, &m_sim, sizeof(SimulationState));
+        ecs::saveColumns(m_world, out + sizeof(SimulationState));
+    }
 
-        // WASD movement in camera direction
-        float forward[3] = { 0 };
-        float right[3] = { 0 };
-        forward[0] = sinf(m_cameraYaw * 3.14159f / 180.0f);
-        forward[2] = -cosf(m_cameraYaw * 3.14159f / 180.0f);
-        right[0] = cosf(m_cameraYaw * 3.14159f / 180.0f);
-        right[2] = sinf(m_cameraYaw * 3.14159f / 180.0f);
+    void Engine::restoreState(const std::byte* in) {
+        std::memcpy(&m_sim, in, sizeof(SimulationState));
+        ecs::loadColumns(m_world, in + sizeof(SimulationState));
+    }
+
+    InputState Engine::nextInput(std::uint64_t tickEnd) {
+        InputState input;
+        if (m_stateReplay.isOpen()) {
+            // Past the end of the recording: no input
+            if (m_sim.tick < m_stateReplay.lastTick()) input = m_stateReplay.input(m_sim.tick + 1);
+        }
+        else if (m_replay.isOpen()) m_replay.next(input);   // exhausted recording = no input
+        else if (m_window) input = m_input.nextTick(tickEnd);
+        if (m_recorder.isOpen()) m_recorder.write(input);
+        return input;
+    }
 
-        if (keys[SDL_SCANCODE_W]) {
-            m_cameraPos[0] += forward[0] * moveSpeed;
-            m_cameraPos[2] += forward[2] * moveSpeed;
+    void Engine::prepareFrame(RenderFrame& frame) {
+        // CAMERA
+        // The eye is blended between the last two ticks like every renderable.
+        // With live input the look is the latest tick's plus the mouse motion
+        // that arrived since; the simulation picks the same motion up next
+        // tick, so the view never steps back at a tick boundary. Replays and
+        // headless runs have no such motion and blend the look instead. A
+        // camera that is not turning reuses the basis cached on CameraLook.
+        CameraLook look = *m_world.get<CameraLook>(m_camera);
+        math::Vec3 eye = math::lerp(m_sim.previousCamera.position, m_world.get<Position>(m_camera)->value, m_sim.renderAlpha);
+        if (m_window && !m_replay.isOpen() && !m_stateReplay.isOpen()) {
+            std::int32_t dx = 0, dy = 0;
+            m_input.pendingMouse(dx, dy);
+            PlayerController::applyLook(look, dx, dy);
         }
-        if (keys[SDL_SCANCODE_S]) {
-            m_cameraPos[0] -= forward[0] * moveSpeed;
-            m_cameraPos[2] -= forward[2] * moveSpeed;
+        else {
+            const CameraLook& previousLook = m_sim.previousCamera.look;
+            if (look.yaw != previousLook.yaw || look.pitch != previousLook.pitch) {
+                look.yaw = previousLook.yaw + (look.yaw - previousLook.yaw) * m_sim.renderAlpha;
+                look.pitch = previousLook.pitch + (look.pitch - previousLook.pitch) * m_sim.renderAlpha;
+                PlayerController::updateLookBasis(look);
+            }
         }
-        if (keys[SDL_SCANCODE_A]) {
-            m_cameraPos[0] -= right[0] * moveSpeed;
-            m_cameraPos[2] -= right[2] * moveSpeed;
+        math::Vec3 target(eye.x + look.forward.x, eye.y + look.forward.y, eye.z + look.forward.z);
+
+        math::Mat4 proj = math::perspective(45.0f * 3.14159f / 180.0f, (float)m_width / m_height, 0.1f, kFarPlane);
+        math::Mat4 view = math::lookAt(eye, target, math::Vec3(0.0f, 1.0f, 0.0f));
+        math::Mat4 viewProj;
+        math::mul(viewProj.m, view.m, proj.m);   // view, then projection
+
+        frame.uniforms.view = view;
+        frame.uniforms.proj = proj;
+        frame.uniforms.viewProj = viewProj;
+        frame.uniforms.cameraPos[0] = eye.x;
+        frame.uniforms.cameraPos[1] = eye.y;
+        frame.uniforms.cameraPos[2] = eye.z;
+        frame.uniforms.cameraPos[3] = 1.0f;
+        // Simulation time at the blended instant, so shader animation moves in step with the world
+        frame.uniforms.time = static_cast<float>(m_sim.time - (1.0 - m_sim.renderAlpha) * m_fixedTimestep);
+
+        // Streamed meshes are bounded once loaded; until then they draw nothing anyway
+        if (m_loadedMeshPending.exchange(false, std::memory_order_acquire)) {
+            memory::AllowHeap allow;
+            std::lock_guard<std::mutex> lock(m_loadedMeshLock);
+            for (const auto& [mesh, radius] : m_loadedMeshRadius) {
+                if (mesh >= m_meshRadius.size()) m_meshRadius.resize(mesh + 1, 0.0f);
+                m_meshRadius[mesh] = radius;
+            }
+            m_loadedMeshRadius.clear();
         }
-        if (keys[SDL_SCANCODE_D]) {
-            m_cameraPos[0] += right[0] * moveSpeed;
-            m_cameraPos[2] += right[2] * moveSpeed;
+
+        // HIERARCHY: blended locals in, world matrices out - only for nodes that
+        // moved or sit under one that did; a still scene skips this entirely
+        sceneSyncSystem(m_world, m_scene, m_sim.renderAlpha, m_jobs, &m_frameMemory.current());
+        m_scene.update(&m_jobs);
+
+        // GATHER: mesh id, hierarchy index and world bounds of every renderable
+        renderPrepSystem(m_world, m_scene, m_drawMeshes, m_drawNodes, m_bounds, m_meshRadius, m_jobs, &m_frameMemory.current());
+
+        // BROADPHASE: overlapping pairs among the same boxes
+        if (m_config.broadphase == BroadphaseMode::SweepAndPrune) m_sweepAndPrune.update(m_bounds.data(), m_bounds.size(), &m_jobs);
+        else if (m_config.broadphase == BroadphaseMode::SpatialHash) m_spatialHash.update(m_bounds.data(), m_bounds.size(), &m_jobs);
+
+        // CULL: refit the BVH to moved bounds, then keep only what the frustum touches.
+        // Sized for everything visible up front so a wider view never reallocates.
+        m_bvh.update(m_bounds.data(), m_bounds.size());
+        m_visible.clear();
+        m_visible.reserve(m_bounds.size());
+        m_visibleMeshes.reserve(m_bounds.size());
+        m_visibleNodes.reserve(m_bounds.size());
+        m_bvh.cull(math::extractFrustum(viewProj), m_visible);
+        m_visibleMeshes.resize(m_visible.size());
+        m_visibleNodes.resize(m_visible.size());
+        for (std::size_t i = 0; i < m_visible.size(); ++i) {
+            m_visibleMeshes[i] = m_drawMeshes[m_visible[i]];
+            m_visibleNodes[i] = m_drawNodes[m_visible[i]];
         }
 
-        // Spin the triangle too (because it's beautiful)
-        m_rotation += 60.0f * dt;
+        // MVP FOR THE VISIBLE ONES ONLY, from the hierarchy's world matrices
+        frame.transforms.update(viewProj, m_scene.worldMatrices(), m_visibleNodes.data(), m_visibleNodes.size(), &m_jobs);
+
+        // DRAW PACKETS: recorded across the jobs, sorted here, executed by render().
+        // Clip w of the object origin is its view depth.
+        const math::Mat4* mvps = frame.transforms.mvpMatrices();
+        const std::uint32_t* meshes = m_visibleMeshes.data();
+        frame.queue.record(m_visible.size(), m_jobs, [mvps, meshes](std::size_t i) {
+            std::uint32_t depth = sortkey::quantizeDepth(mvps[i].m[15], kFarPlane);
+            return DrawPacket{ sortkey::make(RenderPass::Opaque, kSceneShader, kDefaultMaterial, meshes[i], depth),
+                               static_cast<std::uint32_t>(i), meshes[i] };
+        });
+        frame.queue.sort();
+
+        // PARTICLES: simulated straight into a mapped section the render thread
+        // draws in place. A frame that was never drawn keeps its section; with
+        // none free the particles still move, this frame just shows none.
+        if (m_particles.capacity() > 0) {
+            if (m_particleRenderer.valid() && frame.particleSection < 0) frame.particleSection = m_particleRenderer.acquire();
+            ParticleInstance* out = frame.particleSection >= 0 ? m_particleRenderer.section(frame.particleSection) : nullptr;
+            m_particles.update(m_frameDt, &m_jobs, out);
+            frame.particleCounts.assign(m_particles.chunkCounts(), m_particles.chunkCounts() + m_particles.chunkCount());
+        }
     }
-    void Engine::render() {
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
-        glDisable(GL_DEPTH_TEST);
-
-        m_shader.bind();
-
-        // CAMERA DIRECTION (raw floats)
-        float yaw = m_cameraYaw * 3.14159f / 180.0f;
-        float pitch = m_cameraPitch * 3.14159f / 180.0f;
-        float fx = sinf(yaw) * cosf(pitch);
-        float fy = sinf(pitch);
-        float fz = -cosf(yaw) * cosf(pitch);
-
-        // PROJECTION
-        float proj[16];
-        float fov = 45.0f * 3.14159f / 180.0f;
-        float aspect = (float)m_width / m_height;
-        float f = 1.0f / tanf(fov * 0.5f);
-        std::memset(proj, 0, sizeof(proj));
-        proj[0] = f / aspect;
-        proj[5] = f;
-        proj[10] = (100.0f + 0.1f) / (0.1f - 100.0f);
-        proj[11] = -1.0f;
-        proj[14] = (2.0f * 100.0f * 0.1f) / (0.1f - 100.0f);
-
-        // VIEW MATRIX
-        float eye[3] = { m_cameraPos[0], m_cameraPos[1], m_cameraPos[2] };
-        float target[3] = { eye[0] + fx, eye[1] + fy, eye[2] + fz };
-        float up[3] = { 0.0f, 1.0f, 0.0f };
-
-        float view[16];
-        mul(view, proj, nullptr); // dummy to reuse mul  we'll build view manually
-        {
-            float f[3] = { target[0] - eye[0], target[1] - eye[1], target[2] - eye[2] };
-            float len, s[3], u[3];
-            len = sqrtf(f[0] * f[0] + f[1] * f[1] + f[2] * f[2]);
-            if (len > 0.0f) { f[0] /= len; f[1] /= len; f[2] /= len; }
-
-            s[0] = f[1] * up[2] - f[2] * up[1];
-            s[1] = f[2] * up[0] - f[0] * up[2];
-            s[2] = f[0] * up[1] - f[1] * up[0];
-            len = sqrtf(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
-            if (len > 0.0f) { s[0] /= len; s[1] /= len; s[2] /= len; }
-
-            u[0] = s[1] * f[2] - s[2] * f[1];
-            u[1] = s[2] * f[0] - s[0] * f[2];
-            u[2] = s[0] * f[1] - s[1] * f[0];
-
-            std::memset(view, 0, sizeof(view));
-            view[0] = s[0]; view[1] = u[0]; view[2] = -f[0];
-            view[4] = s[1]; view[5] = u[1]; view[6] = -f[1];
-            view[8] = s[2]; view[9] = u[2]; view[10] = -f[2];
-            view[12] = -(s[0] * eye[0] + s[1] * eye[1] + s[2] * eye[2]);
-            view[13] = -(u[0] * eye[0] + u[1] * eye[1] + u[2] * eye[2]);
-            view[14] = f[0] * eye[0] + f[1] * eye[1] + f[2] * eye[2];
-            view[15] = 1.0f;
-        }
-
-        // SPINNING MODEL
-        float angle = (float)SDL_GetTicks() / 1000.0f * 90.0f;
-        float c = cosf(angle * 3.14159f / 180.0f);
-        float s = sinf(angle * 3.14159f / 180.0f);
-        float model[16] = {
-            c, -s, 0, 0,
-            s,  c, 0, 0,
-            0,  0, 1, 0,
-            0,  0, 0, 1
-        };
 
-        // FINAL MVP
-        float temp[16];
-        mul(temp, view, model);
-        float mvp[16];
-        mul(mvp, proj, temp);
+    void Engine::render(RenderFrame& frame) {
+        ENGINE_PROFILE_SCOPE("Engine::render");
+        m_gpuTimer.beginFrame();
+        m_particleRenderer.reclaim();
 
-        m_shader.setMat4("uMVP", mvp);
-        m_shader.setFloat("uTime", (float)SDL_GetTicks() / 1000.0f);
+        // Scene state, restated every frame; the device drops it when nothing changed
+        m_gpuTimer.beginPass(kClearPass);
+        gldevice::setClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        gldevice::setDepth(kSceneDepth);
+        gldevice::setBlend(kSceneBlend);
+        glClear(GL_COLOR_BUFFER_BIT);
+        m_gpuTimer.endPass();
+
+        // Per-frame uniforms: one upload, shared by every program
+        m_gpuTimer.beginPass(kScenePass);
+        m_frameBlock.update(&frame.uniforms, sizeof(frame.uniforms));
+
+        // One multi-draw per shader/material batch; programs are bound only when they change
+        Shader* shaders[] = { &m_shader };   // indexed by kSceneShader
+        frame.queue.execute(m_batch, frame.transforms.mvpMatrices(), shaders, 1);
+        m_gpuTimer.endPass();
+
+        // Over the scene; the section goes back to the main thread once its fence passes
+        if (frame.particleSection >= 0) {
+            m_gpuTimer.beginPass(kParticlePass);
+            gldevice::setBlend(kParticleBlend);
+            m_particleRenderer.draw(m_particleShader, frame.particleSection, frame.particleCounts.data(), frame.particleCounts.size());
+            frame.particleSection = -1;
+            m_gpuTimer.endPass();
+        }
+        m_frameBlock.endFrame();
+        m_gpuTimer.endFrame();
+    }
+
+    void Engine::processAssetChanges() {
+        // The watcher thread did the waiting; here we only drain its queue.
+        // Reloads read files and build strings, so they may use the heap.
+        memory::AllowHeap allow;
+        m_changedAssets.clear();
+        m_assetWatcher.poll(m_changedAssets);
+        for (Shader* shader : { &m_shader, &m_particleShader }) {
+            for (const std::string& path : m_changedAssets)
+                if (shader->dependsOn(path)) {
+                    shader->beginReload();
+                    break;
+                }
+            shader->pollReload();
+        }
+    }
 
-        glBindVertexArray(m_vao);
-        glDrawArrays(GL_TRIANGLES, 0, 3);
-        glBindVertexArray(0);
+    void Engine::pumpStreaming() {
+        {
+            memory::AllowHeap allow;   // finished loads are registered with the renderer
+            m_meshStreamer.pump();
+        }
+        // Culling lives on the main thread; pass it the bounds of what just arrived
+        if (m_meshStreamer.stats().loaded == m_boundedMeshes) return;
+        m_boundedMeshes = m_meshStreamer.stats().loaded;
+        memory::AllowHeap allow;
+        std::lock_guard<std::mutex> lock(m_loadedMeshLock);
+        for (std::uint32_t mesh : m_sceneMeshes) {
+            const MeshStreamer::MeshInfo* info = m_meshStreamer.info(mesh);
+            if (info) m_loadedMeshRadius.emplace_back(mesh, radiusAboutOrigin(info->bounds.min, info->bounds.max));
+        }
+        m_loadedMeshPending.store(true, std::memory_order_release);
+    }
 
-        m_shader.unbind();
+    void Engine::renderLoop() {
+        profiler::setThreadName("Render");
+        SDL_GL_MakeCurrent(m_window, m_glContext);
+        while (m_frames.waitAndAcquire()) {
+            ENGINE_PROFILE_SCOPE("RenderFrame");
+            processAssetChanges();
+            pumpStreaming();
+            render(m_frames.front());
+            ENGINE_PROFILE_SCOPE("SDL_GL_SwapWindow");
+            SDL_GL_SwapWindow(m_window);
+        }
+        SDL_GL_MakeCurrent(m_window, nullptr);
     }
 
     void Engine::run() {
+        if (m_config.ticks > 0) {
+            runTicks();
+            return;
+        }
+
+        // The GL context moves to the render thread until the loop ends
+        memory::markFrameThread();
+        SDL_GL_MakeCurrent(m_window, nullptr);
+        m_renderThread = std::thread(&Engine::renderLoop, this);
+
         while (m_running) {
+            m_pacer.wait();
+            ENGINE_PROFILE_SCOPE("Frame");
+            std::uint64_t heapAtStart = memory::frameHeapAllocations();
+            std::uint64_t frameStart = profiler::now();
             double currentTime = SDL_GetPerformanceCounter() / (double)SDL_GetPerformanceFrequency();
             double frameTime = currentTime - m_lastTime;
             m_lastTime = currentTime;
-            m_accumulator += frameTime;
+            m_sim.accumulator += frameTime;
+            m_frameDt = static_cast<float>(std::min(frameTime, kMaxTicksPerFrame * m_fixedTimestep));
+            reportFrameTime(frameTime);
 
             pollEvents();
+            m_jobs.pumpMainThread();
+
+            // Each tick takes the input stamped before its own end time, so a
+            // catch-up frame spreads its events over its ticks
+            int ticks = 0;
+            while (m_sim.accumulator >= m_fixedTimestep && ticks < kMaxTicksPerFrame) {
+                m_sim.accumulator -= m_fixedTimestep;
+                update((float)m_fixedTimestep, frameStart - static_cast<std::uint64_t>(m_sim.accumulator * 1e9));
+                ++ticks;
+            }
+            if (m_sim.accumulator >= m_fixedTimestep) {
+                std::uint64_t behind = static_cast<std::uint64_t>(m_sim.accumulator / m_fixedTimestep);
+                m_droppedTicks += behind;
+                m_sim.accumulator -= behind * m_fixedTimestep;
+            }
+            m_sim.renderAlpha = static_cast<float>(m_sim.accumulator / m_fixedTimestep);
 
-            while (m_accumulator >= m_fixedTimestep) {
-                update((float)m_fixedTimestep);
-                m_accumulator -= m_fixedTimestep;
+            // Build frame N + 1 while the render thread draws frame N. Running
+            // further ahead would only produce frames that get replaced unseen.
+            {
+                ENGINE_PROFILE_SCOPE("WaitForRenderThread");
+                m_frames.waitUntilTaken();
             }
+            pollEvents();   // late sample: the frame sees the freshest look motion
+            prepareFrame(m_frames.back());
+            m_frames.publish();
 
-            render();
-            SDL_GL_SwapWindow(m_window);
+            profiler::collect();
+            endFrame(heapAtStart);
+        }
+
+        m_frames.close();
+        m_renderThread.join();
+        SDL_GL_MakeCurrent(m_window, m_glContext);
+    }
+
+    void Engine::endFrame(std::uint64_t heapAtStart) {
+        m_frameMemory.endFrame();
+        m_frameHeapAllocations = memory::frameHeapAllocations() - heapAtStart;
+        if (++m_framesRun <= kHeapWarmupFrames || m_frameHeapAllocations == 0) return;
+#ifndef NDEBUG
+        std::cerr << "Frame " << m_framesRun << " made " << m_frameHeapAllocations
+            << " heap allocation(s) outside an AllowHeap scope\n";
+        assert(m_frameHeapAllocations == 0 && "steady-state frame allocated from the global heap");
+#endif
+    }
+
+    void Engine::reportFrameTime(double frameTime) {
+        m_frameStats.add(frameTime * 1000.0);
+        m_statsTimer += frameTime;
+        if (m_statsTimer < 5.0) return;
+        m_statsTimer = 0.0;
+
+        FrameTimeStats::Summary s = m_frameStats.summary();
+        std::printf("Frame ms  p50 %.2f  p95 %.2f  p99 %.2f  max %.2f  (last %zu frames)\n",
+            s.p50, s.p95, s.p99, s.max, s.samples);
+        const FramePacer::Stats& pacing = m_pacer.stats();
+        if (pacing.frames || m_droppedTicks)
+            std::printf("Pacing    %llu late frames, %.1f ms slept, %.1f ms spun, %llu ticks dropped catching up\n",
+                (unsigned long long)pacing.lateFrames, pacing.sleptNs / 1e6, pacing.spunNs / 1e6, (unsigned long long)m_droppedTicks);
+        // GPU close to the frame time means GPU-bound; far below it, the CPU (or vsync) sets the pace
+        if (m_gpuTimer.enabled()) {
+            FrameTimeStats::Summary gpu = m_gpuTimer.frameSummary();
+            std::printf("GPU ms    p50 %.2f  p95 %.2f  p99 %.2f  max %.2f  (scene p95 %.2f, %llu frames unread)\n",
+                gpu.p50, gpu.p95, gpu.p99, gpu.max, m_gpuTimer.passSummary(kScenePass).p95,
+                (unsigned long long)m_gpuTimer.stats().dropped);
         }
     }
 
+    void Engine::runTicks() {
+        // Flat-out: no accumulator and no vsync, every iteration is exactly one fixed tick
+        if (m_window) SDL_GL_SetSwapInterval(0);
+        std::vector<double> tickTimes;
+        tickTimes.reserve(static_cast<std::size_t>(m_config.ticks));
+
+        memory::markFrameThread();
+        m_frameDt = static_cast<float>(m_fixedTimestep);
+        std::uint64_t start = profiler::now();
+        for (std::uint64_t tick = 0; tick < m_config.ticks && m_running; ++tick) {
+            ENGINE_PROFILE_SCOPE("Frame");
+            std::uint64_t tickStart = profiler::now();
+            std::uint64_t heapAtStart = memory::frameHeapAllocations();
+
+            if (m_window) pollEvents();
+            m_jobs.pumpMainThread();
+            update((float)m_fixedTimestep, profiler::now());
+
+            // Serial: the tick time is the whole frame's cost on one thread
+            RenderFrame& frame = m_frames.back();
+            if (m_window) pumpStreaming();
+            prepareFrame(frame);
+            if (m_window) {
+                render(frame);
+                ENGINE_PROFILE_SCOPE("SDL_GL_SwapWindow");
+                SDL_GL_SwapWindow(m_window);
+            }
+
+            tickTimes.push_back((profiler::now() - tickStart) / 1e6);
+            profiler::collect();
+            endFrame(heapAtStart);
+        }
+        double seconds = (profiler::now() - start) / 1e9;
+
+        FrameTimeStats::Summary s = FrameTimeStats::summarize(tickTimes.data(), tickTimes.size());
+        const math::Vec3& camera = m_world.get<Position>(m_camera)->value;
+        const char* mode = m_config.display == DisplayMode::Headless ? "headless"
+            : m_config.display == DisplayMode::Offscreen ? "offscreen" : "windowed";
+
+        std::printf("\n=== TICK BENCHMARK (%s, %zu renderables) ===\n", mode, m_drawMeshes.size());
+        std::printf("Ticks        %zu in %.3f s = %.1f ticks/s\n", s.samples, seconds, s.samples / seconds);
+        std::printf("Tick ms      p50 %.3f  p95 %.3f  p99 %.3f  max %.3f  mean %.3f\n", s.p50, s.p95, s.p99, s.max, s.mean);
+        std::printf("Peak RSS     %.1f MB\n", peakResidentBytes() / (1024.0 * 1024.0));
+        std::printf("Heap allocs  %llu in the last tick, %llu since start (frame arena high water %.1f KB)\n",
+            (unsigned long long)m_frameHeapAllocations, (unsigned long long)memory::heapAllocations(),
+            m_frameMemory.previous().highWater() / 1024.0);
+        memory::printStats();
+        const Bvh::Stats& bvh = m_bvh.stats();
+        std::printf("Culling      %zu of %zu visible (%zu of %zu BVH nodes tested, %u builds, %llu nodes refit)\n",
+            m_visible.size(), m_bvh.objectCount(), bvh.nodesTested, m_bvh.nodeCount(), bvh.builds, (unsigned long long)bvh.refitNodes);
+        if (m_window) {
+            const BatchRenderer::Stats& batch = m_batch.stats();
+            std::printf("Draw calls   %zu per frame (%zu instances, %zu indirect commands, %llu fence stalls)\n",
+                batch.drawCalls, batch.instances, batch.commands, (unsigned long long)batch.fenceStalls);
+            if (m_gpuTimer.enabled()) {
+                FrameTimeStats::Summary gpu = m_gpuTimer.frameSummary();
+                std::printf("GPU ms       p50 %.3f  p95 %.3f  max %.3f per frame (clear p50 %.3f, scene p50 %.3f; %llu read back, %llu unread)\n",
+                    gpu.p50, gpu.p95, gpu.max, m_gpuTimer.passSummary(kClearPass).p50, m_gpuTimer.passSummary(kScenePass).p50,
+                    (unsigned long long)m_gpuTimer.stats().resolved, (unsigned long long)m_gpuTimer.stats().dropped);
+            }
+            const gldevice::Stats& gl = gldevice::stats();
+            std::printf("GL state     %.1f calls issued, %.1f filtered per tick\n",
+                gl.issued / (double)s.samples, gl.filtered / (double)s.samples);
+            const RenderQueue::Stats& queue = m_frames.back().queue.stats();
+            std::printf("Render queue %zu packets in %zu batches (%zu shader binds, %zu radix passes)\n",
+                queue.packets, queue.batches, queue.shaderBinds, queue.sortPasses);
+            const MeshStreamer::Stats& meshes = m_meshStreamer.stats();
+            if (!m_config.meshPaths.empty())
+                std::printf("Meshes       %u streamed, %u failed, %.1f MB uploaded, %u loader waits on a full ring\n",
+                    meshes.loaded, meshes.failed, meshes.bytesUploaded / (1024.0 * 1024.0), meshes.ringFullWaits);
+            if (m_input.dropped())
+                std::printf("Input        %llu events dropped on a full queue\n", (unsigned long long)m_input.dropped());
+        }
+        if (m_particles.capacity() > 0) {
+            const ParticleSystem::Stats& particles = m_particles.stats();
+            std::printf("Particles    %zu alive of %zu (%zu emitted, %zu killed last tick, %llu dropped on a full pool)\n",
+                particles.alive, m_particles.capacity(), particles.emitted, particles.killed, (unsigned long long)particles.dropped);
+            if (m_particleRenderer.valid()) {
+                const ParticleRenderer::Stats& drawn = m_particleRenderer.stats();
+                std::printf("             %zu instances in %zu draws, %llu frames found no free buffer section\n",
+                    drawn.instances, drawn.drawCalls, (unsigned long long)drawn.starved);
+            }
+        }
+        if (m_config.broadphase == BroadphaseMode::SweepAndPrune) {
+            const SweepAndPrune::Stats& sap = m_sweepAndPrune.stats();
+            std::printf("Broadphase   sweep-and-prune: %zu pairs among %zu bodies (%zu sort moves last frame, %u full sorts)\n",
+                sap.pairs, sap.bodies, sap.sortMoves, sap.fullSorts);
+        } else if (m_config.broadphase == BroadphaseMode::SpatialHash) {
+            const SpatialHashGrid::Stats& grid = m_spatialHash.stats();
+            std::printf("Broadphase   spatial hash: %zu pairs among %zu bodies (%zu cell entries in %zu buckets, cell %.2f, %zu oversized)\n",
+                grid.pairs, grid.bodies, grid.entries, grid.buckets, grid.cellSize, grid.largeBodies);
+        }
+        if (m_stateRecorder.isOpen()) {
+            const StateRecorder::Stats& recorded = m_stateRecorder.stats();
+            std::printf("State record %llu ticks of %zu bytes in %.1f KB (%llu keyframes)\n",
+                (unsigned long long)recorded.records, m_stateBuffer.size(), recorded.bytes / 1024.0, (unsigned long long)recorded.keyframes);
+        }
+        if (m_stateReplay.isOpen()) {
+            std::printf("State replay resumed in %.3f ms; %llu ticks checked against the recording, %llu diverged",
+                m_seekMs, (unsigned long long)m_replayChecked, (unsigned long long)m_replayDiverged);
+            if (m_replayDiverged) std::printf(" (first at tick %llu)", (unsigned long long)m_firstDivergence);
+            std::printf("\n");
+        }
+        // Identical across runs with the same --replay file; a quick determinism check
+        std::printf("Final camera %.6f %.6f %.6f\n", camera.x, camera.y, camera.z);
+    }
+
     void Engine::shutdown() {
-        if (m_glContext) SDL_GL_DeleteContext(m_glContext);
-        if (m_window) SDL_DestroyWindow(m_window);
+        m_recorder.close();
+        m_stateRecorder.close();
+        m_assetWatcher.stop();
+        if (m_glContext) {
+            m_meshStreamer.stop();
+            m_batch.shutdown();
+            m_particleRenderer.shutdown();
+            m_frameBlock.destroy();
+            m_gpuTimer.destroy();
+            SDL_GL_DeleteContext(m_glContext);
+            m_glContext = nullptr;
+        }
+        if (m_window) {
+            SDL_DestroyWindow(m_window);
+            m_window = nullptr;
+        }
         SDL_Quit();
-        if (m_vao) glDeleteVertexArrays(1, &m_vao);
-        if (m_vbo) glDeleteBuffers(1, &m_vbo);
     }
 
 }  // namespace engine
\ No newline at end of file
@@ -0,0 +1,77 @@
+// src/engine/core/EngineConfig.cpp
+#include "engine/core/EngineConfig.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace engine {
+
+    namespace {
+
+        void printUsage(const char* exe) {
+            std::cerr << "Usage: " << exe << " [options]\n"
+                << "  --headless        no window or GL context; simulation + CPU render prep only\n"
+                << "  --offscreen       hidden window with a real GL context (software GL is fine)\n"
+                << "  --ticks N         run N fixed ticks flat-out, then print a benchmark report\n"
+                << "  --entities N      spawn N extra spinning renderables\n"
+                << "  --particles N     run a particle fountain of up to N particles\n"
+                << "  --broadphase MODE find overlapping renderables each frame: sap or hash\n"
+                << "  --record FILE     record per-tick input to FILE\n"
+                << "  --replay FILE     drive ticks from a recording instead of live input\n"
+                << "  --record-state FILE  record per-tick input and simulation state to FILE\n"
+                << "  --replay-state FILE  start from a state recording and check every tick against it\n"
+                << "  --seek N          tick of the state recording to start from\n"
+                << "  --loose-assets    load assets/ from disk with hot reload, ignoring assets.pak\n"
+                << "  --mesh FILE       stream in a converted .emesh (repeatable)\n"
+                << "  --vsync MODE      on, off or adaptive (default adaptive)\n"
+                << "  --fps-cap N       pace frames to at most N per second\n"
+                << "  --bench-jobs [N]  job system scaling benchmark (1..N workers)\n";
+        }
+
+        bool parseVsync(const char* value, VsyncMode& out) {
+            if (std::strcmp(value, "on") == 0) out = VsyncMode::On;
+            else if (std::strcmp(value, "off") == 0) out = VsyncMode::Off;
+            else if (std::strcmp(value, "adaptive") == 0) out = VsyncMode::Adaptive;
+            else return false;
+            return true;
+        }
+
+        bool parseBroadphase(const char* value, BroadphaseMode& out) {
+            if (std::strcmp(value, "sap") == 0) out = BroadphaseMode::SweepAndPrune;
+            else if (std::strcmp(value, "hash") == 0) out = BroadphaseMode::SpatialHash;
+            else return false;
+            return true;
+        }
+
+    } // namespace
+
+    bool parseEngineConfig(int argc, char* argv[], EngineConfig& out) {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            bool hasValue = i + 1 < argc;
+
+            if (std::strcmp(arg, "--headless") == 0) out.display = DisplayMode::Headless;
+            else if (std::strcmp(arg, "--offscreen") == 0) out.display = DisplayMode::Offscreen;
+            else if (std::strcmp(arg, "--ticks") == 0 && hasValue) out.ticks = std::strtoull(argv[++i], nullptr, 10);
+            else if (std::strcmp(arg, "--entities") == 0 && hasValue) out.extraEntities = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            else if (std::strcmp(arg, "--particles") == 0 && hasValue) out.particles = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            else if (std::strcmp(arg, "--broadphase") == 0 && hasValue && parseBroadphase(argv[i + 1], out.broadphase)) ++i;
+            else if (std::strcmp(arg, "--record") == 0 && hasValue) out.recordInputPath = argv[++i];
+            else if (std::strcmp(arg, "--replay") == 0 && hasValue) out.replayInputPath = argv[++i];
+            else if (std::strcmp(arg, "--record-state") == 0 && hasValue) out.recordStatePath = argv[++i];
+            else if (std::strcmp(arg, "--replay-state") == 0 && hasValue) out.replayStatePath = argv[++i];
+            else if (std::strcmp(arg, "--seek") == 0 && hasValue) out.seekTick = std::strtoll(argv[++i], nullptr, 10);
+            else if (std::strcmp(arg, "--loose-assets") == 0) out.looseAssets = true;
+            else if (std::strcmp(arg, "--mesh") == 0 && hasValue) out.meshPaths.push_back(argv[++i]);
+            else if (std::strcmp(arg, "--vsync") == 0 && hasValue && parseVsync(argv[i + 1], out.vsync)) ++i;
+            else if (std::strcmp(arg, "--fps-cap") == 0 && hasValue) out.frameCap = std::strtod(argv[++i], nullptr);
+            else {
+                std::cerr << "Unknown or incomplete option: " << arg << "\n";
+                printUsage(argv[0]);
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace engine
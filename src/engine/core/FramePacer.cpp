@@ -0,0 +1,97 @@
+// src/engine/core/FramePacer.cpp
+#include "engine/core/FramePacer.h"
+#include "engine/core/Profiler.h"
+#include <SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
+namespace engine {
+
+    namespace {
+
+        // Spin window bounds: never trust a sleep closer than the floor, and
+        // never spin longer than the ceiling even on a coarse scheduler
+        constexpr std::uint64_t kMinSpinWindowNs = 200000;
+        constexpr std::uint64_t kMaxSpinWindowNs = 4000000;
+
+        const char* vsyncName(VsyncMode mode) {
+            switch (mode) {
+            case VsyncMode::On: return "on";
+            case VsyncMode::Adaptive: return "adaptive";
+            default: return "off";
+            }
+        }
+
+    } // namespace
+
+    FramePacer::~FramePacer() {
+#if defined(_WIN32)
+        if (m_fineTimer) timeEndPeriod(1);
+#endif
+    }
+
+    void FramePacer::configure(VsyncMode vsync, double frameCap) {
+        m_vsync = vsync;
+        int interval = vsync == VsyncMode::Adaptive ? -1 : vsync == VsyncMode::On ? 1 : 0;
+        if (SDL_GL_SetSwapInterval(interval) != 0 && vsync == VsyncMode::Adaptive) {
+            m_vsync = VsyncMode::On;
+            SDL_GL_SetSwapInterval(1);
+        }
+
+        m_periodNs = frameCap > 0.0 ? static_cast<std::uint64_t>(1e9 / frameCap) : 0;
+        m_deadline = profiler::now();
+#if defined(_WIN32)
+        // The default 15.6 ms tick would leave almost every wait to the spin
+        if (m_periodNs && !m_fineTimer) m_fineTimer = timeBeginPeriod(1) == TIMERR_NOERROR;
+#endif
+        std::cout << "Frame pacing: vsync " << vsyncName(m_vsync);
+        if (m_periodNs) std::cout << ", capped at " << frameCap << " fps";
+        std::cout << std::endl;
+    }
+
+    void FramePacer::wait() {
+        if (!m_periodNs) return;
+        ENGINE_PROFILE_SCOPE("FramePacer::wait");
+        ++m_stats.frames;
+        m_deadline += m_periodNs;
+
+        std::uint64_t now = profiler::now();
+        if (now >= m_deadline) {
+            // A frame that ran a little long is made up by the next one; a
+            // real stall restarts the schedule instead of rushing frames out
+            ++m_stats.lateFrames;
+            if (now - m_deadline > m_periodNs) m_deadline = now;
+            return;
+        }
+
+        if (m_deadline - now > m_spinWindowNs) {
+            std::uint64_t request = m_deadline - now - m_spinWindowNs;
+            std::this_thread::sleep_for(std::chrono::nanoseconds(request));
+            std::uint64_t woke = profiler::now();
+            m_stats.sleptNs += woke - now;
+
+            // Widen at once when the OS overslept, narrow slowly when it didn't
+            std::uint64_t overshoot = woke - now > request ? woke - now - request : 0;
+            std::uint64_t target = std::clamp(overshoot + overshoot / 2, kMinSpinWindowNs, kMaxSpinWindowNs);
+            m_spinWindowNs = target > m_spinWindowNs ? target : m_spinWindowNs - (m_spinWindowNs - target) / 16;
+            now = woke;
+        }
+
+        std::uint64_t spinStart = now;
+        while (now < m_deadline) {
+            std::this_thread::yield();
+            now = profiler::now();
+        }
+        m_stats.spunNs += now - spinStart;
+    }
+
+} // namespace engine
@@ -0,0 +1,138 @@
+// src/engine/core/Input.cpp
+#include "engine/core/Input.h"
+#include <iostream>
+
+namespace engine {
+
+    namespace {
+
+        // File layout: magic, version, tick count, then tickCount packed records
+        constexpr std::uint32_t kMagic = 0x504E4945;   // "EINP"
+        constexpr std::uint32_t kVersion = 1;
+
+        struct Record {
+            std::uint32_t buttons;
+            std::int32_t mouseDX;
+            std::int32_t mouseDY;
+        };
+
+    } // namespace
+
+    // === QUEUE ===
+    bool InputQueue::push(const InputEvent& event) {
+        std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= kCapacity) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_events[head & (kCapacity - 1)] = event;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    InputState InputQueue::nextTick(std::uint64_t tickEnd) {
+        InputState input;
+        std::uint32_t pressed = 0;
+        std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        std::size_t head = m_head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            const InputEvent& event = m_events[tail & (kCapacity - 1)];
+            if (event.time >= tickEnd) break;
+            switch (event.type) {
+            case InputEventType::ButtonDown:
+                m_held |= event.buttons;
+                pressed |= event.buttons;
+                break;
+            case InputEventType::ButtonUp:
+                m_held &= ~event.buttons;
+                break;
+            case InputEventType::MouseMotion:
+                // Only motion while the look button is down turns the camera
+                if (m_held & kInputLook) {
+                    input.mouseDX += event.dx;
+                    input.mouseDY += event.dy;
+                }
+                break;
+            }
+        }
+        m_tail.store(tail, std::memory_order_release);
+
+        input.buttons = m_held | pressed;
+        return input;
+    }
+
+    void InputQueue::pendingMouse(std::int32_t& dx, std::int32_t& dy) const {
+        dx = dy = 0;
+        std::uint32_t held = m_held;
+        std::size_t head = m_head.load(std::memory_order_acquire);
+        for (std::size_t tail = m_tail.load(std::memory_order_relaxed); tail != head; ++tail) {
+            const InputEvent& event = m_events[tail & (kCapacity - 1)];
+            if (event.type == InputEventType::ButtonDown) held |= event.buttons;
+            else if (event.type == InputEventType::ButtonUp) held &= ~event.buttons;
+            else if (held & kInputLook) {
+                dx += event.dx;
+                dy += event.dy;
+            }
+        }
+    }
+
+    // === RECORDER ===
+    bool InputRecorder::open(const std::string& path) {
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open()) {
+            std::cerr << "Failed to open input recording for writing: " << path << std::endl;
+            return false;
+        }
+        m_ticks = 0;
+        std::uint32_t header[3] = { kMagic, kVersion, 0 };
+        m_file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        return true;
+    }
+
+    void InputRecorder::write(const InputState& input) {
+        if (!m_file.is_open()) return;
+        Record record{ input.buttons, input.mouseDX, input.mouseDY };
+        m_file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        ++m_ticks;
+    }
+
+    void InputRecorder::close() {
+        if (!m_file.is_open()) return;
+        // Patch the tick count into the header
+        m_file.seekp(2 * sizeof(std::uint32_t));
+        m_file.write(reinterpret_cast<const char*>(&m_ticks), sizeof(m_ticks));
+        m_file.close();
+        std::cout << "Recorded " << m_ticks << " input ticks" << std::endl;
+    }
+
+    // === REPLAY ===
+    bool InputReplay::open(const std::string& path) {
+        m_file.open(path, std::ios::binary);
+        if (!m_file.is_open()) {
+            std::cerr << "Failed to open input recording: " << path << std::endl;
+            return false;
+        }
+        std::uint32_t header[3] = {};
+        m_file.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!m_file || header[0] != kMagic || header[1] != kVersion) {
+            std::cerr << "Not an input recording (or wrong version): " << path << std::endl;
+            m_file.close();
+            return false;
+        }
+        m_ticks = header[2];
+        m_read = 0;
+        return true;
+    }
+
+    bool InputReplay::next(InputState& out) {
+        if (!m_file.is_open() || m_read >= m_ticks) return false;
+        Record record;
+        if (!m_file.read(reinterpret_cast<char*>(&record), sizeof(record))) return false;
+        out.buttons = record.buttons;
+        out.mouseDX = record.mouseDX;
+        out.mouseDY = record.mouseDY;
+        ++m_read;
+        return true;
+    }
+
+} // namespace engine
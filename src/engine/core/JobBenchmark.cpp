@@ -0,0 +1,73 @@
+// src/engine/core/JobBenchmark.cpp
+#include "engine/core/JobBenchmark.h"
+#include "engine/core/JobSystem.h"
+#include "engine/render/TransformPipeline.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+namespace engine {
+
+    namespace {
+
+        constexpr std::size_t kEntities = 250000;
+        constexpr std::size_t kComputeItems = 1 << 22;
+        constexpr int kRepeats = 20;
+
+        using Clock = std::chrono::steady_clock;
+
+        template <typename Fn>
+        double bestOf(Fn&& fn) {
+            double best = 1e30;
+            for (int i = 0; i < kRepeats; ++i) {
+                auto start = Clock::now();
+                fn();
+                best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+            }
+            return best;
+        }
+
+    } // namespace
+
+    int runJobBenchmark(unsigned maxWorkers) {
+        if (maxWorkers == 0) maxWorkers = std::max(1u, std::thread::hardware_concurrency());
+
+        TransformPipeline transforms;
+        transforms.reserve(kEntities);
+        for (std::size_t i = 0; i < kEntities; ++i) {
+            float f = static_cast<float>(i);
+            transforms.add(math::Vec3(f, f * 0.5f, -f), math::quatFromAxisAngle(math::Vec3(0.3f, 1.0f, 0.2f), f * 0.01f), math::Vec3(1.0f, 1.0f, 1.0f));
+        }
+        math::Mat4 viewProj = math::perspective(1.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+        std::vector<float> values(kComputeItems);
+
+        std::printf("Job system benchmark: %zu transforms, %zu compute items, best of %d\n", kEntities, kComputeItems, kRepeats);
+        std::printf("%8s %14s %9s %14s %9s %11s\n", "workers", "transforms ms", "speedup", "compute ms", "speedup", "efficiency");
+
+        double baseTransforms = 0.0, baseCompute = 0.0;
+        for (unsigned workers = 1; workers <= maxWorkers; ++workers) {
+            JobSystem jobs(workers);
+
+            double transformMs = bestOf([&] { transforms.update(viewProj, &jobs); });
+            double computeMs = bestOf([&] {
+                jobs.parallelFor(values.size(), 16384, [&](std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; ++i) {
+                        float x = static_cast<float>(i);
+                        values[i] = std::sqrt(x) * std::sin(x) + std::cos(x * 0.5f);
+                    }
+                });
+            });
+
+            if (workers == 1) {
+                baseTransforms = transformMs;
+                baseCompute = computeMs;
+            }
+            double computeSpeedup = baseCompute / computeMs;
+            std::printf("%8u %14.3f %8.2fx %14.3f %8.2fx %10.0f%%\n", workers, transformMs, baseTransforms / transformMs,
+                computeMs, computeSpeedup, 100.0 * computeSpeedup / workers);
+        }
+        return 0;
+    }
+
+} // namespace engine
@@ -0,0 +1,239 @@
+// src/engine/core/JobSystem.cpp
+#include "engine/core/JobSystem.h"
+#include "engine/core/Memory.h"
+#include "engine/core/Profiler.h"
+#include <algorithm>
+#include <string>
+
+namespace engine {
+
+    namespace {
+
+        // Per-thread ring of job slots; a slot still in flight when the ring
+        // wraps falls back to a heap job instead of stalling the submitter
+        struct JobPool {
+            static constexpr std::size_t kSize = 4096;
+            std::unique_ptr<Job[]> jobs{ new Job[kSize] };
+            std::size_t next = 0;
+        };
+
+        thread_local JobPool t_pool;
+        thread_local JobSystem* t_owner = nullptr;
+        thread_local unsigned t_queueIndex = 0;
+        thread_local std::uint32_t t_rng = 0x9E3779B9u;
+
+        std::uint32_t nextRandom() {
+            t_rng ^= t_rng << 13;
+            t_rng ^= t_rng >> 17;
+            t_rng ^= t_rng << 5;
+            return t_rng;
+        }
+
+        constexpr unsigned kNoQueue = ~0u;
+        constexpr std::size_t kMainLaneReserve = 256;
+
+    } // namespace
+
+    // === WORK QUEUE ===
+    bool JobSystem::WorkQueue::push(Job* job) {
+        std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+        std::int64_t t = m_top.load(std::memory_order_acquire);
+        if (b - t >= kCapacity) return false;
+        m_jobs[b & (kCapacity - 1)].store(job, std::memory_order_relaxed);
+        m_bottom.store(b + 1, std::memory_order_release);   // publishes the slot to thieves
+        return true;
+    }
+
+    Job* JobSystem::WorkQueue::pop() {
+        std::int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = m_top.load(std::memory_order_relaxed);
+
+        if (t > b) {
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job* job = m_jobs[b & (kCapacity - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Last element: race the thieves for it
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) job = nullptr;
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* JobSystem::WorkQueue::steal() {
+        std::int64_t t = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = m_bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+        Job* job = m_jobs[t & (kCapacity - 1)].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return nullptr;
+        return job;
+    }
+
+    // === JOB SYSTEM ===
+    JobSystem::JobSystem(unsigned workerCount) {
+        if (workerCount == 0) workerCount = std::max(1u, std::thread::hardware_concurrency());
+        m_mainThread = std::this_thread::get_id();
+        m_mainLane.reserve(kMainLaneReserve);
+        m_mainRun.reserve(kMainLaneReserve);
+        for (unsigned i = 0; i < workerCount; ++i) m_queues.push_back(std::make_unique<WorkQueue>());
+
+        t_owner = this;
+        t_queueIndex = 0;
+        for (unsigned i = 1; i < workerCount; ++i) m_threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepLock);
+            m_quit.store(true);
+        }
+        m_wake.notify_all();
+        for (std::thread& t : m_threads) t.join();
+        if (t_owner == this) t_owner = nullptr;
+    }
+
+    Job* JobSystem::allocateJob() {
+        Job& slot = t_pool.jobs[t_pool.next++ & (JobPool::kSize - 1)];
+        Job* job = &slot;
+        if (slot.inUse.exchange(true, std::memory_order_acquire)) {
+            job = new Job();
+            job->heapAllocated = true;
+            job->inUse.store(true, std::memory_order_relaxed);
+        }
+        job->next = nullptr;
+        return job;
+    }
+
+    void JobSystem::submit(Job* job) {
+        if (t_owner == this) {
+            if (!m_queues[t_queueIndex]->push(job)) {
+                execute(job);   // own deque full: run inline rather than block
+                return;
+            }
+        }
+        else {
+            std::lock_guard<std::mutex> lock(m_injectLock);
+            m_injected.push_back(job);
+        }
+
+        m_pending.fetch_add(1);
+        if (m_sleepers.load() > 0) {
+            std::lock_guard<std::mutex> lock(m_sleepLock);
+            m_wake.notify_one();
+        }
+    }
+
+    void JobSystem::finish(JobCounter* counter) {
+        if (!counter) return;
+        Job* released = nullptr;
+        {
+            // Decrement under the lock so wait() can fence on it before the counter dies
+            std::lock_guard<std::mutex> lock(counter->m_continuationLock);
+            if (counter->m_value.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                released = counter->m_continuations;
+                counter->m_continuations = nullptr;
+            }
+        }
+        while (released) {
+            Job* next = released->next;
+            submit(released);
+            released = next;
+        }
+    }
+
+    void JobSystem::execute(Job* job) {
+        JobCounter* counter = job->counter;
+        job->invoke(job);
+        if (job->heapAllocated) delete job;
+        else job->inUse.store(false, std::memory_order_release);
+        finish(counter);
+    }
+
+    Job* JobSystem::findJob(unsigned self) {
+        if (self != kNoQueue) {
+            if (Job* job = m_queues[self]->pop()) {
+                m_pending.fetch_sub(1);
+                return job;
+            }
+        }
+
+        unsigned count = workerCount();
+        unsigned start = nextRandom() % count;
+        for (unsigned i = 0; i < count; ++i) {
+            unsigned victim = (start + i) % count;
+            if (victim == self) continue;
+            if (Job* job = m_queues[victim]->steal()) {
+                m_pending.fetch_sub(1);
+                return job;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_injectLock);
+        if (m_injected.empty()) return nullptr;
+        Job* job = m_injected.front();
+        m_injected.pop_front();
+        m_pending.fetch_sub(1);
+        return job;
+    }
+
+    void JobSystem::workerLoop(unsigned index) {
+        t_owner = this;
+        t_queueIndex = index;
+        t_rng ^= index * 0x85EBCA6Bu;
+#if ENGINE_PROFILING
+        profiler::setThreadName(("Worker " + std::to_string(index)).c_str());
+#endif
+        memory::markFrameThread();   // jobs run frame work, so they fall under the heap check
+
+        while (!m_quit.load(std::memory_order_relaxed)) {
+            if (Job* job = findJob(index)) {
+                execute(job);
+                continue;
+            }
+
+            // Brief spin before parking; frame work arrives in bursts
+            bool found = false;
+            for (int spin = 0; spin < 64 && !found; ++spin) {
+                std::this_thread::yield();
+                found = m_pending.load(std::memory_order_relaxed) > 0;
+            }
+            if (found) continue;
+
+            std::unique_lock<std::mutex> lock(m_sleepLock);
+            m_sleepers.fetch_add(1);
+            m_wake.wait(lock, [this] { return m_pending.load() > 0 || m_quit.load(); });
+            m_sleepers.fetch_sub(1);
+        }
+    }
+
+    void JobSystem::wait(JobCounter& counter) {
+        unsigned self = t_owner == this ? t_queueIndex : kNoQueue;
+        bool mainThread = isMainThread();
+        while (!counter.done()) {
+            if (mainThread) pumpMainThread();
+            if (Job* job = findJob(self)) execute(job);
+            else std::this_thread::yield();
+        }
+        // finish() may still be inside the counter's lock after the last decrement
+        std::lock_guard<std::mutex> lock(counter.m_continuationLock);
+    }
+
+    void JobSystem::pumpMainThread() {
+        {
+            std::lock_guard<std::mutex> lock(m_mainLaneLock);
+            if (m_mainLane.empty() && m_mainRunNext == m_mainRun.size()) return;
+            if (m_mainRun.empty()) m_mainRun.swap(m_mainLane);
+            else m_mainRun.insert(m_mainRun.end(), m_mainLane.begin(), m_mainLane.end());
+            m_mainLane.clear();
+        }
+        while (m_mainRunNext < m_mainRun.size()) execute(m_mainRun[m_mainRunNext++]);
+        // Everything queued so far has run, nested pumps included
+        m_mainRun.clear();
+        m_mainRunNext = 0;
+    }
+
+} // namespace engine
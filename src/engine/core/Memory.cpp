@@ -0,0 +1,340 @@
+// src/engine/core/Memory.cpp
+#include "engine/core/Memory.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace engine::memory {
+
+    namespace {
+
+        struct TagCounters {
+            std::atomic<std::size_t> current{ 0 };
+            std::atomic<std::size_t> peak{ 0 };
+            std::atomic<std::size_t> budget{ 0 };
+            std::atomic<std::uint64_t> allocations{ 0 };
+            std::atomic<bool> warned{ false };
+        };
+
+        TagCounters g_tags[static_cast<std::size_t>(Tag::Count)];
+
+        TagCounters& counters(Tag tag) {
+            return g_tags[static_cast<std::size_t>(tag)];
+        }
+
+        std::atomic<std::uint64_t> g_heapAllocations{ 0 };
+        std::atomic<std::uint64_t> g_frameHeapAllocations{ 0 };
+        thread_local bool t_frameThread = false;
+        thread_local int t_allowHeap = 0;
+
+        // Called from the replaced operator new at the bottom of this file
+        void countHeapAllocation() {
+            g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+            if (t_frameThread && !t_allowHeap) g_frameHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void* alignedNew(std::size_t bytes, std::size_t alignment) {
+            if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) return ::operator new(bytes);
+            return ::operator new(bytes, std::align_val_t(alignment));
+        }
+
+        void alignedDelete(void* p, std::size_t alignment) {
+            if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) ::operator delete(p);
+            else ::operator delete(p, std::align_val_t(alignment));
+        }
+
+    } // namespace
+
+    // === TAGGED BUDGETS ===
+    const char* tagName(Tag tag) {
+        switch (tag) {
+        case Tag::General: return "general";
+        case Tag::Ecs:     return "ecs";
+        case Tag::Render:  return "render";
+        case Tag::Shaders: return "shaders";
+        case Tag::Assets:  return "assets";
+        case Tag::Frame:   return "frame";
+        case Tag::Count:   break;
+        }
+        return "unknown";
+    }
+
+    void setBudget(Tag tag, std::size_t bytes) {
+        counters(tag).budget.store(bytes);
+        counters(tag).warned.store(false);
+    }
+
+    TagStats stats(Tag tag) {
+        TagCounters& c = counters(tag);
+        TagStats result;
+        result.current = c.current.load(std::memory_order_relaxed);
+        result.peak = c.peak.load(std::memory_order_relaxed);
+        result.budget = c.budget.load(std::memory_order_relaxed);
+        result.allocations = c.allocations.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    void noteAlloc(Tag tag, std::size_t bytes) {
+        TagCounters& c = counters(tag);
+        c.allocations.fetch_add(1, std::memory_order_relaxed);
+        std::size_t now = c.current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        std::size_t peak = c.peak.load(std::memory_order_relaxed);
+        while (now > peak && !c.peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+
+        std::size_t budget = c.budget.load(std::memory_order_relaxed);
+        if (budget && now > budget && !c.warned.exchange(true)) {
+            std::cerr << "memory: " << tagName(tag) << " is over budget (" << now / 1024 << " KB of "
+                << budget / 1024 << " KB)" << std::endl;
+        }
+    }
+
+    void noteFree(Tag tag, std::size_t bytes) {
+        counters(tag).current.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    void printStats() {
+        for (std::size_t i = 0; i < static_cast<std::size_t>(Tag::Count); ++i) {
+            Tag tag = static_cast<Tag>(i);
+            TagStats s = stats(tag);
+            if (!s.peak) continue;
+            std::printf("Memory       %-8s %8.2f MB now, %8.2f MB peak", tagName(tag), s.current / (1024.0 * 1024.0), s.peak / (1024.0 * 1024.0));
+            if (s.budget) std::printf(", budget %.2f MB%s", s.budget / (1024.0 * 1024.0), s.peak > s.budget ? " EXCEEDED" : "");
+            std::printf("\n");
+        }
+    }
+
+    // === GLOBAL HEAP ===
+    std::uint64_t heapAllocations() {
+        return g_heapAllocations.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t frameHeapAllocations() {
+        return g_frameHeapAllocations.load(std::memory_order_relaxed);
+    }
+
+    void markFrameThread() {
+        t_frameThread = true;
+    }
+
+    AllowHeap::AllowHeap() {
+        ++t_allowHeap;
+    }
+
+    AllowHeap::~AllowHeap() {
+        --t_allowHeap;
+    }
+
+    // === TAGGED RESOURCE ===
+    void* TaggedResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+        void* p = alignedNew(bytes, alignment);
+        noteAlloc(m_tag, bytes);
+        return p;
+    }
+
+    void TaggedResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+        noteFree(m_tag, bytes);
+        alignedDelete(p, alignment);
+    }
+
+    std::pmr::memory_resource* resource(Tag tag) {
+        static TaggedResource resources[] = {
+            TaggedResource(Tag::General), TaggedResource(Tag::Ecs), TaggedResource(Tag::Render),
+            TaggedResource(Tag::Shaders), TaggedResource(Tag::Assets), TaggedResource(Tag::Frame),
+        };
+        static_assert(sizeof(resources) / sizeof(resources[0]) == static_cast<std::size_t>(Tag::Count), "one resource per tag");
+        return &resources[static_cast<std::size_t>(tag)];
+    }
+
+    // === LINEAR ARENA ===
+    LinearArena::LinearArena(std::size_t capacity, Tag tag) : m_capacity(capacity), m_tag(tag) {
+        m_base = static_cast<std::byte*>(::operator new(capacity, std::align_val_t(64)));
+        noteAlloc(m_tag, capacity);
+    }
+
+    LinearArena::~LinearArena() {
+        reset();
+        ::operator delete(m_base, std::align_val_t(64));
+        noteFree(m_tag, m_capacity);
+    }
+
+    void* LinearArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_base);
+        std::uintptr_t start = (base + m_used + alignment - 1) & ~std::uintptr_t(alignment - 1);
+        std::size_t end = static_cast<std::size_t>(start - base) + bytes;
+        if (end <= m_capacity) {
+            m_used = end;
+            if (m_used > m_highWater) m_highWater = m_used;
+            return reinterpret_cast<void*>(start);
+        }
+
+        // Out of room: a heap block lives until reset(), the header sits in front of it
+        if (m_overflows++ == 0) {
+            std::cerr << "memory: " << tagName(m_tag) << " arena overflowed its " << m_capacity / 1024
+                << " KB; raise its capacity" << std::endl;
+        }
+        if (alignment < alignof(Overflow)) alignment = alignof(Overflow);
+        std::size_t header = (sizeof(Overflow) + alignment - 1) & ~(alignment - 1);
+        std::byte* block = static_cast<std::byte*>(alignedNew(header + bytes, alignment));
+        m_overflow = new (block) Overflow{ m_overflow, header + bytes, alignment };
+        noteAlloc(m_tag, header + bytes);
+        return block + header;
+    }
+
+    void LinearArena::reset() {
+        while (m_overflow) {
+            Overflow* next = m_overflow->next;
+            noteFree(m_tag, m_overflow->bytes);
+            alignedDelete(m_overflow, m_overflow->alignment);
+            m_overflow = next;
+        }
+        m_used = 0;
+    }
+
+    FrameAllocator::FrameAllocator(std::size_t bytesPerFrame, Tag tag) {
+        m_arenas[0] = std::make_unique<LinearArena>(bytesPerFrame, tag);
+        m_arenas[1] = std::make_unique<LinearArena>(bytesPerFrame, tag);
+    }
+
+    void FrameAllocator::endFrame() {
+        m_index ^= 1;
+        m_arenas[m_index]->reset();
+    }
+
+    // === POOLS ===
+    PoolAllocator::PoolAllocator(std::size_t blockSize, std::size_t blocksPerSlab, Tag tag, std::size_t alignment)
+        : m_blocksPerSlab(blocksPerSlab ? blocksPerSlab : 1), m_alignment(alignment < alignof(FreeBlock) ? alignof(FreeBlock) : alignment), m_tag(tag) {
+        if (blockSize < sizeof(FreeBlock)) blockSize = sizeof(FreeBlock);
+        m_blockSize = (blockSize + m_alignment - 1) & ~(m_alignment - 1);
+    }
+
+    PoolAllocator::~PoolAllocator() {
+        for (void* slab : m_slabs) {
+            alignedDelete(slab, m_alignment);
+            noteFree(m_tag, m_blockSize * m_blocksPerSlab);
+        }
+    }
+
+    void PoolAllocator::grow() {
+        std::byte* slab = static_cast<std::byte*>(alignedNew(m_blockSize * m_blocksPerSlab, m_alignment));
+        noteAlloc(m_tag, m_blockSize * m_blocksPerSlab);
+        m_slabs.push_back(slab);
+        // Threaded back to front so blocks are handed out in address order
+        for (std::size_t i = m_blocksPerSlab; i-- > 0;) {
+            FreeBlock* block = new (slab + i * m_blockSize) FreeBlock{ m_free };
+            m_free = block;
+        }
+    }
+
+    void* PoolAllocator::allocate() {
+        if (!m_free) grow();
+        FreeBlock* block = m_free;
+        m_free = block->next;
+        ++m_inUse;
+        return block;
+    }
+
+    void PoolAllocator::deallocate(void* block) {
+        if (!block) return;
+        m_free = new (block) FreeBlock{ m_free };
+        --m_inUse;
+    }
+
+    void* PoolResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+        return fits(bytes, alignment) ? m_pool.allocate() : m_upstream->allocate(bytes, alignment);
+    }
+
+    void PoolResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+        if (fits(bytes, alignment)) m_pool.deallocate(p);
+        else m_upstream->deallocate(p, bytes, alignment);
+    }
+
+} // namespace engine::memory
+
+// === GLOBAL OPERATOR NEW / DELETE ===
+// Replaced only to count; storage still comes from malloc.
+namespace {
+
+    void* heapAllocate(std::size_t size) noexcept {
+        engine::memory::countHeapAllocation();
+        return std::malloc(size ? size : 1);
+    }
+
+    void* heapAllocateAligned(std::size_t size, std::align_val_t alignment) noexcept {
+        engine::memory::countHeapAllocation();
+        std::size_t align = static_cast<std::size_t>(alignment);
+        if (align < sizeof(void*)) align = sizeof(void*);
+#if defined(_WIN32)
+        return _aligned_malloc(size ? size : 1, align);
+#else
+        void* p = nullptr;
+        return posix_memalign(&p, align, size ? size : 1) == 0 ? p : nullptr;
+#endif
+    }
+
+    // Pairs with heapAllocate. Kept out of line so GCC does not see a
+    // bare free() against operator new and warn about a mismatch.
+#if defined(_MSC_VER)
+    __declspec(noinline)
+#else
+    __attribute__((noinline))
+#endif
+    void heapFree(void* p) noexcept {
+        std::free(p);
+    }
+
+    void heapFreeAligned(void* p) noexcept {
+#if defined(_WIN32)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    if (void* p = heapAllocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* p = heapAllocate(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return heapAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return heapAllocate(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* p = heapAllocateAligned(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* p = heapAllocateAligned(size, alignment)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return heapAllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return heapAllocateAligned(size, alignment); }
+
+void operator delete(void* p) noexcept { heapFree(p); }
+void operator delete[](void* p) noexcept { heapFree(p); }
+void operator delete(void* p, std::size_t) noexcept { heapFree(p); }
+void operator delete[](void* p, std::size_t) noexcept { heapFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { heapFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { heapFree(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { heapFreeAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { heapFreeAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { heapFreeAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { heapFreeAligned(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { heapFreeAligned(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { heapFreeAligned(p); }
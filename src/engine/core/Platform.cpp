@@ -0,0 +1,98 @@
+// src/engine/core/Platform.cpp
+#include "engine/core/Platform.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace engine {
+
+    std::size_t peakResidentBytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return static_cast<std::size_t>(counters.PeakWorkingSetSize);
+        return 0;
+#else
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+        return static_cast<std::size_t>(usage.ru_maxrss);          // bytes
+#else
+        return static_cast<std::size_t>(usage.ru_maxrss) * 1024;   // kilobytes
+#endif
+#endif
+    }
+
+    // === MAPPED FILE ===
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+#if defined(_WIN32)
+    bool MappedFile::open(const std::string& path) {
+        close();
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER size;
+        HANDLE mapping = nullptr;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view) {
+            if (mapping) CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_file = file;
+        m_mapping = mapping;
+        m_data = static_cast<const char*>(view);
+        m_size = static_cast<std::size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle(m_mapping);
+        if (m_file) CloseHandle(m_file);
+        m_data = nullptr;
+        m_mapping = m_file = nullptr;
+        m_size = 0;
+    }
+#else
+    bool MappedFile::open(const std::string& path) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+
+        struct stat info;
+        void* view = MAP_FAILED;
+        if (fstat(fd, &info) == 0 && info.st_size > 0)
+            view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);   // the mapping keeps the file alive
+        if (view == MAP_FAILED) return false;
+
+        m_data = static_cast<const char*>(view);
+        m_size = static_cast<std::size_t>(info.st_size);
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (m_data) munmap(const_cast<char*>(m_data), m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+#endif
+
+} // namespace engine
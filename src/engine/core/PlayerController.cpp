@@ -1,76 +1,105 @@
 // src/engine/core/PlayerController.cpp
 #include "engine/core/PlayerController.h"
-#include <iostream>
+#include "engine/core/Components.h"
+#include <cmath>
 
 namespace engine {
 
     PlayerController::PlayerController() = default;
 
-    void PlayerController::update(float dt, float cameraPos[3], float& yaw, float& pitch, bool& mouseCaptured) {
-        const Uint8* keys = SDL_GetKeyboardState(nullptr);
-        float moveSpeed = 5.0f * dt;
+    void PlayerController::applyLook(CameraLook& look, std::int32_t dx, std::int32_t dy) {
+        if (dx == 0 && dy == 0) return;
+        look.yaw += dx * kLookDegreesPerCount;
+        look.pitch -= dy * kLookDegreesPerCount;
+        if (look.pitch > 89.0f) look.pitch = 89.0f;
+        if (look.pitch < -89.0f) look.pitch = -89.0f;
+        updateLookBasis(look);
+    }
 
-        // Forward/right vectors from yaw/pitch
-        float yawRad = yaw * 3.14159f / 180.0f;
-        float pitchRad = pitch * 3.14159f / 180.0f;
+    void PlayerController::updateLookBasis(CameraLook& look) {
+        float yawRad = look.yaw * 3.14159f / 180.0f;
+        float pitchRad = look.pitch * 3.14159f / 180.0f;
+        float cosPitch = cosf(pitchRad);
+        look.forward = math::Vec3(sinf(yawRad) * cosPitch, sinf(pitchRad), -cosf(yawRad) * cosPitch);
+        look.right = math::Vec3(cosf(yawRad), 0.0f, sinf(yawRad));
+    }
 
-        float forwardX = sinf(yawRad) * cosf(pitchRad);
-        float forwardY = sinf(pitchRad);
-        float forwardZ = -cosf(yawRad) * cosf(pitchRad);
+    void PlayerController::update(ecs::World& world, float dt, const InputState& input) {
+        float moveSpeed = 5.0f * dt;
+        int dx = input.held(kInputLook) ? input.mouseDX : 0;
+        int dy = input.held(kInputLook) ? input.mouseDY : 0;
 
-        float rightX = cosf(yawRad);
-        float rightZ = sinf(yawRad);
+        world.each<Position, CameraLook, PlayerControlled>([&](Position& position, CameraLook& look, PlayerControlled&) {
+            applyLook(look, dx, dy);
 
-        // WASD movement
-        if (keys[SDL_SCANCODE_W]) {
-            cameraPos[0] += forwardX * moveSpeed;
-            cameraPos[1] += forwardY * moveSpeed;
-            cameraPos[2] += forwardZ * moveSpeed;
-        }
-        if (keys[SDL_SCANCODE_S]) {
-            cameraPos[0] -= forwardX * moveSpeed;
-            cameraPos[1] -= forwardY * moveSpeed;
-            cameraPos[2] -= forwardZ * moveSpeed;
-        }
-        if (keys[SDL_SCANCODE_A]) {
-            cameraPos[0] -= rightX * moveSpeed;
-            cameraPos[2] -= rightZ * moveSpeed;
-        }
-        if (keys[SDL_SCANCODE_D]) {
-            cameraPos[0] += rightX * moveSpeed;
-            cameraPos[2] += rightZ * moveSpeed;
-        }
+            float forwardX = look.forward.x, forwardY = look.forward.y, forwardZ = look.forward.z;
+            float rightX = look.right.x, rightZ = look.right.z;
 
-        // Mouse look
-        if (m_rightMouseDown) {
-            if (!mouseCaptured) {
-                SDL_SetRelativeMouseMode(SDL_TRUE);
-                mouseCaptured = true;
+            // WASD movement
+            math::Vec3& p = position.value;
+            if (input.held(kInputForward)) {
+                p.x += forwardX * moveSpeed;
+                p.y += forwardY * moveSpeed;
+                p.z += forwardZ * moveSpeed;
             }
-
-            int dx, dy;
-            SDL_GetRelativeMouseState(&dx, &dy);
-            yaw += dx * 0.22f;
-            pitch -= dy * 0.22f;
-
-            if (pitch > 89.0f) pitch = 89.0f;
-            if (pitch < -89.0f) pitch = -89.0f;
-        }
-        else {
-            if (mouseCaptured) {
-                SDL_SetRelativeMouseMode(SDL_FALSE);
-                mouseCaptured = false;
+            if (input.held(kInputBack)) {
+                p.x -= forwardX * moveSpeed;
+                p.y -= forwardY * moveSpeed;
+                p.z -= forwardZ * moveSpeed;
             }
-        }
+            if (input.held(kInputLeft)) {
+                p.x -= rightX * moveSpeed;
+                p.z -= rightZ * moveSpeed;
+            }
+            if (input.held(kInputRight)) {
+                p.x += rightX * moveSpeed;
+                p.z += rightZ * moveSpeed;
+            }
+        });
     }
 
-    void PlayerController::handleEvent(const SDL_Event& event) {
-        if (event.type == SDL_MOUSEBUTTONDOWN && event.button.button == SDL_BUTTON_RIGHT) {
-            m_rightMouseDown = true;
-        }
-        if (event.type == SDL_MOUSEBUTTONUP && event.button.button == SDL_BUTTON_RIGHT) {
-            m_rightMouseDown = false;
+    void PlayerController::handleEvent(const SDL_Event& event, std::uint64_t time, InputQueue& queue) {
+        InputEvent out;
+        out.time = time;
+        switch (event.type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            if (event.key.repeat) return;
+            switch (event.key.keysym.scancode) {
+            case SDL_SCANCODE_W: out.buttons = kInputForward; break;
+            case SDL_SCANCODE_S: out.buttons = kInputBack; break;
+            case SDL_SCANCODE_A: out.buttons = kInputLeft; break;
+            case SDL_SCANCODE_D: out.buttons = kInputRight; break;
+            default: return;
+            }
+            out.type = event.type == SDL_KEYDOWN ? InputEventType::ButtonDown : InputEventType::ButtonUp;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            if (event.button.button != SDL_BUTTON_RIGHT) return;
+            out.buttons = kInputLook;
+            out.type = event.type == SDL_MOUSEBUTTONDOWN ? InputEventType::ButtonDown : InputEventType::ButtonUp;
+            m_mouseCaptured = event.type == SDL_MOUSEBUTTONDOWN;
+            SDL_SetRelativeMouseMode(m_mouseCaptured ? SDL_TRUE : SDL_FALSE);
+            break;
+        case SDL_MOUSEMOTION:
+            if (!m_mouseCaptured) return;
+            out.type = InputEventType::MouseMotion;
+            out.dx = event.motion.xrel;
+            out.dy = event.motion.yrel;
+            break;
+        case SDL_WINDOWEVENT:
+            // Key-ups sent while unfocused never arrive; let go of everything
+            if (event.window.event != SDL_WINDOWEVENT_FOCUS_LOST) return;
+            out.type = InputEventType::ButtonUp;
+            out.buttons = ~0u;
+            if (m_mouseCaptured) SDL_SetRelativeMouseMode(SDL_FALSE);
+            m_mouseCaptured = false;
+            break;
+        default:
+            return;
         }
+        queue.push(out);
     }
 
 } // namespace engine
\ No newline at end of file
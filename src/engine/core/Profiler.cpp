@@ -0,0 +1,232 @@
+// src/engine/core/Profiler.cpp
+#include "engine/core/Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+namespace engine {
+
+    // === FRAME TIME STATS ===
+    void FrameTimeStats::add(double milliseconds) {
+        m_samples[m_next] = milliseconds;
+        m_next = (m_next + 1) % kWindow;
+        if (m_count < kWindow) ++m_count;
+    }
+
+    FrameTimeStats::Summary FrameTimeStats::summary() const {
+        double sorted[kWindow];
+        std::copy(m_samples, m_samples + m_count, sorted);
+        return summarize(sorted, m_count);
+    }
+
+    FrameTimeStats::Summary FrameTimeStats::summarize(double* samples, std::size_t count) {
+        Summary result;
+        if (count == 0) return result;
+        std::sort(samples, samples + count);
+
+        // Nearest-rank percentile
+        auto rank = [&](double p) {
+            std::size_t index = static_cast<std::size_t>(std::ceil(p * count));
+            return samples[index > 0 ? index - 1 : 0];
+        };
+
+        double total = 0.0;
+        for (std::size_t i = 0; i < count; ++i) total += samples[i];
+
+        result.p50 = rank(0.50);
+        result.p95 = rank(0.95);
+        result.p99 = rank(0.99);
+        result.mean = total / count;
+        result.max = samples[count - 1];
+        result.samples = count;
+        return result;
+    }
+
+    namespace profiler {
+
+        std::uint64_t now() {
+            using namespace std::chrono;
+            return static_cast<std::uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+        }
+
+#if ENGINE_PROFILING
+        namespace {
+
+            struct Event {
+                const char* name;
+                std::uint64_t begin;
+                std::uint64_t end;
+            };
+
+            // Single-producer (owning thread) / single-consumer (collect) ring.
+            // A full ring drops the new event rather than stalling the producer.
+            struct ThreadBuffer {
+                static constexpr std::uint64_t kCapacity = 1 << 14;
+
+                Event events[kCapacity];
+                alignas(64) std::atomic<std::uint64_t> head{ 0 };
+                alignas(64) std::atomic<std::uint64_t> tail{ 0 };
+                std::atomic<std::uint64_t> dropped{ 0 };
+
+                std::uint32_t threadId = 0;
+                std::string name;   // guarded by Registry::lock
+            };
+
+            struct TraceEvent {
+                const char* name;
+                std::uint64_t begin;
+                std::uint64_t end;
+                std::uint32_t threadId;
+            };
+
+            // Buffers are never freed so events from exited threads stay readable
+            struct Registry {
+                static constexpr std::size_t kHistory = 1 << 18;
+
+                std::mutex lock;
+                std::vector<std::unique_ptr<ThreadBuffer>> threads;
+
+                std::vector<TraceEvent> history = std::vector<TraceEvent>(kHistory);
+                std::size_t historyNext = 0;
+                std::size_t historyCount = 0;
+            };
+
+            Registry& registry() {
+                static Registry* instance = new Registry();   // leaked: worker threads may record during static teardown
+                return *instance;
+            }
+
+            ThreadBuffer* addBuffer() {
+                Registry& reg = registry();
+                std::lock_guard<std::mutex> lock(reg.lock);
+                reg.threads.push_back(std::make_unique<ThreadBuffer>());
+                ThreadBuffer* buffer = reg.threads.back().get();
+                buffer->threadId = static_cast<std::uint32_t>(reg.threads.size());
+                buffer->name = "Thread " + std::to_string(buffer->threadId);
+                return buffer;
+            }
+
+            thread_local ThreadBuffer* t_buffer = nullptr;
+
+            ThreadBuffer& threadBuffer() {
+                if (!t_buffer) t_buffer = addBuffer();
+                return *t_buffer;
+            }
+
+            // A row of its own, fed by the GL thread with resolved GPU timestamps
+            ThreadBuffer& gpuBuffer() {
+                static ThreadBuffer* buffer = [] {
+                    ThreadBuffer* gpu = addBuffer();
+                    std::lock_guard<std::mutex> lock(registry().lock);
+                    gpu->name = "GPU";
+                    return gpu;
+                }();
+                return *buffer;
+            }
+
+            void push(ThreadBuffer& buffer, const char* name, std::uint64_t begin, std::uint64_t end) {
+                std::uint64_t head = buffer.head.load(std::memory_order_relaxed);
+                if (head - buffer.tail.load(std::memory_order_acquire) >= ThreadBuffer::kCapacity) {
+                    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                buffer.events[head & (ThreadBuffer::kCapacity - 1)] = { name, begin, end };
+                buffer.head.store(head + 1, std::memory_order_release);
+            }
+
+            void writeEscaped(std::ostream& out, const char* text) {
+                for (; *text; ++text) {
+                    if (*text == '"' || *text == '\\') out << '\\';
+                    out << *text;
+                }
+            }
+
+        } // namespace
+
+        void record(const char* name, std::uint64_t begin, std::uint64_t end) {
+            push(threadBuffer(), name, begin, end);
+        }
+
+        void recordGpu(const char* name, std::uint64_t begin, std::uint64_t end) {
+            push(gpuBuffer(), name, begin, end);
+        }
+
+        void setThreadName(const char* name) {
+            ThreadBuffer& buffer = threadBuffer();
+            std::lock_guard<std::mutex> lock(registry().lock);
+            buffer.name = name;
+        }
+
+        void collect() {
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.lock);
+            for (auto& buffer : reg.threads) {
+                std::uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+                std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+                for (; tail != head; ++tail) {
+                    const Event& event = buffer->events[tail & (ThreadBuffer::kCapacity - 1)];
+                    reg.history[reg.historyNext] = { event.name, event.begin, event.end, buffer->threadId };
+                    reg.historyNext = (reg.historyNext + 1) % Registry::kHistory;
+                    if (reg.historyCount < Registry::kHistory) ++reg.historyCount;
+                }
+                buffer->tail.store(tail, std::memory_order_release);
+            }
+        }
+
+        bool dumpChromeTrace(const std::string& path) {
+            collect();
+
+            std::ofstream out(path, std::ios::trunc);
+            if (!out.is_open()) {
+                std::cerr << "Profiler: failed to open " << path << " for writing" << std::endl;
+                return false;
+            }
+
+            Registry& reg = registry();
+            std::lock_guard<std::mutex> lock(reg.lock);
+
+            std::size_t first = (reg.historyNext + Registry::kHistory - reg.historyCount) % Registry::kHistory;
+            std::uint64_t epoch = reg.historyCount ? reg.history[first].begin : 0;
+            for (std::size_t i = 0; i < reg.historyCount; ++i)
+                epoch = std::min(epoch, reg.history[(first + i) % Registry::kHistory].begin);
+
+            out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+            bool comma = false;
+            std::uint64_t dropped = 0;
+            for (auto& buffer : reg.threads) {
+                out << (comma ? ",\n" : "") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                    << ",\"args\":{\"name\":\"";
+                writeEscaped(out, buffer->name.c_str());
+                out << "\"}}";
+                comma = true;
+                dropped += buffer->dropped.load(std::memory_order_relaxed);
+            }
+
+            out.setf(std::ios::fixed);
+            out.precision(3);
+            for (std::size_t i = 0; i < reg.historyCount; ++i) {
+                const TraceEvent& event = reg.history[(first + i) % Registry::kHistory];
+                out << (comma ? ",\n" : "") << "{\"name\":\"";
+                writeEscaped(out, event.name);
+                out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.threadId
+                    << ",\"ts\":" << (event.begin - epoch) / 1000.0
+                    << ",\"dur\":" << (event.end - event.begin) / 1000.0 << "}";
+                comma = true;
+            }
+            out << "\n]}\n";
+
+            std::cout << "Profiler: wrote " << reg.historyCount << " events to " << path;
+            if (dropped) std::cout << " (" << dropped << " dropped on full thread buffers)";
+            std::cout << std::endl;
+            return true;
+        }
+#endif
+
+    } // namespace profiler
+
+} // namespace engine
@@ -0,0 +1,269 @@
+// src/engine/core/Replay.cpp
+#include "engine/core/Replay.h"
+#include <cstring>
+#include <iostream>
+
+namespace engine {
+
+    namespace {
+
+        // File layout: Header, then back-to-back RecordHeader + payload
+        constexpr std::uint32_t kMagic = 0x52545345;   // "ESTR"
+        constexpr std::uint32_t kVersion = 1;
+
+        struct Header {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t stateBytes;
+            std::uint64_t layout;
+        };
+
+        struct RecordHeader {
+            std::uint64_t tick;
+            std::uint32_t bytes;      // payload
+            std::uint32_t keyframe;   // 1 = payload is the whole state, 0 = delta from the record before
+            std::uint32_t buttons;
+            std::int32_t mouseDX;
+            std::int32_t mouseDY;
+            std::uint32_t reserved;
+        };
+
+        // Unchanged stretches shorter than this stay inside a literal; coding
+        // them as a skip would cost more count bytes than it saves
+        constexpr std::size_t kGapWords = 2;
+        constexpr std::size_t kMaxCountBytes = 10;   // LEB128 of 64 bits
+
+        std::uint64_t loadWord(const std::byte* p) {
+            std::uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            return word;
+        }
+
+        // out = a ^ b; out may alias a
+        void xorBytes(std::byte* out, const std::byte* a, const std::byte* b, std::size_t count) {
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                std::uint64_t word = loadWord(a + i) ^ loadWord(b + i);
+                std::memcpy(out + i, &word, sizeof(word));
+            }
+            for (; i < count; ++i) out[i] = a[i] ^ b[i];
+        }
+
+        std::byte* putCount(std::byte* out, std::size_t value) {
+            while (value >= 0x80) {
+                *out++ = static_cast<std::byte>((value & 0x7F) | 0x80);
+                value >>= 7;
+            }
+            *out++ = static_cast<std::byte>(value);
+            return out;
+        }
+
+        bool getCount(const std::byte*& in, const std::byte* end, std::size_t& value) {
+            value = 0;
+            for (int shift = 0; in < end && shift < 64; shift += 7) {
+                std::size_t byte = static_cast<std::size_t>(*in++);
+                value |= (byte & 0x7F) << shift;
+                if (!(byte & 0x80)) return true;
+            }
+            return false;
+        }
+
+        std::byte* putRun(std::byte* out, std::size_t skip, const std::byte* from, const std::byte* to, std::size_t count) {
+            out = putCount(out, skip);
+            out = putCount(out, count);
+            xorBytes(out, from, to, count);
+            return out + count;
+        }
+
+    } // namespace
+
+    // === DELTAS ===
+    std::size_t maxDeltaBytes(std::size_t stateBytes) {
+        // Every run but the tail covers a word, so there are at most this many
+        std::size_t runs = stateBytes / 8 + 2;
+        return stateBytes + runs * 2 * kMaxCountBytes;
+    }
+
+    std::size_t encodeDelta(const std::byte* from, const std::byte* to, std::size_t stateBytes, std::byte* out) {
+        std::byte* cursor = out;
+        std::size_t written = 0;   // state bytes covered by the runs so far
+        std::size_t words = stateBytes / 8;
+        for (std::size_t w = 0; w < words;) {
+            if (loadWord(from + w * 8) == loadWord(to + w * 8)) {
+                ++w;
+                continue;
+            }
+            // Extend the literal until kGapWords unchanged words in a row
+            std::size_t first = w, last = w;
+            for (++w; w < words && w - last <= kGapWords; ++w)
+                if (loadWord(from + w * 8) != loadWord(to + w * 8)) last = w;
+            std::size_t begin = first * 8, end = (last + 1) * 8;
+            cursor = putRun(cursor, begin - written, from + begin, to + begin, end - begin);
+            written = end;
+            w = last + 1;
+        }
+        std::size_t tail = words * 8;
+        if (tail < stateBytes && std::memcmp(from + tail, to + tail, stateBytes - tail) != 0)
+            cursor = putRun(cursor, tail - written, from + tail, to + tail, stateBytes - tail);
+        return static_cast<std::size_t>(cursor - out);
+    }
+
+    bool applyDelta(const std::byte* delta, std::size_t deltaBytes, std::byte* state, std::size_t stateBytes) {
+        const std::byte* in = delta;
+        const std::byte* end = delta + deltaBytes;
+        std::size_t position = 0;
+        while (in < end) {
+            std::size_t skip, count;
+            if (!getCount(in, end, skip) || !getCount(in, end, count)) return false;
+            if (skip > stateBytes - position || count > stateBytes - position - skip
+                || count > static_cast<std::size_t>(end - in))
+                return false;
+            position += skip;
+            xorBytes(state + position, state + position, in, count);
+            position += count;
+            in += count;
+        }
+        return true;
+    }
+
+    // === RECORDER ===
+    bool StateRecorder::open(const std::string& path, std::size_t stateBytes, std::uint64_t layout) {
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open()) {
+            std::cerr << "Failed to open state recording for writing: " << path << std::endl;
+            return false;
+        }
+        m_stateBytes = stateBytes;
+        m_previous.assign(stateBytes, std::byte{ 0 });
+        m_delta.resize(maxDeltaBytes(stateBytes));
+        m_deltaBytesSinceKeyframe = 0;
+        m_stats = {};
+        Header header{ kMagic, kVersion, stateBytes, layout };
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_stats.bytes = sizeof(header);
+        return true;
+    }
+
+    void StateRecorder::write(std::uint64_t tick, const InputState& input, const std::byte* state) {
+        if (!m_file.is_open()) return;
+        bool keyframe = m_stats.records == 0;
+        std::size_t bytes = 0;
+        if (!keyframe) {
+            bytes = encodeDelta(m_previous.data(), state, m_stateBytes, m_delta.data());
+            keyframe = m_deltaBytesSinceKeyframe + bytes > m_stateBytes;
+        }
+        if (keyframe) {
+            bytes = m_stateBytes;
+            m_deltaBytesSinceKeyframe = 0;
+            ++m_stats.keyframes;
+        }
+        else {
+            m_deltaBytesSinceKeyframe += bytes;
+        }
+
+        RecordHeader record{ tick, static_cast<std::uint32_t>(bytes), keyframe ? 1u : 0u,
+                             input.buttons, input.mouseDX, input.mouseDY, 0 };
+        m_file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        m_file.write(reinterpret_cast<const char*>(keyframe ? state : m_delta.data()), bytes);
+        m_file.flush();
+        std::memcpy(m_previous.data(), state, m_stateBytes);
+        ++m_stats.records;
+        m_stats.bytes += sizeof(record) + bytes;
+    }
+
+    void StateRecorder::close() {
+        if (!m_file.is_open()) return;
+        m_file.close();
+        std::cout << "Recorded " << m_stats.records << " state ticks (" << m_stats.keyframes << " keyframes, "
+            << m_stats.bytes / 1024 << " KB)" << std::endl;
+    }
+
+    // === REPLAY ===
+    bool StateReplay::open(const std::string& path, std::size_t stateBytes, std::uint64_t layout) {
+        m_records.clear();
+        m_keyframeOf.clear();
+        m_valid = false;
+
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open state recording: " << path << std::endl;
+            return false;
+        }
+        m_stream.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(m_stream.data()), static_cast<std::streamsize>(m_stream.size()));
+
+        Header header{};
+        if (file && m_stream.size() >= sizeof(header)) std::memcpy(&header, m_stream.data(), sizeof(header));
+        if (header.magic != kMagic || header.version != kVersion) {
+            std::cerr << "Not a state recording (or wrong version): " << path << std::endl;
+            return false;
+        }
+        if (header.stateBytes != stateBytes || header.layout != layout) {
+            std::cerr << "State recording " << path << " was made with a different scene (entities or state size differ)" << std::endl;
+            return false;
+        }
+
+        // Index every complete record; stop at a torn or inconsistent one
+        std::size_t offset = sizeof(header);
+        while (offset + sizeof(RecordHeader) <= m_stream.size()) {
+            RecordHeader record;
+            std::memcpy(&record, m_stream.data() + offset, sizeof(record));
+            offset += sizeof(record);
+            bool keyframe = record.keyframe != 0;
+            if (record.bytes > m_stream.size() - offset) break;
+            if (keyframe ? record.bytes != stateBytes : m_records.empty()) break;
+            if (!m_records.empty() && record.tick != m_firstTick + m_records.size()) break;
+
+            if (m_records.empty()) m_firstTick = record.tick;
+            InputState input;
+            input.buttons = record.buttons;
+            input.mouseDX = record.mouseDX;
+            input.mouseDY = record.mouseDY;
+            m_keyframeOf.push_back(keyframe ? static_cast<std::uint32_t>(m_records.size()) : m_keyframeOf.back());
+            m_records.push_back({ offset, record.bytes, keyframe, input });
+            offset += record.bytes;
+        }
+        if (m_records.empty()) {
+            std::cerr << "State recording has no complete ticks: " << path << std::endl;
+            return false;
+        }
+        m_state.assign(stateBytes, std::byte{ 0 });
+        return true;
+    }
+
+    bool StateReplay::apply(std::size_t record) {
+        const Record& r = m_records[record];
+        ++m_applied;
+        if (r.keyframe) {
+            std::memcpy(m_state.data(), m_stream.data() + r.payload, r.bytes);
+            return true;
+        }
+        return applyDelta(m_stream.data() + r.payload, r.bytes, m_state.data(), m_state.size());
+    }
+
+    bool StateReplay::seek(std::uint64_t tick) {
+        m_applied = 0;
+        if (!isOpen() || tick < m_firstTick || tick > lastTick()) return false;
+        std::size_t target = static_cast<std::size_t>(tick - m_firstTick);
+        std::size_t keyframe = m_keyframeOf[target];
+        std::size_t current = static_cast<std::size_t>(m_tick - m_firstTick);
+
+        bool ok = true;
+        if (m_valid && current <= target && current >= keyframe) {
+            for (std::size_t r = current + 1; r <= target && ok; ++r) ok = apply(r);
+        }
+        else if (m_valid && current > target && m_keyframeOf[current] <= target && current - target <= target - keyframe) {
+            // A delta XORed in again undoes itself
+            for (std::size_t r = current; r > target && ok; --r) ok = apply(r);
+        }
+        else {
+            ok = apply(keyframe);
+            for (std::size_t r = keyframe + 1; r <= target && ok; ++r) ok = apply(r);
+        }
+        m_valid = ok;
+        m_tick = tick;
+        return ok;
+    }
+
+} // namespace engine
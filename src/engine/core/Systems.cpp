@@ -0,0 +1,121 @@
+// src/engine/core/Systems.cpp
+#include "engine/core/Systems.h"
+#include "engine/core/Components.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Profiler.h"
+#include "engine/render/TransformHierarchy.h"
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+namespace engine {
+
+    namespace {
+
+        // Snapshot of one chunk's columns plus the running entity offset, so
+        // chunks can be handed to jobs after the (single-threaded) query walk
+        template <typename... Ts>
+        struct ChunkView {
+            std::size_t count;
+            std::size_t first;
+            std::tuple<Ts*...> columns;
+        };
+
+        template <typename... Ts>
+        std::size_t collectChunks(ecs::World& world, std::pmr::vector<ChunkView<Ts...>>& out) {
+            std::size_t total = 0;
+            world.eachChunk<Ts...>([&](std::size_t count, const ecs::Entity*, Ts*... columns) {
+                out.push_back({ count, total, std::tuple<Ts*...>(columns...) });
+                total += count;
+            });
+            return total;
+        }
+
+    } // namespace
+
+    void snapshotSystem(ecs::World& world, JobSystem& jobs, std::pmr::memory_resource* scratch) {
+        ENGINE_PROFILE_SCOPE("snapshotSystem");
+        std::pmr::vector<ChunkView<Position, Rotation, PreviousTransform>> chunks(scratch);
+        collectChunks(world, chunks);
+        jobs.parallelFor(chunks.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                auto [positions, rotations, previous] = chunks[c].columns;
+                for (std::size_t i = 0; i < chunks[c].count; ++i) {
+                    previous[i].position = positions[i].value;
+                    previous[i].rotation = rotations[i].value;
+                }
+            }
+        });
+    }
+
+    void spinSystem(ecs::World& world, float dt, JobSystem& jobs, std::pmr::memory_resource* scratch) {
+        ENGINE_PROFILE_SCOPE("spinSystem");
+        std::pmr::vector<ChunkView<Spin, Rotation>> chunks(scratch);
+        collectChunks(world, chunks);
+        jobs.parallelFor(chunks.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                auto [spins, rotations] = chunks[c].columns;
+                for (std::size_t i = 0; i < chunks[c].count; ++i) {
+                    Spin& spin = spins[i];
+                    spin.angle += spin.degreesPerSecond * dt;
+                    if (spin.angle >= 360.0f) spin.angle -= 360.0f;
+                    rotations[i].value = math::quatFromAxisAngle(spin.axis, spin.angle * 3.14159f / 180.0f);
+                }
+            }
+        });
+    }
+
+    void sceneSyncSystem(ecs::World& world, TransformHierarchy& scene, float alpha, JobSystem& jobs,
+                         std::pmr::memory_resource* scratch) {
+        ENGINE_PROFILE_SCOPE("sceneSyncSystem");
+        std::pmr::vector<ChunkView<Position, Rotation, PreviousTransform, Scale, SceneNode>> chunks(scratch);
+        collectChunks(world, chunks);
+        jobs.parallelFor(chunks.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                auto [positions, rotations, previous, scales, nodes] = chunks[c].columns;
+                for (std::size_t i = 0; i < chunks[c].count; ++i) {
+                    scene.setLocal(nodes[i].node,
+                                   math::lerp(previous[i].position, positions[i].value, alpha),
+                                   math::nlerp(previous[i].rotation, rotations[i].value, alpha),
+                                   scales[i].value);
+                }
+            }
+        });
+    }
+
+    void renderPrepSystem(ecs::World& world, const TransformHierarchy& scene, std::vector<std::uint32_t>& meshes,
+                          std::vector<std::uint32_t>& nodes, std::vector<math::Aabb>& bounds,
+                          const std::vector<float>& meshRadius, JobSystem& jobs, std::pmr::memory_resource* scratch) {
+        ENGINE_PROFILE_SCOPE("renderPrepSystem");
+        std::pmr::vector<ChunkView<SceneNode, Renderable>> chunks(scratch);
+        std::size_t total = collectChunks(world, chunks);
+        meshes.resize(total);
+        nodes.resize(total);
+        bounds.resize(total);
+        const math::Mat4* worlds = scene.worldMatrices();
+        jobs.parallelFor(chunks.size(), 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                auto [sceneNodes, renderables] = chunks[c].columns;
+                for (std::size_t i = 0; i < chunks[c].count; ++i) {
+                    std::size_t slot = chunks[c].first + i;
+                    std::uint32_t index = scene.indexOf(sceneNodes[i].node);
+                    std::uint32_t mesh = renderables[i].mesh;
+                    meshes[slot] = mesh;
+                    nodes[slot] = index;
+
+                    // Longest basis vector = largest world scale, parents included
+                    const float* m = worlds[index].m;
+                    float scale2 = 0.0f;
+                    for (int axis = 0; axis < 3; ++axis) {
+                        const float* column = m + axis * 4;
+                        scale2 = std::max(scale2, column[0] * column[0] + column[1] * column[1] + column[2] * column[2]);
+                    }
+                    float radius = (mesh < meshRadius.size() ? meshRadius[mesh] : 0.0f) * std::sqrt(scale2);
+                    math::Vec3 p(m[12], m[13], m[14]);
+                    bounds[slot] = { math::Vec3(p.x - radius, p.y - radius, p.z - radius), math::Vec3(p.x + radius, p.y + radius, p.z + radius) };
+                }
+            }
+        });
+    }
+
+} // namespace engine
@@ -1,11 +1,20 @@
-
 #include "engine/core/Engine.h"
+#include "engine/core/EngineConfig.h"
+#include "engine/core/JobBenchmark.h"
+#include <cstring>
 #include <iostream>
 
 int main(int argc, char* argv[]) {
+    if (argc > 1 && std::strcmp(argv[1], "--bench-jobs") == 0) {
+        return engine::runJobBenchmark(argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 0);
+    }
+
+    engine::EngineConfig config;
+    if (!engine::parseEngineConfig(argc, argv, config)) return 2;
+
     engine::Engine engine;
 
-    if (!engine.initialize()) {
+    if (!engine.initialize(config)) {
         std::cerr << "Failed to initialize engine!" << std::endl;
         return -1;
     }
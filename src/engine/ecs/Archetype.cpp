@@ -0,0 +1,91 @@
+// src/engine/ecs/Archetype.cpp
+#include "engine/ecs/Archetype.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+namespace engine::ecs {
+
+    // === COMPONENT REGISTRY ===
+    namespace {
+        std::array<ComponentInfo, kMaxComponents> g_componentInfo;
+        std::atomic<ComponentId> g_componentCount{ 0 };
+    }
+
+    ComponentId detail::registerComponent(std::size_t size, std::size_t align, bool tag) {
+        ComponentId id = g_componentCount.fetch_add(1);
+        assert(id < kMaxComponents && "raise kMaxComponents");
+        assert(align <= Archetype::kColumnAlign);
+        g_componentInfo[id] = { size, align, tag };
+        return id;
+    }
+
+    const ComponentInfo& componentInfo(ComponentId id) {
+        return g_componentInfo[id];
+    }
+
+    // === ARCHETYPE ===
+    namespace {
+        std::size_t alignUp(std::size_t value, std::size_t align) {
+            return (value + align - 1) & ~(align - 1);
+        }
+    }
+
+    Archetype::Archetype(ComponentMask mask, memory::PoolAllocator& chunkPool) : m_chunkPool(chunkPool), m_mask(mask) {
+        assert(chunkPool.blockSize() >= kChunkBytes && chunkPool.alignment() >= kColumnAlign);
+        std::size_t rowBytes = sizeof(Entity);
+        for (ComponentId id = 0; id < kMaxComponents; ++id) {
+            if (mask & componentBit(id)) {
+                m_components.push_back(id);
+                rowBytes += componentInfo(id).size;
+            }
+        }
+
+        // Largest row count whose entity array plus cache-line aligned columns fit the chunk
+        std::size_t worstPadding = (m_components.size() + 1) * kColumnAlign;
+        m_capacity = std::max<std::size_t>(1, (kChunkBytes - worstPadding) / rowBytes);
+        for (;; --m_capacity) {
+            std::size_t offset = alignUp(m_capacity * sizeof(Entity), kColumnAlign);
+            for (ComponentId id : m_components) {
+                m_offsets[id] = offset;
+                offset = alignUp(offset + m_capacity * componentInfo(id).size, kColumnAlign);
+            }
+            if (offset <= kChunkBytes || m_capacity == 1) break;
+        }
+    }
+
+    Archetype::~Archetype() {
+        for (std::byte* chunk : m_chunks) m_chunkPool.deallocate(chunk);
+    }
+
+    std::size_t Archetype::allocate(Entity e) {
+        std::size_t row = m_count;
+        if (row / m_capacity >= m_chunks.size()) {
+            m_chunks.push_back(static_cast<std::byte*>(m_chunkPool.allocate()));
+        }
+        entities(row / m_capacity)[row % m_capacity] = e;
+        ++m_count;
+        return row;
+    }
+
+    Entity Archetype::removeSwap(std::size_t row) {
+        std::size_t last = m_count - 1;
+        Entity moved{};
+        if (row != last) {
+            moved = entityAt(last);
+            entities(row / m_capacity)[row % m_capacity] = moved;
+            for (ComponentId id : m_components) {
+                std::memcpy(component(row, id), component(last, id), componentInfo(id).size);
+            }
+        }
+        --m_count;
+        // Keep one spare chunk around so an add/remove at a boundary does not thrash the allocator
+        while (m_chunks.size() > chunkCount() + 1) {
+            m_chunkPool.deallocate(m_chunks.back());
+            m_chunks.pop_back();
+        }
+        return moved;
+    }
+
+} // namespace engine::ecs
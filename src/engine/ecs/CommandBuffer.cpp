@@ -0,0 +1,84 @@
+// src/engine/ecs/CommandBuffer.cpp
+#include "engine/ecs/CommandBuffer.h"
+#include <cassert>
+#include <cstring>
+
+namespace engine::ecs {
+
+    CommandBuffer::~CommandBuffer() {
+        clear();
+    }
+
+    Entity CommandBuffer::create() {
+        Entity placeholder{ m_pendingCount++, kPendingGeneration };
+        record(Op::Create, placeholder, 0, nullptr, 0);
+        return placeholder;
+    }
+
+    void CommandBuffer::destroy(Entity e) {
+        record(Op::Destroy, e, 0, nullptr, 0);
+    }
+
+    void CommandBuffer::record(Op op, Entity e, ComponentId id, const void* data, std::size_t size) {
+        std::size_t bytes = recordBytes(size);
+        assert(kPageHeader + bytes <= kPageBytes && "component too large for a command page");
+
+        if (!m_last || m_last->used + bytes > kPageBytes) {
+            Page* page = static_cast<Page*>(m_pages.allocate());
+            page->next = nullptr;
+            page->used = kPageHeader;
+            if (m_last) m_last->next = page;
+            else m_first = page;
+            m_last = page;
+        }
+
+        std::byte* at = reinterpret_cast<std::byte*>(m_last) + m_last->used;
+        Command* cmd = reinterpret_cast<Command*>(at);
+        *cmd = { op, id, static_cast<std::uint32_t>(size), e };
+        if (size) std::memcpy(cmd + 1, data, size);
+        m_last->used += bytes;
+        ++m_commandCount;
+    }
+
+    void CommandBuffer::playback(World& world) {
+        m_created.resize(m_pendingCount);
+        auto resolve = [&](Entity e) {
+            return e.generation == kPendingGeneration ? m_created[e.index] : e;
+        };
+
+        for (Page* page = m_first; page; page = page->next) {
+            const std::byte* base = reinterpret_cast<const std::byte*>(page);
+            for (std::size_t offset = kPageHeader; offset < page->used;) {
+                const Command& cmd = *reinterpret_cast<const Command*>(base + offset);
+                switch (cmd.op) {
+                case Op::Create:
+                    m_created[cmd.entity.index] = world.create();
+                    break;
+                case Op::Destroy:
+                    world.destroy(resolve(cmd.entity));
+                    break;
+                case Op::Add:
+                    world.addRaw(resolve(cmd.entity), cmd.component, &cmd + 1);
+                    break;
+                case Op::Remove:
+                    world.removeRaw(resolve(cmd.entity), cmd.component);
+                    break;
+                }
+                offset += recordBytes(cmd.payloadSize);
+            }
+        }
+        clear();
+    }
+
+    void CommandBuffer::clear() {
+        while (m_first) {
+            Page* next = m_first->next;
+            m_pages.deallocate(m_first);
+            m_first = next;
+        }
+        m_last = nullptr;
+        m_commandCount = 0;
+        m_pendingCount = 0;
+    }
+
+} // namespace engine::ecs
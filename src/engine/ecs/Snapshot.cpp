@@ -0,0 +1,72 @@
+// src/engine/ecs/Snapshot.cpp
+#include "engine/ecs/Snapshot.h"
+#include <cstring>
+
+namespace engine::ecs {
+
+    namespace {
+
+        // FNV-1a, 64-bit
+        void hashBytes(std::uint64_t& hash, const void* data, std::size_t size) {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= 0x100000001B3ull;
+            }
+        }
+
+        // fn(column pointer, bytes) for every stateful column of every non-empty chunk, in a fixed order
+        template <typename Fn>
+        void forEachColumn(const World& world, Fn&& fn) {
+            for (const auto& arch : world.archetypes()) {
+                for (std::size_t c = 0; c < arch->chunkCount(); ++c) {
+                    std::size_t rows = arch->chunkSize(c);
+                    for (ComponentId id : arch->components()) {
+                        const ComponentInfo& info = componentInfo(id);
+                        if (info.tag) continue;
+                        fn(arch->chunkData(c) + arch->columnOffset(id), rows * info.size);
+                    }
+                }
+            }
+        }
+
+    } // namespace
+
+    std::size_t columnBytes(const World& world) {
+        std::size_t total = 0;
+        forEachColumn(world, [&](std::byte*, std::size_t bytes) { total += bytes; });
+        return total;
+    }
+
+    std::uint64_t layoutHash(const World& world) {
+        std::uint64_t hash = 0xCBF29CE484222325ull;
+        for (const auto& arch : world.archetypes()) {
+            ComponentMask mask = arch->mask();
+            std::uint64_t rows = arch->size();
+            hashBytes(hash, &mask, sizeof(mask));
+            hashBytes(hash, &rows, sizeof(rows));
+            for (ComponentId id : arch->components()) {
+                std::uint64_t size = componentInfo(id).size;
+                hashBytes(hash, &size, sizeof(size));
+            }
+            for (std::size_t c = 0; c < arch->chunkCount(); ++c)
+                hashBytes(hash, arch->entities(c), arch->chunkSize(c) * sizeof(Entity));
+        }
+        return hash;
+    }
+
+    void saveColumns(const World& world, std::byte* out) {
+        forEachColumn(world, [&](const std::byte* column, std::size_t bytes) {
+            std::memcpy(out, column, bytes);
+            out += bytes;
+        });
+    }
+
+    void loadColumns(World& world, const std::byte* in) {
+        forEachColumn(world, [&](std::byte* column, std::size_t bytes) {
+            std::memcpy(column, in, bytes);
+            in += bytes;
+        });
+    }
+
+} // namespace engine::ecs
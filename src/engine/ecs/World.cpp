@@ -0,0 +1,85 @@
+// src/engine/ecs/World.cpp
+#include "engine/ecs/World.h"
+#include <cassert>
+
+namespace engine::ecs {
+
+    World::World() = default;
+    World::~World() = default;
+
+    Entity World::allocateEntity() {
+        std::uint32_t index;
+        if (!m_freeList.empty()) {
+            index = m_freeList.back();
+            m_freeList.pop_back();
+        }
+        else {
+            index = static_cast<std::uint32_t>(m_records.size());
+            m_records.emplace_back();
+        }
+        ++m_alive;
+        return Entity{ index, m_records[index].generation };
+    }
+
+    Archetype& World::archetypeFor(ComponentMask mask) {
+        auto it = m_archetypeByMask.find(mask);
+        if (it != m_archetypeByMask.end()) return *it->second;
+        m_archetypes.push_back(std::make_unique<Archetype>(mask, m_chunkPool));
+        Archetype* arch = m_archetypes.back().get();
+        m_archetypeByMask.emplace(mask, arch);
+        return *arch;
+    }
+
+    Entity World::create() {
+        Entity e = allocateEntity();
+        Archetype& arch = archetypeFor(0);
+        m_records[e.index].archetype = &arch;
+        m_records[e.index].row = arch.allocate(e);
+        return e;
+    }
+
+    bool World::alive(Entity e) const {
+        return e.index < m_records.size() && m_records[e.index].generation == e.generation && m_records[e.index].archetype;
+    }
+
+    void World::relocated(Entity moved, std::size_t row) {
+        if (!moved.isNull()) m_records[moved.index].row = row;
+    }
+
+    void World::destroy(Entity e) {
+        if (!alive(e)) return;
+        Record& r = m_records[e.index];
+        relocated(r.archetype->removeSwap(r.row), r.row);
+        r.archetype = nullptr;
+        if (++r.generation == 0) r.generation = 1;   // skip the null generation on wrap
+        m_freeList.push_back(e.index);
+        --m_alive;
+    }
+
+    void World::moveToArchetype(Entity e, Archetype& target) {
+        Record& r = m_records[e.index];
+        Archetype& source = *r.archetype;
+        std::size_t newRow = target.allocate(e);
+        for (ComponentId id : target.components()) {
+            if (source.has(id)) std::memcpy(target.component(newRow, id), source.component(r.row, id), componentInfo(id).size);
+        }
+        relocated(source.removeSwap(r.row), r.row);
+        r.archetype = &target;
+        r.row = newRow;
+    }
+
+    void World::addRaw(Entity e, ComponentId id, const void* data) {
+        if (!alive(e)) return;
+        Record& r = m_records[e.index];
+        if (!r.archetype->has(id)) moveToArchetype(e, archetypeFor(r.archetype->mask() | componentBit(id)));
+        std::memcpy(r.archetype->component(r.row, id), data, componentInfo(id).size);
+    }
+
+    void World::removeRaw(Entity e, ComponentId id) {
+        if (!alive(e)) return;
+        Record& r = m_records[e.index];
+        if (!r.archetype->has(id)) return;
+        moveToArchetype(e, archetypeFor(r.archetype->mask() & ~componentBit(id)));
+    }
+
+} // namespace engine::ecs
@@ -1,19 +1,371 @@
 // src/engine/math/Math.cpp
 #include "engine/math/Math.h"
+#include "MathKernels.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+
+#if defined(_MSC_VER) && defined(ENGINE_MATH_X86)
+#include <intrin.h>
+#endif
 
 namespace engine::math {
 
+    // === SCALAR REFERENCE ===
+    namespace scalar {
+
+        void mul(float* out, const float* a, const float* b) {
+            float temp[16];
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j) {
+                    temp[i * 4 + j] = 0;
+                    for (int k = 0; k < 4; ++k)
+                        temp[i * 4 + j] += a[i * 4 + k] * b[k * 4 + j];
+                }
+            std::memcpy(out, temp, sizeof(temp));
+        }
+
+        void transpose(float* out, const float* m) {
+            float temp[16];
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    temp[j * 4 + i] = m[i * 4 + j];
+            std::memcpy(out, temp, sizeof(temp));
+        }
+
+        bool inverse(float* out, const float* m) {
+            // Cofactor expansion; the layout does not matter since inv(M^T) = inv(M)^T
+            float inv[16];
+            inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+            inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+            inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+            inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+            inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+            inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+            inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+            inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+            inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+            inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+            inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+            inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+            inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+            inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+            inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+            inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+            float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+            if (det == 0.0f) return false;
+
+            float invDet = 1.0f / det;
+            for (int i = 0; i < 16; ++i) out[i] = inv[i] * invDet;
+            return true;
+        }
+
+        Vec3 transformPoint(const float* m, const Vec3& p) {
+            return Vec3(
+                m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12],
+                m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13],
+                m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14]);
+        }
+
+        void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) scalar::mul(out[i].m, a[i].m, b[i].m);
+        }
+
+        void mulBatch(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) scalar::mul(out[i].m, a[i].m, b.m);
+        }
+
+        void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i) out[i] = scalar::transformPoint(m.m, points[i]);
+        }
+
+        unsigned frustumTest8(const Frustum& frustum, const float* boxes) {
+            // Per plane, the box corner furthest along the normal: max(a * min, a * max) per axis.
+            // The SIMD kernels sum in the same order, so all levels agree bit for bit.
+            unsigned mask = 0;
+            for (std::size_t i = 0; i < kFrustumLanes; ++i) {
+                bool inside = true;
+                for (int p = 0; p < 6 && inside; ++p) {
+                    const float* plane = frustum.planes[p];
+                    float x = std::fmax(plane[0] * boxes[i], plane[0] * boxes[24 + i]);
+                    float y = std::fmax(plane[1] * boxes[8 + i], plane[1] * boxes[32 + i]);
+                    float z = std::fmax(plane[2] * boxes[16 + i], plane[2] * boxes[40 + i]);
+                    inside = x + y + z + plane[3] >= 0.0f;
+                }
+                if (inside) mask |= 1u << i;
+            }
+            return mask;
+        }
+
+    } // namespace scalar
+
+    // === RUNTIME DISPATCH ===
+    namespace {
+
+        void scalarMulBatchShared(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count) {
+            scalar::mulBatch(out, a, b, count);
+        }
+
+        const detail::Kernels kScalarKernels = {
+            scalar::mul,
+            scalar::transpose,
+            scalar::inverse,
+            scalar::transformPoint,
+            scalar::mulBatch,
+            scalarMulBatchShared,
+            scalar::transformPointBatch,
+            scalar::frustumTest8,
+        };
+
+        bool cpuHasAvx2() {
+#if defined(ENGINE_MATH_X86) && (defined(__GNUC__) || defined(__clang__))
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#elif defined(ENGINE_MATH_X86) && defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool fma = (info[2] & (1 << 12)) != 0;
+            if (!osxsave || !fma) return false;
+            if ((_xgetbv(0) & 0x6) != 0x6) return false;   // OS saves YMM state
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            return false;
+#endif
+        }
+
+        const detail::Kernels* kernelsFor(SimdLevel level) {
+            switch (level) {
+            case SimdLevel::Scalar: return &kScalarKernels;
+            case SimdLevel::SSE2:   return detail::sse2Kernels();
+            case SimdLevel::AVX2:   return cpuHasAvx2() ? detail::avx2Kernels() : nullptr;
+            case SimdLevel::NEON:   return detail::neonKernels();
+            }
+            return nullptr;
+        }
+
+        SimdLevel bestLevel() {
+            if (const char* env = std::getenv("ENGINE_SIMD")) {
+                const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON };
+                for (SimdLevel level : levels) {
+                    if (std::strcmp(env, simdLevelName(level)) == 0 && kernelsFor(level)) return level;
+                }
+                std::cerr << "ENGINE_SIMD=" << env << " not available, using best detected level\n";
+            }
+            if (kernelsFor(SimdLevel::AVX2)) return SimdLevel::AVX2;
+            if (kernelsFor(SimdLevel::SSE2)) return SimdLevel::SSE2;
+            if (kernelsFor(SimdLevel::NEON)) return SimdLevel::NEON;
+            return SimdLevel::Scalar;
+        }
+
+        struct Dispatch {
+            std::atomic<const detail::Kernels*> kernels;
+            std::atomic<SimdLevel> level;
+
+            Dispatch() {
+                SimdLevel best = bestLevel();
+                kernels.store(kernelsFor(best));
+                level.store(best);
+            }
+        };
+
+        Dispatch& dispatch() {
+            static Dispatch instance;
+            return instance;
+        }
+
+        inline const detail::Kernels& active() {
+            return *dispatch().kernels.load(std::memory_order_relaxed);
+        }
+
+    } // namespace
+
+    SimdLevel simdLevel() {
+        return dispatch().level.load();
+    }
+
+    bool simdLevelSupported(SimdLevel level) {
+        return kernelsFor(level) != nullptr;
+    }
+
+    bool setSimdLevel(SimdLevel level) {
+        const detail::Kernels* kernels = kernelsFor(level);
+        if (!kernels) return false;
+        dispatch().kernels.store(kernels);
+        dispatch().level.store(level);
+        return true;
+    }
+
+    const char* simdLevelName(SimdLevel level) {
+        switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::SSE2:   return "sse2";
+        case SimdLevel::AVX2:   return "avx2";
+        case SimdLevel::NEON:   return "neon";
+        }
+        return "unknown";
+    }
+
+    // === DISPATCHED ENTRY POINTS ===
     void mul(float* out, const float* a, const float* b) {
-        float temp[16];
-        for (int i = 0; i < 4; ++i)
-            for (int j = 0; j < 4; ++j) {
-                temp[i * 4 + j] = 0;
-                for (int k = 0; k < 4; ++k)
-                    temp[i * 4 + j] += a[i * 4 + k] * b[k * 4 + j];
+        active().mul(out, a, b);
+    }
+
+    void transpose(float* out, const float* m) {
+        active().transpose(out, m);
+    }
+
+    bool inverse(float* out, const float* m) {
+        return active().inverse(out, m);
+    }
+
+    Vec3 transformPoint(const float* m, const Vec3& p) {
+        return active().transformPoint(m, p);
+    }
+
+    void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count) {
+        active().mulBatch(out, a, b, count);
+    }
+
+    void mulBatch(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count) {
+        active().mulBatchShared(out, a, b, count);
+    }
+
+    void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count) {
+        active().transformPointBatch(out, m, points, count);
+    }
+
+    unsigned frustumTest8(const Frustum& frustum, const float* boxes) {
+        return active().frustumTest8(frustum, boxes);
+    }
+
+    // === SELF CHECK ===
+    namespace {
+
+        struct Lcg {
+            unsigned int state = 0x1234567u;
+            float next() {   // [-2, 2)
+                state = state * 1664525u + 1013904223u;
+                return (state >> 8) * (4.0f / 16777216.0f) - 2.0f;
+            }
+        };
+
+        bool nearlyEqual(const float* a, const float* b, int count, float tolerance) {
+            for (int i = 0; i < count; ++i) {
+                float scale = std::fmax(1.0f, std::fmax(std::fabs(a[i]), std::fabs(b[i])));
+                if (std::fabs(a[i] - b[i]) > tolerance * scale) return false;
+            }
+            return true;
+        }
+
+        bool verifyLevel(SimdLevel level, const detail::Kernels& k) {
+            constexpr std::size_t kCount = 64;
+            Lcg rng;
+            Mat4 a[kCount], b[kCount], got[kCount], want[kCount];
+            Vec3 points[kCount], gotPoints[kCount], wantPoints[kCount];
+            for (std::size_t i = 0; i < kCount; ++i) {
+                for (int j = 0; j < 16; ++j) {
+                    a[i].m[j] = rng.next();
+                    b[i].m[j] = rng.next();
+                }
+                points[i] = Vec3(rng.next(), rng.next(), rng.next());
+            }
+
+            bool ok = true;
+            auto report = [&](const char* kernel) {
+                std::cerr << "[math] " << simdLevelName(level) << " " << kernel << " disagrees with scalar reference\n";
+                ok = false;
+            };
+
+            for (std::size_t i = 0; i < kCount; ++i) {
+                k.mul(got[i].m, a[i].m, b[i].m);
+                scalar::mul(want[i].m, a[i].m, b[i].m);
+                if (!nearlyEqual(got[i].m, want[i].m, 16, 1e-5f)) { report("mul"); break; }
+            }
+            k.mulBatch(got, a, b, kCount);
+            scalar::mulBatch(want, a, b, kCount);
+            if (!nearlyEqual(got[0].m, want[0].m, 16 * kCount, 1e-5f)) report("mulBatch");
+            k.mulBatchShared(got, a, b[0], kCount);
+            scalar::mulBatch(want, a, b[0], kCount);
+            if (!nearlyEqual(got[0].m, want[0].m, 16 * kCount, 1e-5f)) report("mulBatchShared");
+
+            for (std::size_t i = 0; i < kCount; ++i) {
+                k.transpose(got[i].m, a[i].m);
+                scalar::transpose(want[i].m, a[i].m);
+                if (!nearlyEqual(got[i].m, want[i].m, 16, 0.0f)) { report("transpose"); break; }
+            }
+
+            for (std::size_t i = 0; i < kCount; ++i) {
+                bool gotOk = k.inverse(got[i].m, a[i].m);
+                bool wantOk = scalar::inverse(want[i].m, a[i].m);
+                // Random matrices can be near-singular; compare the product with a instead
+                if (gotOk != wantOk) { report("inverse"); break; }
+                if (!gotOk) continue;
+                Mat4 identity, product;
+                scalar::mul(product.m, got[i].m, a[i].m);
+                if (!nearlyEqual(product.m, identity.m, 16, 1e-3f)) { report("inverse"); break; }
             }
-        std::memcpy(out, temp, sizeof(temp));
+
+            for (std::size_t i = 0; i < kCount; ++i) {
+                gotPoints[i] = k.transformPoint(a[i].m, points[i]);
+                wantPoints[i] = scalar::transformPoint(a[i].m, points[i]);
+                if (!nearlyEqual(&gotPoints[i].x, &wantPoints[i].x, 3, 1e-5f)) { report("transformPoint"); break; }
+            }
+            k.transformPointBatch(gotPoints, a[0], points, kCount);
+            scalar::transformPointBatch(wantPoints, a[0], points, kCount);
+            for (std::size_t i = 0; i < kCount; ++i) {
+                if (!nearlyEqual(&gotPoints[i].x, &wantPoints[i].x, 3, 1e-5f)) { report("transformPointBatch"); break; }
+            }
+
+            // Boxes of every size scattered around a camera looking down -z
+            Mat4 view = lookAt(Vec3(0.0f, 0.0f, 1.0f), Vec3(0.0f, 0.0f, -1.0f), Vec3(0.0f, 1.0f, 0.0f));
+            Mat4 viewProj;
+            scalar::mul(viewProj.m, view.m, perspective(1.0f, 1.5f, 0.1f, 3.0f).m);
+            Frustum frustum = extractFrustum(viewProj);
+            alignas(32) float boxes[6 * kFrustumLanes];
+            for (std::size_t i = 0; i < kCount; ++i) {
+                for (std::size_t lane = 0; lane < kFrustumLanes; ++lane) {
+                    for (int axis = 0; axis < 3; ++axis) {
+                        float center = rng.next(), extent = std::fabs(rng.next()) * 0.25f;
+                        boxes[axis * kFrustumLanes + lane] = center - extent;
+                        boxes[(axis + 3) * kFrustumLanes + lane] = center + extent;
+                    }
+                }
+                if (k.frustumTest8(frustum, boxes) != scalar::frustumTest8(frustum, boxes)) { report("frustumTest8"); break; }
+            }
+            return ok;
+        }
+
+    } // namespace
+
+    bool verifySimdKernels() {
+        bool ok = true;
+        const SimdLevel levels[] = { SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::NEON };
+        for (SimdLevel level : levels) {
+            if (const detail::Kernels* k = kernelsFor(level)) ok = verifyLevel(level, *k) && ok;
+        }
+        return ok;
+    }
+
+    // === CULLING ===
+    Frustum extractFrustum(const Mat4& viewProj) {
+        // Row r of the clip transform is (m[r], m[4 + r], m[8 + r], m[12 + r]);
+        // each plane is row 3 plus or minus row 0, 1 or 2 (-w <= x, y, z <= w)
+        const float* m = viewProj.m;
+        Frustum frustum;
+        for (int p = 0; p < 6; ++p) {
+            int row = p / 2;
+            float sign = (p % 2 == 0) ? 1.0f : -1.0f;
+            float* plane = frustum.planes[p];
+            for (int c = 0; c < 4; ++c) plane[c] = m[c * 4 + 3] + sign * m[c * 4 + row];
+            float len = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+            if (len > 0.0f) for (int c = 0; c < 4; ++c) plane[c] /= len;
+        }
+        return frustum;
     }
 
+    // === BUILDERS ===
     Mat4 perspective(float fov, float aspect, float nearZ, float farZ) {
         Mat4 result;
         float f = 1.0f / tanf(fov * 0.5f);
@@ -82,4 +434,37 @@ namespace engine::math {
         return result;
     }
 
-} // namespace
\ No newline at end of file
+    Quat quatFromAxisAngle(const Vec3& axis, float angle) {
+        Vec3 a = axis;
+        float len = std::sqrt(a.x * a.x + a.y * a.y + a.z * a.z);
+        if (len > 0.0f) { a.x /= len; a.y /= len; a.z /= len; }
+        float s = sinf(angle * 0.5f);
+        return Quat(a.x * s, a.y * s, a.z * s, cosf(angle * 0.5f));
+    }
+
+    Vec3 lerp(const Vec3& a, const Vec3& b, float t) {
+        return Vec3(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t);
+    }
+
+    Quat nlerp(const Quat& a, const Quat& b, float t) {
+        // q and -q are the same rotation; flip b onto a's hemisphere to take the short way
+        float sign = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0f ? -1.0f : 1.0f;
+        Quat q(a.x + (sign * b.x - a.x) * t, a.y + (sign * b.y - a.y) * t,
+               a.z + (sign * b.z - a.z) * t, a.w + (sign * b.w - a.w) * t);
+        float len = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+        if (len > 0.0f) { q.x /= len; q.y /= len; q.z /= len; q.w /= len; }
+        return q;
+    }
+
+    void composeTRS(float* out, const Vec3& t, const Quat& r, const Vec3& s) {
+        float xx = r.x * r.x, yy = r.y * r.y, zz = r.z * r.z;
+        float xy = r.x * r.y, xz = r.x * r.z, yz = r.y * r.z;
+        float wx = r.w * r.x, wy = r.w * r.y, wz = r.w * r.z;
+
+        out[0] = (1 - 2 * (yy + zz)) * s.x; out[1] = 2 * (xy + wz) * s.x;       out[2] = 2 * (xz - wy) * s.x;        out[3] = 0.0f;
+        out[4] = 2 * (xy - wz) * s.y;       out[5] = (1 - 2 * (xx + zz)) * s.y; out[6] = 2 * (yz + wx) * s.y;        out[7] = 0.0f;
+        out[8] = 2 * (xz + wy) * s.z;       out[9] = 2 * (yz - wx) * s.z;       out[10] = (1 - 2 * (xx + yy)) * s.z; out[11] = 0.0f;
+        out[12] = t.x;                      out[13] = t.y;                      out[14] = t.z;                       out[15] = 1.0f;
+    }
+
+} // namespace
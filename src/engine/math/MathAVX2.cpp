@@ -0,0 +1,134 @@
+// src/engine/math/MathAVX2.cpp
+// AVX2/FMA kernels. Every function carries ENGINE_TARGET_AVX2 instead of the
+// whole file being built with -mavx2, so nothing here leaks into code that
+// runs before the CPU check in Math.cpp.
+#include "MathKernels.h"
+
+#if defined(ENGINE_MATH_X86)
+#include <immintrin.h>
+#include "MathSSE.h"
+
+namespace engine::math::detail::avx2 {
+
+    namespace {
+
+        // Two output rows of a * b at once: aRows holds rows (i, i+1) of a,
+        // bN holds row N of b duplicated in both 128-bit lanes
+        ENGINE_TARGET_AVX2 inline __m256 mulRows(__m256 aRows, __m256 b0, __m256 b1, __m256 b2, __m256 b3) {
+            __m256 r = _mm256_mul_ps(_mm256_shuffle_ps(aRows, aRows, 0x00), b0);
+            r = _mm256_fmadd_ps(_mm256_shuffle_ps(aRows, aRows, 0x55), b1, r);
+            r = _mm256_fmadd_ps(_mm256_shuffle_ps(aRows, aRows, 0xAA), b2, r);
+            r = _mm256_fmadd_ps(_mm256_shuffle_ps(aRows, aRows, 0xFF), b3, r);
+            return r;
+        }
+
+        struct BRows {
+            __m256 b0, b1, b2, b3;
+        };
+
+        ENGINE_TARGET_AVX2 inline BRows loadRows(const float* b) {
+            __m256 b01 = _mm256_loadu_ps(b);
+            __m256 b23 = _mm256_loadu_ps(b + 8);
+            return { _mm256_permute2f128_ps(b01, b01, 0x00), _mm256_permute2f128_ps(b01, b01, 0x11),
+                     _mm256_permute2f128_ps(b23, b23, 0x00), _mm256_permute2f128_ps(b23, b23, 0x11) };
+        }
+
+        ENGINE_TARGET_AVX2 inline void mulRowsStore(float* out, const float* a, const BRows& b) {
+            __m256 r01 = mulRows(_mm256_loadu_ps(a), b.b0, b.b1, b.b2, b.b3);
+            __m256 r23 = mulRows(_mm256_loadu_ps(a + 8), b.b0, b.b1, b.b2, b.b3);
+            _mm256_storeu_ps(out, r01);
+            _mm256_storeu_ps(out + 8, r23);
+        }
+
+        ENGINE_TARGET_AVX2 inline void mulOne(float* out, const float* a, const float* b) {
+            mulRowsStore(out, a, loadRows(b));
+        }
+
+    } // namespace
+
+    ENGINE_TARGET_AVX2 void mul(float* out, const float* a, const float* b) {
+        mulOne(out, a, b);
+    }
+
+    ENGINE_TARGET_AVX2 void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count) {
+        for (std::size_t n = 0; n < count; ++n) mulOne(out[n].m, a[n].m, b[n].m);
+    }
+
+    ENGINE_TARGET_AVX2 void mulBatchShared(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count) {
+        BRows rows = loadRows(b.m);
+        for (std::size_t n = 0; n < count; ++n) mulRowsStore(out[n].m, a[n].m, rows);
+    }
+
+    ENGINE_TARGET_AVX2 void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count) {
+        // Columns duplicated across both lanes; two points per iteration
+        __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m));
+        __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m + 4));
+        __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m + 8));
+        __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m.m + 12));
+        alignas(32) float r[8];
+        std::size_t i = 0;
+        for (; i + 2 <= count; i += 2) {
+            const Vec3& p = points[i];
+            const Vec3& q = points[i + 1];
+            __m256 x = _mm256_setr_ps(p.x, p.x, p.x, p.x, q.x, q.x, q.x, q.x);
+            __m256 y = _mm256_setr_ps(p.y, p.y, p.y, p.y, q.y, q.y, q.y, q.y);
+            __m256 z = _mm256_setr_ps(p.z, p.z, p.z, p.z, q.z, q.z, q.z, q.z);
+            __m256 v = _mm256_fmadd_ps(c0, x, c3);
+            v = _mm256_fmadd_ps(c1, y, v);
+            v = _mm256_fmadd_ps(c2, z, v);
+            _mm256_store_ps(r, v);
+            out[i] = Vec3(r[0], r[1], r[2]);
+            out[i + 1] = Vec3(r[4], r[5], r[6]);
+        }
+        if (i < count) sse::transformPointBatch(out + i, m, points + i, count - i);
+    }
+
+    ENGINE_TARGET_AVX2 unsigned frustumTest8(const Frustum& frustum, const float* boxes) {
+        // All eight boxes in one register per bound; mul + add rather than
+        // FMA so the result matches the scalar reference exactly
+        __m256 minX = _mm256_load_ps(boxes);
+        __m256 minY = _mm256_load_ps(boxes + 8);
+        __m256 minZ = _mm256_load_ps(boxes + 16);
+        __m256 maxX = _mm256_load_ps(boxes + 24);
+        __m256 maxY = _mm256_load_ps(boxes + 32);
+        __m256 maxZ = _mm256_load_ps(boxes + 40);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; ++p) {
+            const float* plane = frustum.planes[p];
+            __m256 a = _mm256_set1_ps(plane[0]), b = _mm256_set1_ps(plane[1]), c = _mm256_set1_ps(plane[2]);
+            __m256 dist = _mm256_add_ps(_mm256_max_ps(_mm256_mul_ps(a, minX), _mm256_mul_ps(a, maxX)),
+                                        _mm256_max_ps(_mm256_mul_ps(b, minY), _mm256_mul_ps(b, maxY)));
+            dist = _mm256_add_ps(dist, _mm256_max_ps(_mm256_mul_ps(c, minZ), _mm256_mul_ps(c, maxZ)));
+            dist = _mm256_add_ps(dist, _mm256_set1_ps(plane[3]));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+        return static_cast<unsigned>(_mm256_movemask_ps(inside));
+    }
+
+} // namespace engine::math::detail::avx2
+
+namespace engine::math::detail {
+
+    const Kernels* avx2Kernels() {
+        static const Kernels kernels = {
+            avx2::mul,
+            sse::transpose,
+            sse::inverse,
+            sse::transformPoint,
+            avx2::mulBatch,
+            avx2::mulBatchShared,
+            avx2::transformPointBatch,
+            avx2::frustumTest8,
+        };
+        return &kernels;
+    }
+
+} // namespace engine::math::detail
+
+#else
+
+namespace engine::math::detail {
+    const Kernels* avx2Kernels() { return nullptr; }
+}
+
+#endif
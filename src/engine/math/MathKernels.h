@@ -0,0 +1,38 @@
+// src/engine/math/MathKernels.h
+// Internal: kernel tables shared by the dispatcher in Math.cpp and the
+// per-ISA translation units. Not part of the public include/ tree.
+#pragma once
+#include "engine/math/Math.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ENGINE_MATH_X86 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define ENGINE_MATH_NEON 1
+#endif
+
+// GCC/Clang only emit AVX2 for functions that ask for it; MSVC always allows the intrinsics
+#if defined(__GNUC__) || defined(__clang__)
+#define ENGINE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define ENGINE_TARGET_AVX2
+#endif
+
+namespace engine::math::detail {
+
+    struct Kernels {
+        void (*mul)(float* out, const float* a, const float* b);
+        void (*transpose)(float* out, const float* m);
+        bool (*inverse)(float* out, const float* m);
+        Vec3 (*transformPoint)(const float* m, const Vec3& p);
+        void (*mulBatch)(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count);
+        void (*mulBatchShared)(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count);
+        void (*transformPointBatch)(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count);
+        unsigned (*frustumTest8)(const Frustum& frustum, const float* boxes);
+    };
+
+    // Each returns nullptr when the ISA was not compiled into this build
+    const Kernels* sse2Kernels();
+    const Kernels* avx2Kernels();
+    const Kernels* neonKernels();
+
+} // namespace engine::math::detail
@@ -0,0 +1,148 @@
+// src/engine/math/MathNEON.cpp
+// NEON kernels for ARM64 builds. NEON is mandatory on AArch64, so selecting
+// this table needs no runtime check. inverse stays on the scalar reference.
+#include "MathKernels.h"
+
+#if defined(ENGINE_MATH_NEON)
+#include <arm_neon.h>
+
+namespace engine::math::detail::neon {
+
+    namespace {
+
+        inline float32x4_t mulRow(const float* aRow, float32x4_t b0, float32x4_t b1, float32x4_t b2, float32x4_t b3) {
+            float32x4_t a = vld1q_f32(aRow);
+            float32x4_t r = vmulq_laneq_f32(b0, a, 0);
+            r = vfmaq_laneq_f32(r, b1, a, 1);
+            r = vfmaq_laneq_f32(r, b2, a, 2);
+            r = vfmaq_laneq_f32(r, b3, a, 3);
+            return r;
+        }
+
+        inline void mulOne(float* out, const float* a, const float* b) {
+            float32x4_t b0 = vld1q_f32(b);
+            float32x4_t b1 = vld1q_f32(b + 4);
+            float32x4_t b2 = vld1q_f32(b + 8);
+            float32x4_t b3 = vld1q_f32(b + 12);
+            float32x4_t r0 = mulRow(a, b0, b1, b2, b3);
+            float32x4_t r1 = mulRow(a + 4, b0, b1, b2, b3);
+            float32x4_t r2 = mulRow(a + 8, b0, b1, b2, b3);
+            float32x4_t r3 = mulRow(a + 12, b0, b1, b2, b3);
+            vst1q_f32(out, r0);
+            vst1q_f32(out + 4, r1);
+            vst1q_f32(out + 8, r2);
+            vst1q_f32(out + 12, r3);
+        }
+
+        inline float32x4_t transformPoint4(float32x4_t c0, float32x4_t c1, float32x4_t c2, float32x4_t c3, const Vec3& p) {
+            float32x4_t r = vfmaq_n_f32(c3, c0, p.x);
+            r = vfmaq_n_f32(r, c1, p.y);
+            r = vfmaq_n_f32(r, c2, p.z);
+            return r;
+        }
+
+    } // namespace
+
+    void mul(float* out, const float* a, const float* b) {
+        mulOne(out, a, b);
+    }
+
+    void transpose(float* out, const float* m) {
+        float32x4x4_t t = vld4q_f32(m);   // de-interleaves straight into columns
+        vst1q_f32(out, t.val[0]);
+        vst1q_f32(out + 4, t.val[1]);
+        vst1q_f32(out + 8, t.val[2]);
+        vst1q_f32(out + 12, t.val[3]);
+    }
+
+    Vec3 transformPoint(const float* m, const Vec3& p) {
+        float32x4_t r = transformPoint4(vld1q_f32(m), vld1q_f32(m + 4), vld1q_f32(m + 8), vld1q_f32(m + 12), p);
+        return Vec3(vgetq_lane_f32(r, 0), vgetq_lane_f32(r, 1), vgetq_lane_f32(r, 2));
+    }
+
+    void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count) {
+        for (std::size_t n = 0; n < count; ++n) mulOne(out[n].m, a[n].m, b[n].m);
+    }
+
+    void mulBatchShared(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count) {
+        float32x4_t b0 = vld1q_f32(b.m);
+        float32x4_t b1 = vld1q_f32(b.m + 4);
+        float32x4_t b2 = vld1q_f32(b.m + 8);
+        float32x4_t b3 = vld1q_f32(b.m + 12);
+        for (std::size_t n = 0; n < count; ++n) {
+            const float* an = a[n].m;
+            float32x4_t r0 = mulRow(an, b0, b1, b2, b3);
+            float32x4_t r1 = mulRow(an + 4, b0, b1, b2, b3);
+            float32x4_t r2 = mulRow(an + 8, b0, b1, b2, b3);
+            float32x4_t r3 = mulRow(an + 12, b0, b1, b2, b3);
+            vst1q_f32(out[n].m, r0);
+            vst1q_f32(out[n].m + 4, r1);
+            vst1q_f32(out[n].m + 8, r2);
+            vst1q_f32(out[n].m + 12, r3);
+        }
+    }
+
+    void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count) {
+        float32x4_t c0 = vld1q_f32(m.m);
+        float32x4_t c1 = vld1q_f32(m.m + 4);
+        float32x4_t c2 = vld1q_f32(m.m + 8);
+        float32x4_t c3 = vld1q_f32(m.m + 12);
+        for (std::size_t i = 0; i < count; ++i) {
+            float32x4_t r = transformPoint4(c0, c1, c2, c3, points[i]);
+            out[i] = Vec3(vgetq_lane_f32(r, 0), vgetq_lane_f32(r, 1), vgetq_lane_f32(r, 2));
+        }
+    }
+
+    unsigned frustumTest8(const Frustum& frustum, const float* boxes) {
+        // Two passes of four boxes; the lane bits turn the compare mask into an integer mask
+        static const uint32_t kLaneBits[4] = { 1, 2, 4, 8 };
+        const uint32x4_t laneBits = vld1q_u32(kLaneBits);
+        unsigned mask = 0;
+        for (std::size_t half = 0; half < kFrustumLanes; half += 4) {
+            float32x4_t minX = vld1q_f32(boxes + half);
+            float32x4_t minY = vld1q_f32(boxes + 8 + half);
+            float32x4_t minZ = vld1q_f32(boxes + 16 + half);
+            float32x4_t maxX = vld1q_f32(boxes + 24 + half);
+            float32x4_t maxY = vld1q_f32(boxes + 32 + half);
+            float32x4_t maxZ = vld1q_f32(boxes + 40 + half);
+            uint32x4_t inside = vdupq_n_u32(~0u);
+            for (int p = 0; p < 6; ++p) {
+                const float* plane = frustum.planes[p];
+                float32x4_t dist = vaddq_f32(vmaxq_f32(vmulq_n_f32(minX, plane[0]), vmulq_n_f32(maxX, plane[0])),
+                                             vmaxq_f32(vmulq_n_f32(minY, plane[1]), vmulq_n_f32(maxY, plane[1])));
+                dist = vaddq_f32(dist, vmaxq_f32(vmulq_n_f32(minZ, plane[2]), vmulq_n_f32(maxZ, plane[2])));
+                dist = vaddq_f32(dist, vdupq_n_f32(plane[3]));
+                inside = vandq_u32(inside, vcgeq_f32(dist, vdupq_n_f32(0.0f)));
+            }
+            mask |= vaddvq_u32(vandq_u32(inside, laneBits)) << half;
+        }
+        return mask;
+    }
+
+} // namespace engine::math::detail::neon
+
+namespace engine::math::detail {
+
+    const Kernels* neonKernels() {
+        static const Kernels kernels = {
+            neon::mul,
+            neon::transpose,
+            scalar::inverse,
+            neon::transformPoint,
+            neon::mulBatch,
+            neon::mulBatchShared,
+            neon::transformPointBatch,
+            neon::frustumTest8,
+        };
+        return &kernels;
+    }
+
+} // namespace engine::math::detail
+
+#else
+
+namespace engine::math::detail {
+    const Kernels* neonKernels() { return nullptr; }
+}
+
+#endif
@@ -0,0 +1,205 @@
+// src/engine/math/MathSSE.cpp
+// SSE2 kernels - baseline on every x86-64 CPU, so no target attributes needed.
+#include "MathKernels.h"
+
+#if defined(ENGINE_MATH_X86)
+#include <emmintrin.h>
+#include "MathSSE.h"
+
+namespace engine::math::detail::sse {
+
+    void mul(float* out, const float* a, const float* b) {
+        __m128 b0 = _mm_loadu_ps(b);
+        __m128 b1 = _mm_loadu_ps(b + 4);
+        __m128 b2 = _mm_loadu_ps(b + 8);
+        __m128 b3 = _mm_loadu_ps(b + 12);
+        // Rows are computed before storing so out may alias a or b
+        __m128 r[4];
+        for (int i = 0; i < 4; ++i) r[i] = mulRow(a + i * 4, b0, b1, b2, b3);
+        for (int i = 0; i < 4; ++i) _mm_storeu_ps(out + i * 4, r[i]);
+    }
+
+    void transpose(float* out, const float* m) {
+        __m128 r0 = _mm_loadu_ps(m);
+        __m128 r1 = _mm_loadu_ps(m + 4);
+        __m128 r2 = _mm_loadu_ps(m + 8);
+        __m128 r3 = _mm_loadu_ps(m + 12);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        _mm_storeu_ps(out, r0);
+        _mm_storeu_ps(out + 4, r1);
+        _mm_storeu_ps(out + 8, r2);
+        _mm_storeu_ps(out + 12, r3);
+    }
+
+    namespace {
+
+#define ENGINE_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+#define ENGINE_SWIZZLE(v, x, y, z, w) ENGINE_SHUFFLE(v, v, x, y, z, w)
+
+        // 2x2 blocks packed as (m00, m01, m10, m11)
+        inline __m128 mat2Mul(__m128 a, __m128 b) {
+            return _mm_add_ps(_mm_mul_ps(a, ENGINE_SWIZZLE(b, 0, 3, 0, 3)),
+                              _mm_mul_ps(ENGINE_SWIZZLE(a, 1, 0, 3, 2), ENGINE_SWIZZLE(b, 2, 1, 2, 1)));
+        }
+
+        // adj(a) * b
+        inline __m128 mat2AdjMul(__m128 a, __m128 b) {
+            return _mm_sub_ps(_mm_mul_ps(ENGINE_SWIZZLE(a, 3, 3, 0, 0), b),
+                              _mm_mul_ps(ENGINE_SWIZZLE(a, 1, 1, 2, 2), ENGINE_SWIZZLE(b, 2, 3, 0, 1)));
+        }
+
+        // a * adj(b)
+        inline __m128 mat2MulAdj(__m128 a, __m128 b) {
+            return _mm_sub_ps(_mm_mul_ps(a, ENGINE_SWIZZLE(b, 3, 0, 3, 0)),
+                              _mm_mul_ps(ENGINE_SWIZZLE(a, 1, 0, 3, 2), ENGINE_SWIZZLE(b, 2, 1, 2, 1)));
+        }
+
+    } // namespace
+
+    bool inverse(float* out, const float* m) {
+        // Block-wise inverse on 2x2 sub-matrices | A B ; C D |
+        __m128 r0 = _mm_loadu_ps(m);
+        __m128 r1 = _mm_loadu_ps(m + 4);
+        __m128 r2 = _mm_loadu_ps(m + 8);
+        __m128 r3 = _mm_loadu_ps(m + 12);
+
+        __m128 A = _mm_movelh_ps(r0, r1);
+        __m128 B = _mm_movehl_ps(r1, r0);
+        __m128 C = _mm_movelh_ps(r2, r3);
+        __m128 D = _mm_movehl_ps(r3, r2);
+
+        // (|A|, |B|, |C|, |D|)
+        __m128 detSub = _mm_sub_ps(
+            _mm_mul_ps(ENGINE_SHUFFLE(r0, r2, 0, 2, 0, 2), ENGINE_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+            _mm_mul_ps(ENGINE_SHUFFLE(r0, r2, 1, 3, 1, 3), ENGINE_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+        __m128 detA = ENGINE_SWIZZLE(detSub, 0, 0, 0, 0);
+        __m128 detB = ENGINE_SWIZZLE(detSub, 1, 1, 1, 1);
+        __m128 detC = ENGINE_SWIZZLE(detSub, 2, 2, 2, 2);
+        __m128 detD = ENGINE_SWIZZLE(detSub, 3, 3, 3, 3);
+
+        __m128 D_C = mat2AdjMul(D, C);
+        __m128 A_B = mat2AdjMul(A, B);
+        __m128 X_ = _mm_sub_ps(_mm_mul_ps(detD, A), mat2Mul(B, D_C));
+        __m128 W_ = _mm_sub_ps(_mm_mul_ps(detA, D), mat2Mul(C, A_B));
+        __m128 Y_ = _mm_sub_ps(_mm_mul_ps(detB, C), mat2MulAdj(D, A_B));
+        __m128 Z_ = _mm_sub_ps(_mm_mul_ps(detC, B), mat2MulAdj(A, D_C));
+
+        // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+        __m128 tr = _mm_mul_ps(A_B, ENGINE_SWIZZLE(D_C, 0, 2, 1, 3));
+        tr = _mm_add_ps(tr, ENGINE_SWIZZLE(tr, 2, 3, 0, 1));
+        tr = _mm_add_ps(tr, ENGINE_SWIZZLE(tr, 1, 0, 3, 2));
+        __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+        if (_mm_cvtss_f32(detM) == 0.0f) return false;
+
+        __m128 rDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+        X_ = _mm_mul_ps(X_, rDetM);
+        Y_ = _mm_mul_ps(Y_, rDetM);
+        Z_ = _mm_mul_ps(Z_, rDetM);
+        W_ = _mm_mul_ps(W_, rDetM);
+
+        _mm_storeu_ps(out, ENGINE_SHUFFLE(X_, Y_, 3, 1, 3, 1));
+        _mm_storeu_ps(out + 4, ENGINE_SHUFFLE(X_, Y_, 2, 0, 2, 0));
+        _mm_storeu_ps(out + 8, ENGINE_SHUFFLE(Z_, W_, 3, 1, 3, 1));
+        _mm_storeu_ps(out + 12, ENGINE_SHUFFLE(Z_, W_, 2, 0, 2, 0));
+        return true;
+    }
+
+#undef ENGINE_SWIZZLE
+#undef ENGINE_SHUFFLE
+
+    Vec3 transformPoint(const float* m, const Vec3& p) {
+        alignas(16) float r[4];
+        _mm_store_ps(r, transformPoint4(_mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12), p));
+        return Vec3(r[0], r[1], r[2]);
+    }
+
+    void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count) {
+        for (std::size_t n = 0; n < count; ++n) {
+            const float* bm = b[n].m;
+            __m128 b0 = _mm_load_ps(bm);
+            __m128 b1 = _mm_load_ps(bm + 4);
+            __m128 b2 = _mm_load_ps(bm + 8);
+            __m128 b3 = _mm_load_ps(bm + 12);
+            __m128 r[4];
+            for (int i = 0; i < 4; ++i) r[i] = mulRow(a[n].m + i * 4, b0, b1, b2, b3);
+            for (int i = 0; i < 4; ++i) _mm_store_ps(out[n].m + i * 4, r[i]);
+        }
+    }
+
+    void mulBatchShared(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count) {
+        __m128 b0 = _mm_load_ps(b.m);
+        __m128 b1 = _mm_load_ps(b.m + 4);
+        __m128 b2 = _mm_load_ps(b.m + 8);
+        __m128 b3 = _mm_load_ps(b.m + 12);
+        for (std::size_t n = 0; n < count; ++n) {
+            __m128 r[4];
+            for (int i = 0; i < 4; ++i) r[i] = mulRow(a[n].m + i * 4, b0, b1, b2, b3);
+            for (int i = 0; i < 4; ++i) _mm_store_ps(out[n].m + i * 4, r[i]);
+        }
+    }
+
+    void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count) {
+        __m128 c0 = _mm_load_ps(m.m);
+        __m128 c1 = _mm_load_ps(m.m + 4);
+        __m128 c2 = _mm_load_ps(m.m + 8);
+        __m128 c3 = _mm_load_ps(m.m + 12);
+        alignas(16) float r[4];
+        for (std::size_t i = 0; i < count; ++i) {
+            _mm_store_ps(r, transformPoint4(c0, c1, c2, c3, points[i]));
+            out[i] = Vec3(r[0], r[1], r[2]);
+        }
+    }
+
+    unsigned frustumTest8(const Frustum& frustum, const float* boxes) {
+        // Two passes of four boxes; a lane stays set while no plane rejects it
+        unsigned mask = 0;
+        for (std::size_t half = 0; half < kFrustumLanes; half += 4) {
+            __m128 minX = _mm_load_ps(boxes + half);
+            __m128 minY = _mm_load_ps(boxes + 8 + half);
+            __m128 minZ = _mm_load_ps(boxes + 16 + half);
+            __m128 maxX = _mm_load_ps(boxes + 24 + half);
+            __m128 maxY = _mm_load_ps(boxes + 32 + half);
+            __m128 maxZ = _mm_load_ps(boxes + 40 + half);
+            __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int p = 0; p < 6; ++p) {
+                const float* plane = frustum.planes[p];
+                __m128 a = _mm_set1_ps(plane[0]), b = _mm_set1_ps(plane[1]), c = _mm_set1_ps(plane[2]);
+                __m128 dist = _mm_add_ps(_mm_max_ps(_mm_mul_ps(a, minX), _mm_mul_ps(a, maxX)),
+                                         _mm_max_ps(_mm_mul_ps(b, minY), _mm_mul_ps(b, maxY)));
+                dist = _mm_add_ps(dist, _mm_max_ps(_mm_mul_ps(c, minZ), _mm_mul_ps(c, maxZ)));
+                dist = _mm_add_ps(dist, _mm_set1_ps(plane[3]));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, _mm_setzero_ps()));
+            }
+            mask |= static_cast<unsigned>(_mm_movemask_ps(inside)) << half;
+        }
+        return mask;
+    }
+
+} // namespace engine::math::detail::sse
+
+namespace engine::math::detail {
+
+    const Kernels* sse2Kernels() {
+        static const Kernels kernels = {
+            sse::mul,
+            sse::transpose,
+            sse::inverse,
+            sse::transformPoint,
+            sse::mulBatch,
+            sse::mulBatchShared,
+            sse::transformPointBatch,
+            sse::frustumTest8,
+        };
+        return &kernels;
+    }
+
+} // namespace engine::math::detail
+
+#else
+
+namespace engine::math::detail {
+    const Kernels* sse2Kernels() { return nullptr; }
+}
+
+#endif
@@ -0,0 +1,40 @@
+// src/engine/math/MathSSE.h
+// Internal: SSE2 kernels and helpers, reused by the AVX2 table for the
+// operations that do not benefit from 256-bit lanes.
+#pragma once
+#include "MathKernels.h"
+
+#if defined(ENGINE_MATH_X86)
+#include <emmintrin.h>
+
+namespace engine::math::detail::sse {
+
+    // One output row of a * b (row-major product), b given as four rows
+    inline __m128 mulRow(const float* aRow, __m128 b0, __m128 b1, __m128 b2, __m128 b3) {
+        __m128 r = _mm_mul_ps(_mm_set1_ps(aRow[0]), b0);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(aRow[1]), b1));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(aRow[2]), b2));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(aRow[3]), b3));
+        return r;
+    }
+
+    // Column-major m given as its four columns; returns (m * (p, 1)).xyzw
+    inline __m128 transformPoint4(__m128 c0, __m128 c1, __m128 c2, __m128 c3, const Vec3& p) {
+        __m128 r = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p.x)), c3);
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(p.y)));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(p.z)));
+        return r;
+    }
+
+    void mul(float* out, const float* a, const float* b);
+    void transpose(float* out, const float* m);
+    bool inverse(float* out, const float* m);
+    Vec3 transformPoint(const float* m, const Vec3& p);
+    void mulBatch(Mat4* out, const Mat4* a, const Mat4* b, std::size_t count);
+    void mulBatchShared(Mat4* out, const Mat4* a, const Mat4& b, std::size_t count);
+    void transformPointBatch(Vec3* out, const Mat4& m, const Vec3* points, std::size_t count);
+    unsigned frustumTest8(const Frustum& frustum, const float* boxes);
+
+} // namespace engine::math::detail::sse
+
+#endif
@@ -0,0 +1,50 @@
+// src/engine/particles/ParticleKernels.cpp
+#include "ParticleKernels.h"
+
+namespace engine::particles {
+
+    // === SCALAR REFERENCE ===
+    namespace scalar {
+
+        void emit(const Span& span, std::size_t count, const EmitParams& params, std::uint32_t seed) {
+            std::uint32_t rng = seedLane(seed, 0);
+            for (std::size_t i = 0; i < count; ++i) {
+                for (int axis = 0; axis < 3; ++axis) {
+                    float jitter = unitFloat(xorshift(rng)) * 2.0f - 1.0f;
+                    span.s[kPosX + axis][i] = params.position[axis] + jitter * params.positionJitter;
+                }
+                for (int axis = 0; axis < 3; ++axis) {
+                    float jitter = unitFloat(xorshift(rng)) * 2.0f - 1.0f;
+                    span.s[kVelX + axis][i] = params.velocity[axis] + jitter * params.velocityJitter;
+                }
+                float life = params.lifeMin + unitFloat(xorshift(rng)) * params.lifeRange;
+                span.s[kLife][i] = life;
+                span.s[kInvLifetime][i] = 1.0f / life;
+            }
+        }
+
+        std::size_t simulate(const Span& span, std::size_t count, const SimParams& params, ParticleInstance* out) {
+            // Survivors pack towards the front; alive <= i, so nothing unread is overwritten
+            std::size_t alive = 0;
+            for (std::size_t i = 0; i < count; ++i)
+                if (simulateOne(span.s, i, alive, params, out)) ++alive;
+            return alive;
+        }
+
+    } // namespace scalar
+
+    // === DISPATCH ===
+    const Kernels& kernels(math::SimdLevel level) {
+        static const Kernels kScalar = { scalar::emit, scalar::simulate };
+        const Kernels* picked = nullptr;
+        switch (level) {
+        case math::SimdLevel::Scalar: break;
+        case math::SimdLevel::SSE2:   picked = sse2Kernels(); break;
+        case math::SimdLevel::AVX2:   picked = avx2Kernels(); break;
+        case math::SimdLevel::NEON:   picked = neonKernels(); break;
+        }
+        // math only reports levels the CPU supports, so the table is safe to run
+        return picked ? *picked : kScalar;
+    }
+
+} // namespace engine::particles
@@ -0,0 +1,93 @@
+// src/engine/particles/ParticleKernels.h
+// Internal: per-ISA particle kernels and the table ParticleSystem picks
+// from, following the math module's dispatch (same SimdLevel, same
+// ENGINE_SIMD override).
+#pragma once
+#include "../math/MathKernels.h"
+#include "engine/particles/ParticleSystem.h"
+
+namespace engine::particles {
+
+    // Stream order inside the pool
+    enum Stream { kPosX, kPosY, kPosZ, kVelX, kVelY, kVelZ, kLife, kInvLifetime, kStreams };
+
+    // Pointers to the same index in every stream
+    struct Span {
+        float* s[kStreams];
+    };
+
+    struct EmitParams {
+        float position[3];
+        float velocity[3];
+        float positionJitter;
+        float velocityJitter;
+        float lifeMin;
+        float lifeRange;   // lifeMax - lifeMin
+    };
+
+    struct SimParams {
+        float dt;
+        float gravity[3];   // already times dt
+        float damping;      // velocity scale for this step
+    };
+
+    struct Kernels {
+        // Writes count new particles at span; seed makes the sequence repeatable
+        void (*emit)(const Span& span, std::size_t count, const EmitParams& params, std::uint32_t seed);
+        // Advances count particles, packs the survivors to the front of span
+        // and, when out is not null, writes them to out. Returns survivors.
+        std::size_t (*simulate)(const Span& span, std::size_t count, const SimParams& params, ParticleInstance* out);
+    };
+
+    const Kernels& kernels(math::SimdLevel level);
+    inline const Kernels& activeKernels() { return kernels(math::simdLevel()); }
+
+    namespace scalar {
+        void emit(const Span& span, std::size_t count, const EmitParams& params, std::uint32_t seed);
+        std::size_t simulate(const Span& span, std::size_t count, const SimParams& params, ParticleInstance* out);
+    }
+
+    // nullptr when the ISA was not compiled into this build
+    const Kernels* sse2Kernels();
+    const Kernels* avx2Kernels();
+    const Kernels* neonKernels();
+
+    // One particle of simulate(), for scalar kernels and SIMD tails: reads
+    // index i, writes the survivor to index at (<= i). True if it survived.
+    inline bool simulateOne(float* const* s, std::size_t i, std::size_t at, const SimParams& params, ParticleInstance* out) {
+        float vx = (s[kVelX][i] + params.gravity[0]) * params.damping;
+        float vy = (s[kVelY][i] + params.gravity[1]) * params.damping;
+        float vz = (s[kVelZ][i] + params.gravity[2]) * params.damping;
+        float px = s[kPosX][i] + vx * params.dt;
+        float py = s[kPosY][i] + vy * params.dt;
+        float pz = s[kPosZ][i] + vz * params.dt;
+        float life = s[kLife][i] - params.dt;
+        float invLifetime = s[kInvLifetime][i];
+        if (life <= 0.0f) return false;
+
+        s[kPosX][at] = px; s[kPosY][at] = py; s[kPosZ][at] = pz;
+        s[kVelX][at] = vx; s[kVelY][at] = vy; s[kVelZ][at] = vz;
+        s[kLife][at] = life; s[kInvLifetime][at] = invLifetime;
+        if (out) out[at] = { px, py, pz, life * invLifetime };
+        return true;
+    }
+
+    // Per-lane generator shared by every ISA: lane i of a width-W kernel
+    // starts from seedLane(seed, i) and steps with xorshift32
+    inline std::uint32_t seedLane(std::uint32_t seed, std::uint32_t lane) {
+        std::uint32_t x = seed ^ (lane * 0x9E3779B9u + 0x7F4A7C15u);
+        x ^= x >> 16; x *= 0x85EBCA6Bu; x ^= x >> 13; x *= 0xC2B2AE35u; x ^= x >> 16;
+        return x ? x : 0x6D2B79F5u;   // xorshift never leaves zero
+    }
+
+    inline std::uint32_t xorshift(std::uint32_t& x) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        return x;
+    }
+
+    // [0, 1) from the top 23 bits
+    inline float unitFloat(std::uint32_t bits) {
+        return static_cast<float>(bits >> 9) * (1.0f / 8388608.0f);
+    }
+
+} // namespace engine::particles
@@ -0,0 +1,123 @@
+// src/engine/particles/ParticleKernelsNEON.cpp
+// NEON particle kernels for ARM64 builds. vst4q interleaves the four output
+// streams into instances directly, so no transpose is needed.
+#include "ParticleKernels.h"
+
+#if defined(ENGINE_MATH_NEON)
+#include <arm_neon.h>
+
+namespace engine::particles {
+
+    namespace neon {
+
+        namespace {
+
+            inline uint32x4_t xorshift4(uint32x4_t& x) {
+                x = veorq_u32(x, vshlq_n_u32(x, 13));
+                x = veorq_u32(x, vshrq_n_u32(x, 17));
+                x = veorq_u32(x, vshlq_n_u32(x, 5));
+                return x;
+            }
+
+            inline float32x4_t unit4(uint32x4_t& x) {
+                return vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(xorshift4(x), 9)), 1.0f / 8388608.0f);
+            }
+
+            inline float32x4_t signedUnit4(uint32x4_t& x) {
+                return vfmaq_n_f32(vdupq_n_f32(-1.0f), unit4(x), 2.0f);
+            }
+
+        } // namespace
+
+        void emit(const Span& span, std::size_t count, const EmitParams& params, std::uint32_t seed) {
+            std::uint32_t seeds[4] = { seedLane(seed, 0), seedLane(seed, 1), seedLane(seed, 2), seedLane(seed, 3) };
+            uint32x4_t rng = vld1q_u32(seeds);
+
+            for (std::size_t i = 0; i < count; i += 4) {
+                float32x4_t v[kStreams];
+                for (int axis = 0; axis < 3; ++axis)
+                    v[kPosX + axis] = vfmaq_n_f32(vdupq_n_f32(params.position[axis]), signedUnit4(rng), params.positionJitter);
+                for (int axis = 0; axis < 3; ++axis)
+                    v[kVelX + axis] = vfmaq_n_f32(vdupq_n_f32(params.velocity[axis]), signedUnit4(rng), params.velocityJitter);
+                v[kLife] = vfmaq_n_f32(vdupq_n_f32(params.lifeMin), unit4(rng), params.lifeRange);
+                v[kInvLifetime] = vdivq_f32(vdupq_n_f32(1.0f), v[kLife]);
+
+                if (i + 4 <= count) {
+                    for (int stream = 0; stream < kStreams; ++stream) vst1q_f32(span.s[stream] + i, v[stream]);
+                }
+                else {
+                    float lanes[4];
+                    for (int stream = 0; stream < kStreams; ++stream) {
+                        vst1q_f32(lanes, v[stream]);
+                        for (std::size_t lane = 0; i + lane < count; ++lane) span.s[stream][i + lane] = lanes[lane];
+                    }
+                }
+            }
+        }
+
+        std::size_t simulate(const Span& span, std::size_t count, const SimParams& params, ParticleInstance* out) {
+            float* const* s = span.s;
+            const float32x4_t gx = vdupq_n_f32(params.gravity[0]);
+            const float32x4_t gy = vdupq_n_f32(params.gravity[1]);
+            const float32x4_t gz = vdupq_n_f32(params.gravity[2]);
+            const float32x4_t dt = vdupq_n_f32(params.dt);
+
+            std::size_t alive = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                float32x4_t vx = vmulq_n_f32(vaddq_f32(vld1q_f32(s[kVelX] + i), gx), params.damping);
+                float32x4_t vy = vmulq_n_f32(vaddq_f32(vld1q_f32(s[kVelY] + i), gy), params.damping);
+                float32x4_t vz = vmulq_n_f32(vaddq_f32(vld1q_f32(s[kVelZ] + i), gz), params.damping);
+                float32x4_t px = vfmaq_n_f32(vld1q_f32(s[kPosX] + i), vx, params.dt);
+                float32x4_t py = vfmaq_n_f32(vld1q_f32(s[kPosY] + i), vy, params.dt);
+                float32x4_t pz = vfmaq_n_f32(vld1q_f32(s[kPosZ] + i), vz, params.dt);
+                float32x4_t life = vsubq_f32(vld1q_f32(s[kLife] + i), dt);
+                float32x4_t invLifetime = vld1q_f32(s[kInvLifetime] + i);
+                uint32x4_t survives = vcgtq_f32(life, vdupq_n_f32(0.0f));
+
+                if (vminvq_u32(survives) != 0) {
+                    vst1q_f32(s[kPosX] + alive, px); vst1q_f32(s[kPosY] + alive, py); vst1q_f32(s[kPosZ] + alive, pz);
+                    vst1q_f32(s[kVelX] + alive, vx); vst1q_f32(s[kVelY] + alive, vy); vst1q_f32(s[kVelZ] + alive, vz);
+                    vst1q_f32(s[kLife] + alive, life); vst1q_f32(s[kInvLifetime] + alive, invLifetime);
+                    if (out) {
+                        float32x4x4_t instances = { { px, py, pz, vmulq_f32(life, invLifetime) } };
+                        vst4q_f32(&out[alive].x, instances);
+                    }
+                    alive += 4;
+                }
+                else if (vmaxvq_u32(survives) != 0) {
+                    float lanes[kStreams][4];
+                    std::uint32_t mask[4];
+                    vst1q_u32(mask, survives);
+                    vst1q_f32(lanes[kPosX], px); vst1q_f32(lanes[kPosY], py); vst1q_f32(lanes[kPosZ], pz);
+                    vst1q_f32(lanes[kVelX], vx); vst1q_f32(lanes[kVelY], vy); vst1q_f32(lanes[kVelZ], vz);
+                    vst1q_f32(lanes[kLife], life); vst1q_f32(lanes[kInvLifetime], invLifetime);
+                    for (int lane = 0; lane < 4; ++lane) {
+                        if (!mask[lane]) continue;
+                        for (int stream = 0; stream < kStreams; ++stream) s[stream][alive] = lanes[stream][lane];
+                        if (out) out[alive] = { lanes[kPosX][lane], lanes[kPosY][lane], lanes[kPosZ][lane],
+                                                lanes[kLife][lane] * lanes[kInvLifetime][lane] };
+                        ++alive;
+                    }
+                }
+            }
+            for (; i < count; ++i)
+                if (simulateOne(s, i, alive, params, out)) ++alive;
+            return alive;
+        }
+
+    } // namespace neon
+
+    const Kernels* neonKernels() {
+        static const Kernels kernels = { neon::emit, neon::simulate };
+        return &kernels;
+    }
+
+} // namespace engine::particles
+
+#else
+
+namespace engine::particles {
+    const Kernels* neonKernels() { return nullptr; }
+}
+
+#endif
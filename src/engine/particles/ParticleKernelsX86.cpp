@@ -0,0 +1,279 @@
+// src/engine/particles/ParticleKernelsX86.cpp
+// SSE2 and AVX2 particle kernels. As in MathAVX2.cpp, the AVX2 functions
+// carry ENGINE_TARGET_AVX2 rather than the file being built with -mavx2.
+//
+// simulate() takes the vector path for a group whose lanes all survive,
+// which is nearly every group, and packs mixed groups lane by lane. Output
+// goes out with non-temporal stores: it is headed for a mapped vertex
+// buffer the CPU never reads back.
+#include "ParticleKernels.h"
+
+#if defined(ENGINE_MATH_X86)
+#include <immintrin.h>
+
+namespace engine::particles {
+
+    namespace {
+
+        // One instance, non-temporal like the rest: a plain store into a
+        // line being streamed would pull it into the cache first
+        inline void streamInstance(ParticleInstance* out, float x, float y, float z, float life) {
+            _mm_stream_ps(&out->x, _mm_setr_ps(x, y, z, life));
+        }
+
+    } // namespace
+
+    namespace sse {
+
+        namespace {
+
+            inline __m128i xorshift4(__m128i& x) {
+                x = _mm_xor_si128(x, _mm_slli_epi32(x, 13));
+                x = _mm_xor_si128(x, _mm_srli_epi32(x, 17));
+                x = _mm_xor_si128(x, _mm_slli_epi32(x, 5));
+                return x;
+            }
+
+            // unitFloat() per lane, in [-1, 1)
+            inline __m128 signedUnit4(__m128i& x) {
+                __m128 u = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(xorshift4(x), 9)), _mm_set1_ps(1.0f / 8388608.0f));
+                return _mm_sub_ps(_mm_add_ps(u, u), _mm_set1_ps(1.0f));
+            }
+
+            inline __m128 unit4(__m128i& x) {
+                return _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(xorshift4(x), 9)), _mm_set1_ps(1.0f / 8388608.0f));
+            }
+
+            // (x, y, z, life) for four particles as four 16-byte instances
+            inline void streamInstances(ParticleInstance* out, __m128 x, __m128 y, __m128 z, __m128 life) {
+                _MM_TRANSPOSE4_PS(x, y, z, life);
+                float* dst = &out->x;
+                _mm_stream_ps(dst, x);
+                _mm_stream_ps(dst + 4, y);
+                _mm_stream_ps(dst + 8, z);
+                _mm_stream_ps(dst + 12, life);
+            }
+
+        } // namespace
+
+        void emit(const Span& span, std::size_t count, const EmitParams& params, std::uint32_t seed) {
+            __m128i rng = _mm_setr_epi32(static_cast<int>(seedLane(seed, 0)), static_cast<int>(seedLane(seed, 1)),
+                                         static_cast<int>(seedLane(seed, 2)), static_cast<int>(seedLane(seed, 3)));
+            const __m128 posJitter = _mm_set1_ps(params.positionJitter);
+            const __m128 velJitter = _mm_set1_ps(params.velocityJitter);
+
+            for (std::size_t i = 0; i < count; i += 4) {
+                __m128 v[kStreams];
+                for (int axis = 0; axis < 3; ++axis)
+                    v[kPosX + axis] = _mm_add_ps(_mm_set1_ps(params.position[axis]), _mm_mul_ps(signedUnit4(rng), posJitter));
+                for (int axis = 0; axis < 3; ++axis)
+                    v[kVelX + axis] = _mm_add_ps(_mm_set1_ps(params.velocity[axis]), _mm_mul_ps(signedUnit4(rng), velJitter));
+                v[kLife] = _mm_add_ps(_mm_set1_ps(params.lifeMin), _mm_mul_ps(unit4(rng), _mm_set1_ps(params.lifeRange)));
+                v[kInvLifetime] = _mm_div_ps(_mm_set1_ps(1.0f), v[kLife]);
+
+                if (i + 4 <= count) {
+                    for (int stream = 0; stream < kStreams; ++stream) _mm_storeu_ps(span.s[stream] + i, v[stream]);
+                }
+                else {
+                    alignas(16) float lanes[4];
+                    for (int stream = 0; stream < kStreams; ++stream) {
+                        _mm_store_ps(lanes, v[stream]);
+                        for (std::size_t lane = 0; i + lane < count; ++lane) span.s[stream][i + lane] = lanes[lane];
+                    }
+                }
+            }
+        }
+
+        std::size_t simulate(const Span& span, std::size_t count, const SimParams& params, ParticleInstance* out) {
+            float* const* s = span.s;
+            const __m128 dt = _mm_set1_ps(params.dt);
+            const __m128 damping = _mm_set1_ps(params.damping);
+            const __m128 gx = _mm_set1_ps(params.gravity[0]);
+            const __m128 gy = _mm_set1_ps(params.gravity[1]);
+            const __m128 gz = _mm_set1_ps(params.gravity[2]);
+            const __m128 zero = _mm_setzero_ps();
+
+            std::size_t alive = 0, i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 vx = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(s[kVelX] + i), gx), damping);
+                __m128 vy = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(s[kVelY] + i), gy), damping);
+                __m128 vz = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(s[kVelZ] + i), gz), damping);
+                __m128 px = _mm_add_ps(_mm_loadu_ps(s[kPosX] + i), _mm_mul_ps(vx, dt));
+                __m128 py = _mm_add_ps(_mm_loadu_ps(s[kPosY] + i), _mm_mul_ps(vy, dt));
+                __m128 pz = _mm_add_ps(_mm_loadu_ps(s[kPosZ] + i), _mm_mul_ps(vz, dt));
+                __m128 life = _mm_sub_ps(_mm_loadu_ps(s[kLife] + i), dt);
+                __m128 invLifetime = _mm_loadu_ps(s[kInvLifetime] + i);
+                int mask = _mm_movemask_ps(_mm_cmpgt_ps(life, zero));
+
+                if (mask == 0xF) {
+                    // alive <= i: the stores land on lanes already loaded
+                    _mm_storeu_ps(s[kPosX] + alive, px); _mm_storeu_ps(s[kPosY] + alive, py); _mm_storeu_ps(s[kPosZ] + alive, pz);
+                    _mm_storeu_ps(s[kVelX] + alive, vx); _mm_storeu_ps(s[kVelY] + alive, vy); _mm_storeu_ps(s[kVelZ] + alive, vz);
+                    _mm_storeu_ps(s[kLife] + alive, life); _mm_storeu_ps(s[kInvLifetime] + alive, invLifetime);
+                    if (out) streamInstances(out + alive, px, py, pz, _mm_mul_ps(life, invLifetime));
+                    alive += 4;
+                }
+                else if (mask) {
+                    alignas(16) float lanes[kStreams][4];
+                    _mm_store_ps(lanes[kPosX], px); _mm_store_ps(lanes[kPosY], py); _mm_store_ps(lanes[kPosZ], pz);
+                    _mm_store_ps(lanes[kVelX], vx); _mm_store_ps(lanes[kVelY], vy); _mm_store_ps(lanes[kVelZ], vz);
+                    _mm_store_ps(lanes[kLife], life); _mm_store_ps(lanes[kInvLifetime], invLifetime);
+                    for (int lane = 0; lane < 4; ++lane) {
+                        if (!(mask & (1 << lane))) continue;
+                        for (int stream = 0; stream < kStreams; ++stream) s[stream][alive] = lanes[stream][lane];
+                        if (out) streamInstance(out + alive, lanes[kPosX][lane], lanes[kPosY][lane], lanes[kPosZ][lane],
+                                                lanes[kLife][lane] * lanes[kInvLifetime][lane]);
+                        ++alive;
+                    }
+                }
+            }
+            for (; i < count; ++i)
+                if (simulateOne(s, i, alive, params, out)) ++alive;
+            if (out) _mm_sfence();
+            return alive;
+        }
+
+    } // namespace sse
+
+    namespace avx2 {
+
+        namespace {
+
+            ENGINE_TARGET_AVX2 inline __m256i xorshift8(__m256i& x) {
+                x = _mm256_xor_si256(x, _mm256_slli_epi32(x, 13));
+                x = _mm256_xor_si256(x, _mm256_srli_epi32(x, 17));
+                x = _mm256_xor_si256(x, _mm256_slli_epi32(x, 5));
+                return x;
+            }
+
+            ENGINE_TARGET_AVX2 inline __m256 unit8(__m256i& x) {
+                return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(xorshift8(x), 9)), _mm256_set1_ps(1.0f / 8388608.0f));
+            }
+
+            ENGINE_TARGET_AVX2 inline __m256 signedUnit8(__m256i& x) {
+                return _mm256_fmadd_ps(unit8(x), _mm256_set1_ps(2.0f), _mm256_set1_ps(-1.0f));
+            }
+
+            // (x, y, z, life) for eight particles as eight 16-byte instances
+            ENGINE_TARGET_AVX2 inline void streamInstances(ParticleInstance* out, __m256 x, __m256 y, __m256 z, __m256 life) {
+                __m256 xy0 = _mm256_unpacklo_ps(x, y);   // x0 y0 x1 y1 | x4 y4 x5 y5
+                __m256 xy1 = _mm256_unpackhi_ps(x, y);   // x2 y2 x3 y3 | x6 y6 x7 y7
+                __m256 zl0 = _mm256_unpacklo_ps(z, life);
+                __m256 zl1 = _mm256_unpackhi_ps(z, life);
+                __m256 p04 = _mm256_shuffle_ps(xy0, zl0, 0x44);   // particle 0 | particle 4
+                __m256 p15 = _mm256_shuffle_ps(xy0, zl0, 0xEE);
+                __m256 p26 = _mm256_shuffle_ps(xy1, zl1, 0x44);
+                __m256 p37 = _mm256_shuffle_ps(xy1, zl1, 0xEE);
+                // Instances are only 16-byte aligned, so stream them one at a time
+                float* dst = &out->x;
+                _mm_stream_ps(dst + 0, _mm256_castps256_ps128(p04));
+                _mm_stream_ps(dst + 4, _mm256_castps256_ps128(p15));
+                _mm_stream_ps(dst + 8, _mm256_castps256_ps128(p26));
+                _mm_stream_ps(dst + 12, _mm256_castps256_ps128(p37));
+                _mm_stream_ps(dst + 16, _mm256_extractf128_ps(p04, 1));
+                _mm_stream_ps(dst + 20, _mm256_extractf128_ps(p15, 1));
+                _mm_stream_ps(dst + 24, _mm256_extractf128_ps(p26, 1));
+                _mm_stream_ps(dst + 28, _mm256_extractf128_ps(p37, 1));
+            }
+
+        } // namespace
+
+        ENGINE_TARGET_AVX2 void emit(const Span& span, std::size_t count, const EmitParams& params, std::uint32_t seed) {
+            alignas(32) std::uint32_t seeds[8];
+            for (std::uint32_t lane = 0; lane < 8; ++lane) seeds[lane] = seedLane(seed, lane);
+            __m256i rng = _mm256_load_si256(reinterpret_cast<const __m256i*>(seeds));
+            const __m256 posJitter = _mm256_set1_ps(params.positionJitter);
+            const __m256 velJitter = _mm256_set1_ps(params.velocityJitter);
+
+            for (std::size_t i = 0; i < count; i += 8) {
+                __m256 v[kStreams];
+                for (int axis = 0; axis < 3; ++axis)
+                    v[kPosX + axis] = _mm256_fmadd_ps(signedUnit8(rng), posJitter, _mm256_set1_ps(params.position[axis]));
+                for (int axis = 0; axis < 3; ++axis)
+                    v[kVelX + axis] = _mm256_fmadd_ps(signedUnit8(rng), velJitter, _mm256_set1_ps(params.velocity[axis]));
+                v[kLife] = _mm256_fmadd_ps(unit8(rng), _mm256_set1_ps(params.lifeRange), _mm256_set1_ps(params.lifeMin));
+                v[kInvLifetime] = _mm256_div_ps(_mm256_set1_ps(1.0f), v[kLife]);
+
+                if (i + 8 <= count) {
+                    for (int stream = 0; stream < kStreams; ++stream) _mm256_storeu_ps(span.s[stream] + i, v[stream]);
+                }
+                else {
+                    alignas(32) float lanes[8];
+                    for (int stream = 0; stream < kStreams; ++stream) {
+                        _mm256_store_ps(lanes, v[stream]);
+                        for (std::size_t lane = 0; i + lane < count; ++lane) span.s[stream][i + lane] = lanes[lane];
+                    }
+                }
+            }
+        }
+
+        ENGINE_TARGET_AVX2 std::size_t simulate(const Span& span, std::size_t count, const SimParams& params, ParticleInstance* out) {
+            float* const* s = span.s;
+            const __m256 dt = _mm256_set1_ps(params.dt);
+            const __m256 damping = _mm256_set1_ps(params.damping);
+            const __m256 gx = _mm256_set1_ps(params.gravity[0]);
+            const __m256 gy = _mm256_set1_ps(params.gravity[1]);
+            const __m256 gz = _mm256_set1_ps(params.gravity[2]);
+            const __m256 zero = _mm256_setzero_ps();
+
+            std::size_t alive = 0, i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 vx = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(s[kVelX] + i), gx), damping);
+                __m256 vy = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(s[kVelY] + i), gy), damping);
+                __m256 vz = _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(s[kVelZ] + i), gz), damping);
+                __m256 px = _mm256_fmadd_ps(vx, dt, _mm256_loadu_ps(s[kPosX] + i));
+                __m256 py = _mm256_fmadd_ps(vy, dt, _mm256_loadu_ps(s[kPosY] + i));
+                __m256 pz = _mm256_fmadd_ps(vz, dt, _mm256_loadu_ps(s[kPosZ] + i));
+                __m256 life = _mm256_sub_ps(_mm256_loadu_ps(s[kLife] + i), dt);
+                __m256 invLifetime = _mm256_loadu_ps(s[kInvLifetime] + i);
+                int mask = _mm256_movemask_ps(_mm256_cmp_ps(life, zero, _CMP_GT_OQ));
+
+                if (mask == 0xFF) {
+                    _mm256_storeu_ps(s[kPosX] + alive, px); _mm256_storeu_ps(s[kPosY] + alive, py); _mm256_storeu_ps(s[kPosZ] + alive, pz);
+                    _mm256_storeu_ps(s[kVelX] + alive, vx); _mm256_storeu_ps(s[kVelY] + alive, vy); _mm256_storeu_ps(s[kVelZ] + alive, vz);
+                    _mm256_storeu_ps(s[kLife] + alive, life); _mm256_storeu_ps(s[kInvLifetime] + alive, invLifetime);
+                    if (out) streamInstances(out + alive, px, py, pz, _mm256_mul_ps(life, invLifetime));
+                    alive += 8;
+                }
+                else if (mask) {
+                    alignas(32) float lanes[kStreams][8];
+                    _mm256_store_ps(lanes[kPosX], px); _mm256_store_ps(lanes[kPosY], py); _mm256_store_ps(lanes[kPosZ], pz);
+                    _mm256_store_ps(lanes[kVelX], vx); _mm256_store_ps(lanes[kVelY], vy); _mm256_store_ps(lanes[kVelZ], vz);
+                    _mm256_store_ps(lanes[kLife], life); _mm256_store_ps(lanes[kInvLifetime], invLifetime);
+                    for (int lane = 0; lane < 8; ++lane) {
+                        if (!(mask & (1 << lane))) continue;
+                        for (int stream = 0; stream < kStreams; ++stream) s[stream][alive] = lanes[stream][lane];
+                        if (out) streamInstance(out + alive, lanes[kPosX][lane], lanes[kPosY][lane], lanes[kPosZ][lane],
+                                                lanes[kLife][lane] * lanes[kInvLifetime][lane]);
+                        ++alive;
+                    }
+                }
+            }
+            for (; i < count; ++i)
+                if (simulateOne(s, i, alive, params, out)) ++alive;
+            if (out) _mm_sfence();
+            return alive;
+        }
+
+    } // namespace avx2
+
+    const Kernels* sse2Kernels() {
+        static const Kernels kernels = { sse::emit, sse::simulate };
+        return &kernels;
+    }
+
+    const Kernels* avx2Kernels() {
+        static const Kernels kernels = { avx2::emit, avx2::simulate };
+        return &kernels;
+    }
+
+} // namespace engine::particles
+
+#else
+
+namespace engine::particles {
+    const Kernels* sse2Kernels() { return nullptr; }
+    const Kernels* avx2Kernels() { return nullptr; }
+}
+
+#endif
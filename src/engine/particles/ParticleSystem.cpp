@@ -0,0 +1,146 @@
+// src/engine/particles/ParticleSystem.cpp
+#include "engine/particles/ParticleSystem.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Memory.h"
+#include "engine/core/Profiler.h"
+#include "ParticleKernels.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+namespace engine {
+
+    namespace {
+
+        constexpr std::size_t kPoolAlignment = 64;
+
+        particles::Span spanAt(float* pool, std::size_t capacity, std::size_t index) {
+            particles::Span span;
+            for (int stream = 0; stream < particles::kStreams; ++stream) span.s[stream] = pool + stream * capacity + index;
+            return span;
+        }
+
+    } // namespace
+
+    ParticleSystem::~ParticleSystem() {
+        destroy();
+    }
+
+    // === LIFETIME ===
+    bool ParticleSystem::create(std::size_t capacity) {
+        destroy();
+        std::size_t chunks = (capacity + kChunkSize - 1) / kChunkSize;
+        if (chunks == 0) return false;
+
+        m_capacity = chunks * kChunkSize;
+        std::size_t bytes = m_capacity * particles::kStreams * sizeof(float);
+        m_pool = static_cast<float*>(memory::resource(memory::Tag::Render)->allocate(bytes, kPoolAlignment));
+        m_counts.assign(chunks, 0u);
+        m_spans.reserve(chunks + kMaxEmitters);   // one emitter's run touches each chunk at most once
+        m_emitCursor = 0;
+        m_stats = Stats();
+        return true;
+    }
+
+    void ParticleSystem::destroy() {
+        if (!m_pool) return;
+        memory::resource(memory::Tag::Render)->deallocate(m_pool, m_capacity * particles::kStreams * sizeof(float), kPoolAlignment);
+        m_pool = nullptr;
+        m_capacity = 0;
+        m_counts.clear();
+    }
+
+    bool ParticleSystem::addEmitter(const ParticleEmitter& emitter, std::uint32_t* id) {
+        if (m_emitterCount == kMaxEmitters) {
+            std::cerr << "ParticleSystem: more than " << kMaxEmitters << " emitters" << std::endl;
+            return false;
+        }
+        if (id) *id = static_cast<std::uint32_t>(m_emitterCount);
+        m_emitDebt[m_emitterCount] = 0.0f;
+        m_emitters[m_emitterCount++] = emitter;
+        return true;
+    }
+
+    // === UPDATE ===
+    void ParticleSystem::planEmission(float dt) {
+        // Claims free tail space chunk by chunk, starting where the last claim
+        // stopped, and counts it as live right away so simulate() includes it
+        m_spans.clear();
+        m_stats.emitted = 0;
+        std::size_t chunks = m_counts.size();
+        for (std::size_t e = 0; e < m_emitterCount; ++e) {
+            m_emitDebt[e] += m_emitters[e].rate * dt;
+            std::size_t want = static_cast<std::size_t>(m_emitDebt[e]);
+            m_emitDebt[e] -= static_cast<float>(want);
+
+            for (std::size_t visited = 0; want > 0 && visited < chunks; ++visited) {
+                std::uint32_t& count = m_counts[m_emitCursor];
+                std::size_t take = std::min<std::size_t>(kChunkSize - count, want);
+                if (take > 0) {
+                    m_spans.push_back({ static_cast<std::uint32_t>(m_emitCursor), count, static_cast<std::uint32_t>(take), static_cast<std::uint32_t>(e) });
+                    count += static_cast<std::uint32_t>(take);
+                    want -= take;
+                    m_stats.emitted += take;
+                }
+                if (want > 0) m_emitCursor = (m_emitCursor + 1) % chunks;
+            }
+            m_stats.dropped += want;   // pool full; the rest are not owed later
+        }
+    }
+
+    void ParticleSystem::update(float dt, JobSystem* jobs, ParticleInstance* out) {
+        ENGINE_PROFILE_SCOPE("ParticleSystem::update");
+        assert(reinterpret_cast<std::uintptr_t>(out) % alignof(ParticleInstance) == 0 && "particle output must be 16-byte aligned");
+        if (!m_pool) return;
+
+        std::size_t before = 0;
+        for (std::uint32_t count : m_counts) before += count;
+        planEmission(dt);
+        m_seed = particles::xorshift(m_seed);
+
+        const particles::Kernels& kernels = particles::activeKernels();
+        particles::EmitParams emitParams[kMaxEmitters];
+        for (std::size_t e = 0; e < m_emitterCount; ++e) {
+            const ParticleEmitter& emitter = m_emitters[e];
+            emitParams[e] = { { emitter.position.x, emitter.position.y, emitter.position.z },
+                              { emitter.velocity.x, emitter.velocity.y, emitter.velocity.z },
+                              emitter.positionJitter, emitter.velocityJitter,
+                              emitter.lifeMin, std::max(emitter.lifeMax - emitter.lifeMin, 0.0f) };
+        }
+
+        // EMIT: spans never overlap, so each is its own job
+        auto emitSpans = [&](std::size_t first, std::size_t last) {
+            for (std::size_t i = first; i < last; ++i) {
+                const EmitSpan& span = m_spans[i];
+                kernels.emit(spanAt(m_pool, m_capacity, span.chunk * kChunkSize + span.first), span.count,
+                             emitParams[span.emitter], m_seed + static_cast<std::uint32_t>(i) * 0x9E3779B9u);
+            }
+        };
+        if (jobs) jobs->parallelFor(m_spans.size(), 1, emitSpans);
+        else emitSpans(0, m_spans.size());
+
+        // INTEGRATE, KILL, COMPACT, STREAM: one chunk per job
+        particles::SimParams params;
+        params.dt = dt;
+        params.gravity[0] = m_gravity.x * dt;
+        params.gravity[1] = m_gravity.y * dt;
+        params.gravity[2] = m_gravity.z * dt;
+        params.damping = std::max(1.0f - m_drag * dt, 0.0f);
+        auto simulateChunks = [&](std::size_t first, std::size_t last) {
+            for (std::size_t c = first; c < last; ++c) {
+                if (m_counts[c] == 0) continue;
+                m_counts[c] = static_cast<std::uint32_t>(kernels.simulate(spanAt(m_pool, m_capacity, c * kChunkSize), m_counts[c],
+                                                                          params, out ? out + c * kChunkSize : nullptr));
+            }
+        };
+        if (jobs) jobs->parallelFor(m_counts.size(), 1, simulateChunks);
+        else simulateChunks(0, m_counts.size());
+
+        std::size_t alive = 0;
+        for (std::uint32_t count : m_counts) alive += count;
+        m_stats.killed = before + m_stats.emitted - alive;
+        m_stats.alive = alive;
+    }
+
+} // namespace engine
@@ -0,0 +1,431 @@
+// src/engine/physics/Broadphase.cpp
+#include "engine/physics/Broadphase.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Memory.h"
+#include "engine/core/Profiler.h"
+#include "../math/MathKernels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#if defined(ENGINE_MATH_X86)
+#include <emmintrin.h>
+#elif defined(ENGINE_MATH_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace engine {
+
+    namespace {
+
+        float axisValue(const math::Vec3& v, int axis) {
+            return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+        }
+
+        bool overlaps(const math::Aabb& a, const math::Aabb& b) {
+            return a.min.x <= b.max.x && a.max.x >= b.min.x
+                && a.min.y <= b.max.y && a.max.y >= b.min.y
+                && a.min.z <= b.max.z && a.max.z >= b.min.z;
+        }
+
+        void pushPair(std::vector<BodyPair>& out, std::uint32_t a, std::uint32_t b) {
+            if (out.size() == out.capacity()) {
+                memory::AllowHeap allow;   // a new high-water mark for this slice
+                out.reserve(std::max<std::size_t>(out.capacity() * 2, 256));
+            }
+            out.push_back(a < b ? BodyPair{ a, b } : BodyPair{ b, a });
+        }
+
+        // fn(slice) for every slice, spread over jobs when given
+        template <typename Fn>
+        void runSlices(JobSystem* jobs, std::size_t slices, Fn&& fn) {
+            auto body = [&fn](std::size_t first, std::size_t last) {
+                for (std::size_t s = first; s < last; ++s) fn(s);
+            };
+            if (jobs) jobs->parallelFor(slices, 1, body);
+            else body(0, slices);
+        }
+
+        void prepareSlices(std::vector<std::vector<BodyPair>>& slices, std::size_t count) {
+            if (slices.size() < count) {
+                memory::AllowHeap allow;
+                slices.resize(count);
+            }
+            for (std::size_t s = 0; s < count; ++s) slices[s].clear();
+        }
+
+        // Concatenates the first `count` slice lists in slice order
+        void joinSlices(const std::vector<std::vector<BodyPair>>& slices, std::size_t count, std::vector<std::size_t>& offsets,
+                        std::vector<BodyPair>& out, JobSystem* jobs) {
+            if (offsets.size() < count + 1) {
+                memory::AllowHeap allow;
+                offsets.resize(std::max(offsets.size(), count + 1));
+            }
+            offsets[0] = 0;
+            for (std::size_t s = 0; s < count; ++s) offsets[s + 1] = offsets[s] + slices[s].size();
+            if (offsets[count] > out.capacity()) {
+                memory::AllowHeap allow;
+                out.reserve(offsets[count]);
+            }
+            out.resize(offsets[count]);
+            runSlices(jobs, count, [&](std::size_t s) {
+                if (!slices[s].empty()) std::memcpy(out.data() + offsets[s], slices[s].data(), slices[s].size() * sizeof(BodyPair));
+            });
+        }
+
+        template <typename T>
+        void resizeFor(std::vector<T>& v, std::size_t size) {
+            if (size > v.capacity()) {
+                memory::AllowHeap allow;   // only when the body count reaches a new high
+                v.reserve(size);
+            }
+            v.resize(size);
+        }
+
+    } // namespace
+
+    // === SWEEP AND PRUNE ===
+    void SweepAndPrune::update(const math::Aabb* bounds, std::size_t count, JobSystem* jobs) {
+        ENGINE_PROFILE_SCOPE("SweepAndPrune::update");
+        m_stats.bodies = count;
+        m_stats.sortMoves = 0;
+
+        // SORT: last update's order, repaired; a full sort when the bodies
+        // changed or moved too far for insertion sort to stay linear
+        if (count != m_order.size()) {
+            fullSort(bounds, count);
+        }
+        else {
+            for (std::size_t i = 0; i < count; ++i) m_keys[i] = axisValue(bounds[m_order[i]].min, m_axes[0]);
+            if (!insertionSort(4 * count + 64)) fullSort(bounds, count);
+        }
+        m_stats.axis = m_axes[0];
+
+        // GATHER: the other endpoints into sorted SoA arrays
+        std::size_t slices = (count + kSliceBodies - 1) / kSliceBodies;
+        runSlices(jobs, slices, [&](std::size_t s) {
+            std::size_t last = std::min((s + 1) * kSliceBodies, count);
+            for (std::size_t i = s * kSliceBodies; i < last; ++i) {
+                const math::Aabb& box = bounds[m_order[i]];
+                m_sweepMax[i] = axisValue(box.max, m_axes[0]);
+                for (int k = 0; k < 2; ++k) {
+                    m_min[k][i] = axisValue(box.min, m_axes[k + 1]);
+                    m_max[k][i] = axisValue(box.max, m_axes[k + 1]);
+                }
+            }
+        });
+
+        // SCAN
+        prepareSlices(m_slicePairs, slices);
+        runSlices(jobs, slices, [&](std::size_t s) { scanSlice(s, m_slicePairs[s]); });
+        joinSlices(m_slicePairs, slices, m_sliceOffsets, m_pairs, jobs);
+        m_stats.pairs = m_pairs.size();
+    }
+
+    void SweepAndPrune::fullSort(const math::Aabb* bounds, std::size_t count) {
+        ENGINE_PROFILE_SCOPE("SweepAndPrune::fullSort");
+        // Sweep along the axis the centers spread most on: the fewest boxes share a slab of it
+        double sum[3] = {}, sumSquares[3] = {};
+        for (std::size_t i = 0; i < count; ++i)
+            for (int axis = 0; axis < 3; ++axis) {
+                double center = 0.5 * (static_cast<double>(axisValue(bounds[i].min, axis)) + axisValue(bounds[i].max, axis));
+                sum[axis] += center;
+                sumSquares[axis] += center * center;
+            }
+        int sweep = 0;
+        double widest = -1.0;
+        for (int axis = 0; axis < 3; ++axis) {
+            double mean = count ? sum[axis] / count : 0.0;
+            double variance = count ? sumSquares[axis] / count - mean * mean : 0.0;
+            if (variance > widest) {
+                widest = variance;
+                sweep = axis;
+            }
+        }
+        m_axes[0] = sweep;
+        m_axes[1] = (sweep + 1) % 3;
+        m_axes[2] = (sweep + 2) % 3;
+
+        // Ties break on the body index, so the order is a function of the input alone
+        resizeFor(m_order, count);
+        std::iota(m_order.begin(), m_order.end(), 0u);
+        std::sort(m_order.begin(), m_order.end(), [bounds, sweep](std::uint32_t a, std::uint32_t b) {
+            float ka = axisValue(bounds[a].min, sweep), kb = axisValue(bounds[b].min, sweep);
+            return ka < kb || (ka == kb && a < b);
+        });
+
+        resizeFor(m_keys, count + kPadding);
+        resizeFor(m_sweepMax, count + kPadding);
+        for (int k = 0; k < 2; ++k) {
+            resizeFor(m_min[k], count + kPadding);
+            resizeFor(m_max[k], count + kPadding);
+        }
+        for (std::size_t i = 0; i < count; ++i) m_keys[i] = axisValue(bounds[m_order[i]].min, sweep);
+        std::fill(m_keys.begin() + count, m_keys.end(), std::numeric_limits<float>::infinity());
+        ++m_stats.fullSorts;
+    }
+
+    bool SweepAndPrune::insertionSort(std::size_t moveLimit) {
+        std::size_t moves = 0;
+        for (std::size_t i = 1; i < m_order.size(); ++i) {
+            float key = m_keys[i];
+            std::uint32_t body = m_order[i];
+            std::size_t j = i;
+            while (j > 0 && (m_keys[j - 1] > key || (m_keys[j - 1] == key && m_order[j - 1] > body))) {
+                m_keys[j] = m_keys[j - 1];
+                m_order[j] = m_order[j - 1];
+                --j;
+                if (++moves > moveLimit) {
+                    m_stats.sortMoves = moves;
+                    return false;   // order is now inconsistent; the caller re-sorts from scratch
+                }
+            }
+            m_keys[j] = key;
+            m_order[j] = body;
+        }
+        m_stats.sortMoves = moves;
+        return true;
+    }
+
+    void SweepAndPrune::scanSlice(std::size_t slice, std::vector<BodyPair>& out) const {
+        std::size_t first = slice * kSliceBodies;
+        std::size_t last = std::min(first + kSliceBodies, m_order.size());
+        const float* keys = m_keys.data();
+        const float* minA = m_min[0].data();
+        const float* maxA = m_max[0].data();
+        const float* minB = m_min[1].data();
+        const float* maxB = m_max[1].data();
+        const std::uint32_t* order = m_order.data();
+#if defined(ENGINE_MATH_X86) || defined(ENGINE_MATH_NEON)
+        bool simd = math::simdLevel() != math::SimdLevel::Scalar;
+#endif
+
+        for (std::size_t i = first; i < last; ++i) {
+            // Successors start at or after this body's minimum, so only
+            // "starts before our maximum" is left to test on the sweep axis;
+            // the +inf padding ends every scan without a bounds check
+            const float reach = m_sweepMax[i];
+            std::size_t j = i + 1;
+#if defined(ENGINE_MATH_X86)
+            if (simd) {
+                const __m128 vReach = _mm_set1_ps(reach);
+                const __m128 vMinA = _mm_set1_ps(minA[i]), vMaxA = _mm_set1_ps(maxA[i]);
+                const __m128 vMinB = _mm_set1_ps(minB[i]), vMaxB = _mm_set1_ps(maxB[i]);
+                for (;; j += 4) {
+                    __m128 inRange = _mm_cmple_ps(_mm_loadu_ps(keys + j), vReach);
+                    int live = _mm_movemask_ps(inRange);
+                    if (!live) break;
+                    __m128 hit = _mm_and_ps(inRange, _mm_cmple_ps(_mm_loadu_ps(minA + j), vMaxA));
+                    hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_loadu_ps(maxA + j), vMinA));
+                    hit = _mm_and_ps(hit, _mm_cmple_ps(_mm_loadu_ps(minB + j), vMaxB));
+                    hit = _mm_and_ps(hit, _mm_cmpge_ps(_mm_loadu_ps(maxB + j), vMinB));
+                    int mask = _mm_movemask_ps(hit);
+                    for (int lane = 0; mask; ++lane, mask >>= 1)
+                        if (mask & 1) pushPair(out, order[i], order[j + lane]);
+                    if (live != 0xF) break;
+                }
+                continue;
+            }
+#elif defined(ENGINE_MATH_NEON)
+            if (simd) {
+                static const std::uint32_t kLaneBits[4] = { 1, 2, 4, 8 };
+                const uint32x4_t laneBits = vld1q_u32(kLaneBits);
+                const float32x4_t vReach = vdupq_n_f32(reach);
+                const float32x4_t vMinA = vdupq_n_f32(minA[i]), vMaxA = vdupq_n_f32(maxA[i]);
+                const float32x4_t vMinB = vdupq_n_f32(minB[i]), vMaxB = vdupq_n_f32(maxB[i]);
+                for (;; j += 4) {
+                    uint32x4_t inRange = vcleq_f32(vld1q_f32(keys + j), vReach);
+                    std::uint32_t live = vaddvq_u32(vandq_u32(inRange, laneBits));
+                    if (!live) break;
+                    uint32x4_t hit = vandq_u32(inRange, vcleq_f32(vld1q_f32(minA + j), vMaxA));
+                    hit = vandq_u32(hit, vcgeq_f32(vld1q_f32(maxA + j), vMinA));
+                    hit = vandq_u32(hit, vcleq_f32(vld1q_f32(minB + j), vMaxB));
+                    hit = vandq_u32(hit, vcgeq_f32(vld1q_f32(maxB + j), vMinB));
+                    std::uint32_t mask = vaddvq_u32(vandq_u32(hit, laneBits));
+                    for (int lane = 0; mask; ++lane, mask >>= 1)
+                        if (mask & 1) pushPair(out, order[i], order[j + lane]);
+                    if (live != 0xF) break;
+                }
+                continue;
+            }
+#endif
+            for (; keys[j] <= reach; ++j)
+                if (minA[j] <= maxA[i] && maxA[j] >= minA[i] && minB[j] <= maxB[i] && maxB[j] >= minB[i])
+                    pushPair(out, order[i], order[j]);
+        }
+    }
+
+    // === SPATIAL HASH GRID ===
+    namespace {
+
+        // Cell coordinates are packed 21 bits per axis; far-away bodies
+        // clamp into the outermost cells, which only costs extra tests
+        constexpr std::int32_t kCellLimit = (1 << 20) - 1;
+
+        std::int32_t cellCoord(float value, float invCellSize) {
+            float cell = std::floor(value * invCellSize);
+            if (!(cell > -kCellLimit)) return -kCellLimit;   // also NaN
+            if (cell > kCellLimit) return kCellLimit;
+            return static_cast<std::int32_t>(cell);
+        }
+
+        std::uint64_t packCell(std::int32_t x, std::int32_t y, std::int32_t z) {
+            constexpr std::uint64_t kMask = (1u << 21) - 1;
+            return ((static_cast<std::uint64_t>(x) & kMask) << 42)
+                | ((static_cast<std::uint64_t>(y) & kMask) << 21)
+                | (static_cast<std::uint64_t>(z) & kMask);
+        }
+
+        std::uint32_t bucketOf(std::uint64_t cell, int bits) {
+            return static_cast<std::uint32_t>((cell * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+        }
+
+    } // namespace
+
+    SpatialHashGrid::CellRange SpatialHashGrid::cellRange(const math::Aabb& box) const {
+        CellRange range;
+        for (int axis = 0; axis < 3; ++axis) {
+            range.lo[axis] = cellCoord(axisValue(box.min, axis), m_invCellSize);
+            range.hi[axis] = std::max(cellCoord(axisValue(box.max, axis), m_invCellSize), range.lo[axis]);
+        }
+        return range;
+    }
+
+    void SpatialHashGrid::update(const math::Aabb* bounds, std::size_t count, JobSystem* jobs) {
+        ENGINE_PROFILE_SCOPE("SpatialHashGrid::update");
+        std::size_t bodySlices = (count + kSliceBodies - 1) / kSliceBodies;
+
+        // CELL SIZE: per-slice sums added in slice order, so it is reproducible too
+        float cellSize = m_fixedCellSize;
+        if (cellSize <= 0.0f) {
+            resizeFor(m_sliceExtent, bodySlices);
+            runSlices(jobs, bodySlices, [&](std::size_t s) {
+                double sum = 0.0;
+                std::size_t last = std::min((s + 1) * kSliceBodies, count);
+                for (std::size_t i = s * kSliceBodies; i < last; ++i) {
+                    const math::Aabb& box = bounds[i];
+                    sum += std::max({ box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z });
+                }
+                m_sliceExtent[s] = sum;
+            });
+            double total = 0.0;
+            for (std::size_t s = 0; s < bodySlices; ++s) total += m_sliceExtent[s];
+            cellSize = count ? static_cast<float>(2.0 * total / count) : 1.0f;
+            if (!(cellSize > 0.0f) || !std::isfinite(cellSize)) cellSize = 1.0f;   // points, or garbage in
+        }
+        m_invCellSize = 1.0f / cellSize;
+
+        // COUNT: cells per body, then offsets; large bodies get none and go on their own list
+        constexpr std::uint32_t kLarge = ~0u;
+        resizeFor(m_entryStart, count + 1);
+        runSlices(jobs, bodySlices, [&](std::size_t s) {
+            std::size_t last = std::min((s + 1) * kSliceBodies, count);
+            for (std::size_t i = s * kSliceBodies; i < last; ++i) {
+                CellRange range = cellRange(bounds[i]);
+                std::uint64_t cells = 1;
+                for (int axis = 0; axis < 3; ++axis) cells *= static_cast<std::uint64_t>(range.hi[axis] - range.lo[axis] + 1);
+                m_entryStart[i] = cells > kMaxCellsPerBody ? kLarge : static_cast<std::uint32_t>(cells);
+            }
+        });
+        m_large.clear();
+        std::uint32_t entries = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::uint32_t cells = m_entryStart[i];
+            if (cells == kLarge) {
+                if (m_large.size() == m_large.capacity()) {
+                    memory::AllowHeap allow;
+                    m_large.reserve(std::max<std::size_t>(m_large.capacity() * 2, 16));
+                }
+                m_large.push_back(static_cast<std::uint32_t>(i));
+                cells = 0;
+            }
+            m_entryStart[i] = entries;
+            entries += cells;
+        }
+        m_entryStart[count] = entries;
+
+        // FILL: one entry per body per cell
+        resizeFor(m_entries, entries);
+        runSlices(jobs, bodySlices, [&](std::size_t s) {
+            std::size_t last = std::min((s + 1) * kSliceBodies, count);
+            for (std::size_t i = s * kSliceBodies; i < last; ++i) {
+                if (m_entryStart[i] == m_entryStart[i + 1]) continue;
+                const math::Aabb& box = bounds[i];
+                CellRange range = cellRange(box);
+                Entry* out = m_entries.data() + m_entryStart[i];
+                for (std::int32_t x = range.lo[0]; x <= range.hi[0]; ++x)
+                    for (std::int32_t y = range.lo[1]; y <= range.hi[1]; ++y)
+                        for (std::int32_t z = range.lo[2]; z <= range.hi[2]; ++z)
+                            *out++ = { packCell(x, y, z), static_cast<std::uint32_t>(i), box };
+            }
+        });
+
+        // BUCKET: counting sort on the hash, at most one entry per bucket on
+        // average. Stable, so every bucket lists its bodies in ascending order.
+        m_bucketBits = 4;
+        while ((std::size_t(1) << m_bucketBits) < entries) ++m_bucketBits;
+        std::size_t buckets = std::size_t(1) << m_bucketBits;
+        resizeFor(m_bucketStart, buckets + 1);
+        std::fill(m_bucketStart.begin(), m_bucketStart.end(), 0u);
+        for (const Entry& entry : m_entries) ++m_bucketStart[bucketOf(entry.cell, m_bucketBits) + 1];
+        for (std::size_t b = 0; b < buckets; ++b) m_bucketStart[b + 1] += m_bucketStart[b];
+        resizeFor(m_bucketed, entries);
+        for (const Entry& entry : m_entries) m_bucketed[m_bucketStart[bucketOf(entry.cell, m_bucketBits)]++] = entry;
+        // Each start was advanced to the next bucket's; shift them back
+        std::memmove(m_bucketStart.data() + 1, m_bucketStart.data(), buckets * sizeof(std::uint32_t));
+        m_bucketStart[0] = 0;
+
+        // PAIRS: bucket slices, then one slice per large body
+        std::size_t bucketSlices = (buckets + kSliceBuckets - 1) / kSliceBuckets;
+        std::size_t slices = bucketSlices + m_large.size();
+        prepareSlices(m_slicePairs, slices);
+        runSlices(jobs, slices, [&](std::size_t s) {
+            if (s < bucketSlices) scanBuckets(s, m_slicePairs[s]);
+            else scanLarge(s - bucketSlices, bounds, count, m_slicePairs[s]);
+        });
+        joinSlices(m_slicePairs, slices, m_sliceOffsets, m_pairs, jobs);
+
+        m_stats.bodies = count;
+        m_stats.pairs = m_pairs.size();
+        m_stats.entries = entries;
+        m_stats.buckets = buckets;
+        m_stats.largeBodies = m_large.size();
+        m_stats.cellSize = cellSize;
+    }
+
+    void SpatialHashGrid::scanBuckets(std::size_t slice, std::vector<BodyPair>& out) const {
+        std::size_t buckets = std::size_t(1) << m_bucketBits;
+        std::size_t last = std::min((slice + 1) * kSliceBuckets, buckets);
+        for (std::size_t b = slice * kSliceBuckets; b < last; ++b) {
+            const Entry* begin = m_bucketed.data() + m_bucketStart[b];
+            const Entry* end = m_bucketed.data() + m_bucketStart[b + 1];
+            for (const Entry* p = begin; p < end; ++p)
+                for (const Entry* q = p + 1; q < end; ++q) {
+                    // Other cells can hash here too; a body appears once per cell
+                    if (q->cell != p->cell) continue;
+                    const math::Aabb& a = p->box;
+                    const math::Aabb& c = q->box;
+                    if (!overlaps(a, c)) continue;
+                    // Only the cell holding the intersection's low corner reports the pair
+                    std::uint64_t owner = packCell(cellCoord(std::max(a.min.x, c.min.x), m_invCellSize),
+                                                   cellCoord(std::max(a.min.y, c.min.y), m_invCellSize),
+                                                   cellCoord(std::max(a.min.z, c.min.z), m_invCellSize));
+                    if (owner == p->cell) pushPair(out, p->body, q->body);
+                }
+        }
+    }
+
+    void SpatialHashGrid::scanLarge(std::size_t large, const math::Aabb* bounds, std::size_t count, std::vector<BodyPair>& out) const {
+        std::uint32_t body = m_large[large];
+        for (std::size_t other = 0; other < count; ++other) {
+            if (other == body) continue;
+            // Two large bodies: only the lower one reports
+            bool otherLarge = m_entryStart[other] == m_entryStart[other + 1];
+            if (otherLarge && other < body) continue;
+            if (overlaps(bounds[body], bounds[other])) pushPair(out, body, static_cast<std::uint32_t>(other));
+        }
+    }
+
+} // namespace engine
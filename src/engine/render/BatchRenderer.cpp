@@ -0,0 +1,218 @@
+// src/engine/render/BatchRenderer.cpp
+#include "engine/render/BatchRenderer.h"
+#include "engine/render/GLDevice.h"
+#include "engine/core/Profiler.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace engine {
+
+    namespace {
+
+        // Layout fixed by the GL spec for GL_DRAW_INDIRECT_BUFFER
+        struct DrawElementsIndirectCommand {
+            GLuint count;
+            GLuint instanceCount;
+            GLuint firstIndex;
+            GLint baseVertex;
+            GLuint baseInstance;
+        };
+
+        constexpr GLuint kVertexBinding = 0;
+        constexpr GLuint kInstanceBinding = 1;
+        constexpr GLuint kInstanceMatrixLocation = 2;   // mat4 takes locations 2..5
+
+    } // namespace
+
+    BatchRenderer::~BatchRenderer() {
+        shutdown();
+    }
+
+    bool BatchRenderer::initialize(std::size_t initialInstances) {
+        m_vao = gldevice::createVertexArray();
+
+        glEnableVertexArrayAttrib(m_vao, 0);
+        glVertexArrayAttribFormat(m_vao, 0, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, position));
+        glVertexArrayAttribBinding(m_vao, 0, kVertexBinding);
+        glEnableVertexArrayAttrib(m_vao, 1);
+        glVertexArrayAttribFormat(m_vao, 1, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, color));
+        glVertexArrayAttribBinding(m_vao, 1, kVertexBinding);
+
+        for (GLuint column = 0; column < 4; ++column) {
+            GLuint location = kInstanceMatrixLocation + column;
+            glEnableVertexArrayAttrib(m_vao, location);
+            glVertexArrayAttribFormat(m_vao, location, 4, GL_FLOAT, GL_FALSE, column * 4 * sizeof(float));
+            glVertexArrayAttribBinding(m_vao, location, kInstanceBinding);
+        }
+        glVertexArrayBindingDivisor(m_vao, kInstanceBinding, 1);
+
+        return reserveInstances(std::max<std::size_t>(initialInstances, 1)) && reserveCommands(64);
+    }
+
+    void BatchRenderer::shutdown() {
+        m_instances.destroy();
+        m_commands.destroy();
+        m_instanceCapacity = 0;
+        m_commandCapacity = 0;
+        gldevice::deleteBuffer(m_vertexBuffer);
+        gldevice::deleteBuffer(m_indexBuffer);
+        gldevice::deleteVertexArray(m_vao);
+        m_vertexCapacity = m_vertexCount = m_indexCapacity = m_indexCount = 0;
+        m_meshes.clear();
+    }
+
+    bool BatchRenderer::reserveGeometry(std::size_t vertexCount, std::size_t indexCount) {
+        // Doubling growth; the old contents move with a GPU-side copy and
+        // the old buffer is released once the copy (and any draw) is done
+        auto grow = [](unsigned int& buffer, std::size_t& capacity, std::size_t used, std::size_t needed, std::size_t elementBytes) {
+            if (needed <= capacity) return;
+            std::size_t newCapacity = std::max(needed, std::max<std::size_t>(capacity * 2, 4096));
+            unsigned int newBuffer = gldevice::createBuffer(newCapacity * elementBytes, nullptr, GL_DYNAMIC_STORAGE_BIT);
+            if (buffer) {
+                if (used) glCopyNamedBufferSubData(buffer, newBuffer, 0, 0, static_cast<GLsizeiptr>(used * elementBytes));
+                gldevice::deleteBuffer(buffer);
+            }
+            buffer = newBuffer;
+            capacity = newCapacity;
+        };
+
+        if (m_vertexCount + vertexCount > std::numeric_limits<std::int32_t>::max()
+            || m_indexCount + indexCount > std::numeric_limits<std::uint32_t>::max()) {
+            std::cerr << "BatchRenderer: geometry arena full" << std::endl;
+            return false;
+        }
+        grow(m_vertexBuffer, m_vertexCapacity, m_vertexCount, m_vertexCount + vertexCount, sizeof(Vertex));
+        grow(m_indexBuffer, m_indexCapacity, m_indexCount, m_indexCount + indexCount, sizeof(std::uint32_t));
+
+        glVertexArrayVertexBuffer(m_vao, kVertexBinding, m_vertexBuffer, 0, sizeof(Vertex));
+        glVertexArrayElementBuffer(m_vao, m_indexBuffer);
+        return true;
+    }
+
+    std::uint32_t BatchRenderer::reserveMesh() {
+        m_meshes.push_back(MeshRange{ 0, 0, 0 });
+        return static_cast<std::uint32_t>(m_meshes.size() - 1);
+    }
+
+    std::uint32_t BatchRenderer::addMesh(const Vertex* vertices, std::size_t vertexCount, const std::uint32_t* indices, std::size_t indexCount) {
+        std::uint32_t mesh = reserveMesh();
+        if (!reserveGeometry(vertexCount, indexCount)) return mesh;
+
+        MeshRange& range = m_meshes[mesh];
+        range.firstIndex = static_cast<std::uint32_t>(m_indexCount);
+        range.indexCount = static_cast<std::uint32_t>(indexCount);
+        range.baseVertex = static_cast<std::int32_t>(m_vertexCount);
+
+        glNamedBufferSubData(m_vertexBuffer, static_cast<GLintptr>(m_vertexCount * sizeof(Vertex)), static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices);
+        glNamedBufferSubData(m_indexBuffer, static_cast<GLintptr>(m_indexCount * sizeof(std::uint32_t)), static_cast<GLsizeiptr>(indexCount * sizeof(std::uint32_t)), indices);
+        m_vertexCount += vertexCount;
+        m_indexCount += indexCount;
+        return mesh;
+    }
+
+    bool BatchRenderer::setMeshFromBuffer(std::uint32_t mesh, unsigned int source, std::size_t vertexOffset, std::size_t vertexCount, std::size_t indexOffset, std::size_t indexCount) {
+        if (mesh >= m_meshes.size() || !reserveGeometry(vertexCount, indexCount)) return false;
+
+        MeshRange& range = m_meshes[mesh];
+        range.firstIndex = static_cast<std::uint32_t>(m_indexCount);
+        range.indexCount = static_cast<std::uint32_t>(indexCount);
+        range.baseVertex = static_cast<std::int32_t>(m_vertexCount);
+
+        // Ordered before any later draw by GL, so the mesh is complete the first frame it is used
+        glCopyNamedBufferSubData(source, m_vertexBuffer, static_cast<GLintptr>(vertexOffset), static_cast<GLintptr>(m_vertexCount * sizeof(Vertex)), static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)));
+        glCopyNamedBufferSubData(source, m_indexBuffer, static_cast<GLintptr>(indexOffset), static_cast<GLintptr>(m_indexCount * sizeof(std::uint32_t)), static_cast<GLsizeiptr>(indexCount * sizeof(std::uint32_t)));
+        m_vertexCount += vertexCount;
+        m_indexCount += indexCount;
+        return true;
+    }
+
+    bool BatchRenderer::reserveInstances(std::size_t count) {
+        if (count <= m_instanceCapacity) return true;
+        std::size_t capacity = std::max(count, m_instanceCapacity * 2);
+        if (!m_instances.create(capacity * sizeof(math::Mat4))) {
+            m_instanceCapacity = 0;
+            return false;
+        }
+        m_instanceCapacity = capacity;
+        return true;
+    }
+
+    bool BatchRenderer::reserveCommands(std::size_t count) {
+        if (count <= m_commandCapacity) return true;
+        std::size_t capacity = std::max(count, m_commandCapacity * 2);
+        if (!m_commands.create(capacity * sizeof(DrawElementsIndirectCommand), sizeof(DrawElementsIndirectCommand))) {
+            m_commandCapacity = 0;
+            return false;
+        }
+        m_commandCapacity = capacity;
+        return true;
+    }
+
+    bool BatchRenderer::beginPackets(const math::Mat4* mvps, const DrawPacket* packets, std::size_t count, const DrawBatch* batches, std::size_t batchCount) {
+        ENGINE_PROFILE_SCOPE("BatchRenderer::beginPackets");
+        m_stats = Stats();
+        if (count == 0 || m_meshes.empty() || !reserveInstances(count)) return false;
+
+        // Worst case one command per packet where the mesh changes or a batch starts
+        std::size_t runs = 0;
+        for (std::size_t b = 0; b < batchCount; ++b) {
+            for (std::uint32_t i = batches[b].first; i < batches[b].first + batches[b].count; ++i)
+                if (i == batches[b].first || packets[i].mesh != packets[i - 1].mesh) ++runs;
+        }
+        if (!reserveCommands(runs)) return false;
+
+        // Both sections are write-combined: every slot is written once, in
+        // order, and the open command is built locally rather than read back
+        auto* commands = static_cast<DrawElementsIndirectCommand*>(m_commands.beginSection());
+        auto* instances = static_cast<math::Mat4*>(m_instances.beginSection());
+        std::size_t commandCount = 0, instanceCount = 0;
+        m_batchCommands.resize(batchCount + 1);
+        for (std::size_t b = 0; b < batchCount; ++b) {
+            m_batchCommands[b] = static_cast<std::uint32_t>(commandCount);
+            DrawElementsIndirectCommand open{};
+            std::uint32_t openMesh = ~0u;
+            for (std::uint32_t i = batches[b].first; i < batches[b].first + batches[b].count; ++i) {
+                std::uint32_t mesh = packets[i].mesh;
+                if (mesh >= m_meshes.size() || !m_meshes[mesh].indexCount) continue;   // unknown, or still streaming in
+                if (mesh != openMesh) {
+                    if (open.instanceCount) commands[commandCount++] = open;
+                    const MeshRange& range = m_meshes[mesh];
+                    open = { range.indexCount, 0, range.firstIndex, range.baseVertex, static_cast<GLuint>(instanceCount) };
+                    openMesh = mesh;
+                }
+                instances[instanceCount++] = mvps[packets[i].instance];
+                ++open.instanceCount;
+            }
+            if (open.instanceCount) commands[commandCount++] = open;
+        }
+        m_batchCommands[batchCount] = static_cast<std::uint32_t>(commandCount);
+
+        glVertexArrayVertexBuffer(m_vao, kInstanceBinding, m_instances.buffer(), static_cast<GLintptr>(m_instances.sectionOffset()), sizeof(math::Mat4));
+        gldevice::bindVertexArray(m_vao);
+        gldevice::bindBuffer(gldevice::BufferTarget::DrawIndirect, m_commands.buffer());
+
+        m_stats.instances = instanceCount;
+        m_stats.commands = commandCount;
+        return true;
+    }
+
+    void BatchRenderer::drawBatch(std::size_t batch) {
+        std::uint32_t first = m_batchCommands[batch];
+        std::uint32_t count = m_batchCommands[batch + 1] - first;
+        if (!count) return;
+        std::size_t offset = m_commands.sectionOffset() + first * sizeof(DrawElementsIndirectCommand);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(offset), static_cast<GLsizei>(count), 0);
+        ++m_stats.drawCalls;
+    }
+
+    void BatchRenderer::endPackets() {
+        // The VAO and indirect buffer stay bound: nothing edits through
+        // bindings, and next frame's bind of the same names is filtered
+        m_instances.endSection();
+        m_commands.endSection();
+        m_stats.fenceStalls = m_instances.stallCount() + m_commands.stallCount();
+    }
+
+} // namespace engine
@@ -0,0 +1,221 @@
+// src/engine/render/Bvh.cpp
+#include "engine/render/Bvh.h"
+#include "engine/core/Profiler.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <functional>
+
+namespace engine {
+
+    namespace {
+
+        math::Aabb emptyBox() {
+            return { math::Vec3(FLT_MAX, FLT_MAX, FLT_MAX), math::Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX) };
+        }
+
+        void grow(math::Aabb& box, const math::Aabb& other) {
+            box.min = math::Vec3(std::min(box.min.x, other.min.x), std::min(box.min.y, other.min.y), std::min(box.min.z, other.min.z));
+            box.max = math::Vec3(std::max(box.max.x, other.max.x), std::max(box.max.y, other.max.y), std::max(box.max.z, other.max.z));
+        }
+
+        float surfaceArea(const math::Aabb& box) {
+            float dx = std::max(box.max.x - box.min.x, 0.0f);
+            float dy = std::max(box.max.y - box.min.y, 0.0f);
+            float dz = std::max(box.max.z - box.min.z, 0.0f);
+            return 2.0f * (dx * dy + dy * dz + dz * dx);
+        }
+
+    } // namespace
+
+    // === BUILD ===
+    void Bvh::build(const math::Aabb* bounds, std::size_t count) {
+        ENGINE_PROFILE_SCOPE("Bvh::build");
+        m_nodes.clear();
+        m_dirty.clear();
+        m_objects.resize(count);
+        m_order.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const math::Aabb& box = bounds[i];
+            m_objects[i].bounds = box;
+            m_order[i] = { { box.min.x + box.max.x, box.min.y + box.max.y, box.min.z + box.max.z }, static_cast<std::uint32_t>(i) };
+        }
+
+        m_area = 0.0;
+        m_rootBounds = emptyBox();
+        if (count) m_rootBounds = buildNode(kNone, 0, m_order.data(), m_order.data() + count);
+        m_builtArea = m_area;
+        ++m_stats.builds;
+
+        // Each node is dirtied or stacked at most once, so neither list grows mid-frame later
+        m_dirty.reserve(m_nodes.size());
+        m_stack.reserve(m_nodes.size());
+    }
+
+    math::Aabb Bvh::buildNode(std::uint32_t parent, std::uint32_t parentLane, BuildRef* begin, BuildRef* end) {
+        std::uint32_t index = static_cast<std::uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();   // value-initialized: zero bounds, no children
+        m_nodes[index].parent = parent;
+        m_nodes[index].parentLane = parentLane;
+
+        // Each child subtree holds up to `capacity` objects, the smallest power
+        // of kWidth that fits everything in kWidth children. Groups larger than
+        // that are split along the widest centroid axis, at the multiple of
+        // capacity nearest the median, so every subtree but one comes out full.
+        std::size_t capacity = 1;
+        while (capacity * kWidth < static_cast<std::size_t>(end - begin)) capacity *= kWidth;
+
+        BuildRef* cuts[kWidth + 1] = { begin, end };
+        std::size_t groups = 1;
+        for (;;) {
+            std::size_t largest = 0;
+            for (std::size_t g = 1; g < groups; ++g)
+                if (cuts[g + 1] - cuts[g] > cuts[largest + 1] - cuts[largest]) largest = g;
+            BuildRef* lo = cuts[largest];
+            BuildRef* hi = cuts[largest + 1];
+            std::size_t size = static_cast<std::size_t>(hi - lo);
+            if (size <= capacity) break;
+
+            float lowest[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, highest[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+            for (BuildRef* it = lo; it != hi; ++it) {
+                for (int a = 0; a < 3; ++a) {
+                    lowest[a] = std::min(lowest[a], it->centroid[a]);
+                    highest[a] = std::max(highest[a], it->centroid[a]);
+                }
+            }
+            int axis = 0;
+            for (int a = 1; a < 3; ++a)
+                if (highest[a] - lowest[a] > highest[axis] - lowest[axis]) axis = a;
+
+            std::size_t half = (size / 2 + capacity - 1) / capacity * capacity;
+            BuildRef* mid = lo + std::min(half, size - capacity);
+            std::nth_element(lo, mid, hi, [axis](const BuildRef& a, const BuildRef& b) {
+                return a.centroid[axis] < b.centroid[axis];
+            });
+            std::copy_backward(cuts + largest + 1, cuts + groups + 1, cuts + groups + 2);
+            cuts[largest + 1] = mid;
+            ++groups;
+        }
+
+        // Single objects sit directly in a lane; larger groups become child nodes
+        math::Aabb total = emptyBox();
+        for (std::size_t g = 0; g < groups; ++g) {
+            std::uint32_t lane = static_cast<std::uint32_t>(g);
+            math::Aabb box;
+            std::int32_t child;
+            if (cuts[g + 1] - cuts[g] == 1) {
+                std::uint32_t object = cuts[g]->object;
+                box = m_objects[object].bounds;
+                m_objects[object].node = index;
+                m_objects[object].lane = lane;
+                child = ~static_cast<std::int32_t>(object);
+            }
+            else {
+                child = static_cast<std::int32_t>(m_nodes.size());
+                box = buildNode(index, lane, cuts[g], cuts[g + 1]);   // may grow m_nodes
+            }
+            Node& node = m_nodes[index];
+            node.child[lane] = child;
+            setLane(node, lane, box);
+            grow(total, box);
+        }
+        m_nodes[index].count = static_cast<std::uint32_t>(groups);
+        m_area += surfaceArea(total);
+        return total;
+    }
+
+    // === REFIT ===
+    void Bvh::update(const math::Aabb* bounds, std::size_t count) {
+        if (count != m_objects.size()) {
+            build(bounds, count);
+            return;
+        }
+
+        ENGINE_PROFILE_SCOPE("Bvh::update");
+        for (std::size_t i = 0; i < count; ++i) {
+            ObjectRef& object = m_objects[i];
+            if (std::memcmp(&object.bounds, &bounds[i], sizeof(math::Aabb)) == 0) continue;
+            object.bounds = bounds[i];
+            setLane(m_nodes[object.node], object.lane, bounds[i]);
+            markDirty(object.node);
+        }
+        if (m_dirty.empty()) return;
+
+        refit();
+        if (m_area > kRebuildRatio * m_builtArea) build(bounds, count);
+    }
+
+    void Bvh::markDirty(std::uint32_t node) {
+        while (node != kNone && !m_nodes[node].dirty) {
+            m_nodes[node].dirty = true;
+            m_dirty.push_back(node);
+            node = m_nodes[node].parent;
+        }
+    }
+
+    void Bvh::refit() {
+        // Highest index first: every child is refit before its parent reads it
+        std::sort(m_dirty.begin(), m_dirty.end(), std::greater<std::uint32_t>());
+        for (std::uint32_t index : m_dirty) {
+            Node& node = m_nodes[index];
+            node.dirty = false;
+            math::Aabb box = nodeBounds(node);
+            if (node.parent == kNone) {
+                m_area += surfaceArea(box) - surfaceArea(m_rootBounds);
+                m_rootBounds = box;
+                continue;
+            }
+            Node& parent = m_nodes[node.parent];
+            std::uint32_t lane = node.parentLane;
+            math::Aabb old = { math::Vec3(parent.bounds[0][lane], parent.bounds[1][lane], parent.bounds[2][lane]),
+                               math::Vec3(parent.bounds[3][lane], parent.bounds[4][lane], parent.bounds[5][lane]) };
+            m_area += surfaceArea(box) - surfaceArea(old);
+            setLane(parent, lane, box);
+        }
+        m_stats.refitNodes += m_dirty.size();
+        m_dirty.clear();
+    }
+
+    void Bvh::setLane(Node& node, std::uint32_t lane, const math::Aabb& box) {
+        node.bounds[0][lane] = box.min.x;
+        node.bounds[1][lane] = box.min.y;
+        node.bounds[2][lane] = box.min.z;
+        node.bounds[3][lane] = box.max.x;
+        node.bounds[4][lane] = box.max.y;
+        node.bounds[5][lane] = box.max.z;
+    }
+
+    math::Aabb Bvh::nodeBounds(const Node& node) const {
+        math::Aabb box = emptyBox();
+        for (std::uint32_t lane = 0; lane < node.count; ++lane) {
+            grow(box, { math::Vec3(node.bounds[0][lane], node.bounds[1][lane], node.bounds[2][lane]),
+                        math::Vec3(node.bounds[3][lane], node.bounds[4][lane], node.bounds[5][lane]) });
+        }
+        return box;
+    }
+
+    // === CULL ===
+    void Bvh::cull(const math::Frustum& frustum, std::vector<std::uint32_t>& visible) {
+        ENGINE_PROFILE_SCOPE("Bvh::cull");
+        m_stats.nodesTested = 0;
+        if (m_nodes.empty()) return;
+
+        m_stack.clear();
+        m_stack.push_back(0);
+        while (!m_stack.empty()) {
+            const Node& node = m_nodes[m_stack.back()];
+            m_stack.pop_back();
+            ++m_stats.nodesTested;
+
+            // Unused lanes hold zeros and are masked off rather than tested
+            unsigned mask = math::frustumTest8(frustum, node.bounds[0]) & ((1u << node.count) - 1u);
+            for (std::uint32_t lane = 0; mask; ++lane, mask >>= 1) {
+                if (!(mask & 1u)) continue;
+                std::int32_t child = node.child[lane];
+                if (child >= 0) m_stack.push_back(static_cast<std::uint32_t>(child));
+                else visible.push_back(static_cast<std::uint32_t>(~child));
+            }
+        }
+    }
+
+} // namespace engine
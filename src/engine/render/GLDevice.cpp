@@ -0,0 +1,218 @@
+// src/engine/render/GLDevice.cpp
+#include "engine/render/GLDevice.h"
+#include <glad/glad.h>
+
+namespace engine::gldevice {
+
+    namespace {
+
+        constexpr unsigned kUnknown = 0xFFFFFFFFu;   // never a valid GL name
+
+        struct UniformBinding {
+            unsigned buffer = kUnknown;
+            std::size_t offset = 0;
+            std::size_t bytes = 0;
+        };
+
+        struct Shadow {
+            unsigned program = kUnknown;
+            unsigned vao = kUnknown;
+            unsigned buffers[static_cast<std::size_t>(BufferTarget::Count)] = { kUnknown, kUnknown, kUnknown, kUnknown };
+            UniformBinding uniforms[kMaxUniformBindings];
+
+            bool depthKnown = false, blendKnown = false, rasterKnown = false, clearKnown = false;
+            DepthState depth;
+            BlendState blend;
+            RasterState raster;
+            float clear[4] = {};
+        };
+
+        Shadow g_shadow;
+        Stats g_stats;
+
+        const GLenum kBufferTargets[] = { GL_DRAW_INDIRECT_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER };
+        static_assert(sizeof(kBufferTargets) / sizeof(kBufferTargets[0]) == static_cast<std::size_t>(BufferTarget::Count), "one GL enum per BufferTarget");
+
+        GLenum toGL(CompareFunc func) {
+            static const GLenum table[] = { GL_NEVER, GL_LESS, GL_EQUAL, GL_LEQUAL, GL_GREATER, GL_NOTEQUAL, GL_GEQUAL, GL_ALWAYS };
+            return table[static_cast<std::size_t>(func)];
+        }
+
+        GLenum toGL(BlendFactor factor) {
+            static const GLenum table[] = { GL_ZERO, GL_ONE, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_SRC_COLOR, GL_ONE_MINUS_SRC_COLOR, GL_DST_ALPHA, GL_ONE_MINUS_DST_ALPHA };
+            return table[static_cast<std::size_t>(factor)];
+        }
+
+        void setCapability(GLenum capability, bool enabled) {
+            if (enabled) glEnable(capability);
+            else glDisable(capability);
+            ++g_stats.issued;
+        }
+
+        // True (and the shadow updated) when value differs from what GL has
+        bool changed(unsigned& shadow, unsigned value) {
+            if (shadow == value) {
+                ++g_stats.filtered;
+                return false;
+            }
+            shadow = value;
+            ++g_stats.issued;
+            return true;
+        }
+
+    } // namespace
+
+    void reset() {
+        invalidate();
+        useProgram(0);
+        bindVertexArray(0);
+        for (std::size_t t = 0; t < static_cast<std::size_t>(BufferTarget::Count); ++t) bindBuffer(static_cast<BufferTarget>(t), 0);
+        setDepth(DepthState());
+        setBlend(BlendState());
+        setRaster(RasterState());
+        setClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    }
+
+    void invalidate() {
+        g_shadow = Shadow();
+    }
+
+    // === BINDINGS ===
+    void useProgram(unsigned program) {
+        if (changed(g_shadow.program, program)) glUseProgram(program);
+    }
+
+    void bindVertexArray(unsigned vao) {
+        if (changed(g_shadow.vao, vao)) glBindVertexArray(vao);
+    }
+
+    void bindBuffer(BufferTarget target, unsigned buffer) {
+        std::size_t index = static_cast<std::size_t>(target);
+        if (changed(g_shadow.buffers[index], buffer)) glBindBuffer(kBufferTargets[index], buffer);
+    }
+
+    void bindUniformBuffer(unsigned index, unsigned buffer, std::size_t offset, std::size_t bytes) {
+        if (index < kMaxUniformBindings) {
+            UniformBinding& shadow = g_shadow.uniforms[index];
+            if (shadow.buffer == buffer && shadow.offset == offset && shadow.bytes == bytes) {
+                ++g_stats.filtered;
+                return;
+            }
+            shadow = { buffer, offset, bytes };
+        }
+        glBindBufferRange(GL_UNIFORM_BUFFER, index, buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes));
+        ++g_stats.issued;
+    }
+
+    // === FIXED FUNCTION ===
+    // Only the parts of a state block that differ are sent
+    void setDepth(const DepthState& state) {
+        DepthState& shadow = g_shadow.depth;
+        bool known = g_shadow.depthKnown;
+        bool any = false;
+        if (!known || shadow.test != state.test) { setCapability(GL_DEPTH_TEST, state.test); any = true; }
+        if (!known || shadow.write != state.write) { glDepthMask(state.write ? GL_TRUE : GL_FALSE); ++g_stats.issued; any = true; }
+        if (!known || shadow.func != state.func) { glDepthFunc(toGL(state.func)); ++g_stats.issued; any = true; }
+        if (!any) ++g_stats.filtered;
+        shadow = state;
+        g_shadow.depthKnown = true;
+    }
+
+    void setBlend(const BlendState& state) {
+        BlendState& shadow = g_shadow.blend;
+        bool known = g_shadow.blendKnown;
+        bool any = false;
+        if (!known || shadow.enabled != state.enabled) { setCapability(GL_BLEND, state.enabled); any = true; }
+        if (!known || shadow.src != state.src || shadow.dst != state.dst) { glBlendFunc(toGL(state.src), toGL(state.dst)); ++g_stats.issued; any = true; }
+        if (!any) ++g_stats.filtered;
+        shadow = state;
+        g_shadow.blendKnown = true;
+    }
+
+    void setRaster(const RasterState& state) {
+        RasterState& shadow = g_shadow.raster;
+        bool known = g_shadow.rasterKnown;
+        bool any = false;
+        if (!known || (shadow.cull == CullMode::None) != (state.cull == CullMode::None)) {
+            setCapability(GL_CULL_FACE, state.cull != CullMode::None);
+            any = true;
+        }
+        if (state.cull != CullMode::None && (!known || shadow.cull != state.cull)) {
+            glCullFace(state.cull == CullMode::Back ? GL_BACK : GL_FRONT);
+            ++g_stats.issued;
+            any = true;
+        }
+        if (!known || shadow.frontFaceCCW != state.frontFaceCCW) { glFrontFace(state.frontFaceCCW ? GL_CCW : GL_CW); ++g_stats.issued; any = true; }
+        if (!known || shadow.scissor != state.scissor) { setCapability(GL_SCISSOR_TEST, state.scissor); any = true; }
+        if (!known || shadow.wireframe != state.wireframe) { glPolygonMode(GL_FRONT_AND_BACK, state.wireframe ? GL_LINE : GL_FILL); ++g_stats.issued; any = true; }
+        if (!any) ++g_stats.filtered;
+        shadow = state;
+        g_shadow.rasterKnown = true;
+    }
+
+    void setClearColor(float r, float g, float b, float a) {
+        float* shadow = g_shadow.clear;
+        if (g_shadow.clearKnown && shadow[0] == r && shadow[1] == g && shadow[2] == b && shadow[3] == a) {
+            ++g_stats.filtered;
+            return;
+        }
+        glClearColor(r, g, b, a);
+        ++g_stats.issued;
+        shadow[0] = r;
+        shadow[1] = g;
+        shadow[2] = b;
+        shadow[3] = a;
+        g_shadow.clearKnown = true;
+    }
+
+    // === OBJECTS (DSA) ===
+    unsigned createBuffer(std::size_t bytes, const void* data, unsigned flags) {
+        GLuint buffer = 0;
+        glCreateBuffers(1, &buffer);
+        glNamedBufferStorage(buffer, static_cast<GLsizeiptr>(bytes), data, flags);
+        return buffer;
+    }
+
+    void* createMappedBuffer(std::size_t bytes, unsigned& buffer) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        buffer = createBuffer(bytes, nullptr, flags);
+        void* mapped = glMapNamedBufferRange(buffer, 0, static_cast<GLsizeiptr>(bytes), flags);
+        if (!mapped) deleteBuffer(buffer);
+        return mapped;
+    }
+
+    unsigned createVertexArray() {
+        GLuint vao = 0;
+        glCreateVertexArrays(1, &vao);
+        return vao;
+    }
+
+    void deleteBuffer(unsigned& buffer) {
+        if (!buffer) return;
+        for (unsigned& bound : g_shadow.buffers)
+            if (bound == buffer) bound = kUnknown;
+        for (UniformBinding& bound : g_shadow.uniforms)
+            if (bound.buffer == buffer) bound.buffer = kUnknown;
+        glDeleteBuffers(1, &buffer);
+        buffer = 0;
+    }
+
+    void deleteVertexArray(unsigned& vao) {
+        if (!vao) return;
+        if (g_shadow.vao == vao) g_shadow.vao = kUnknown;
+        glDeleteVertexArrays(1, &vao);
+        vao = 0;
+    }
+
+    void deleteProgram(unsigned& program) {
+        if (!program) return;
+        if (g_shadow.program == program) g_shadow.program = kUnknown;
+        glDeleteProgram(program);
+        program = 0;
+    }
+
+    const Stats& stats() {
+        return g_stats;
+    }
+
+} // namespace engine::gldevice
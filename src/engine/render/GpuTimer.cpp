@@ -0,0 +1,156 @@
+// src/engine/render/GpuTimer.cpp
+#include "engine/render/GpuTimer.h"
+#include <glad/glad.h>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+
+namespace engine {
+
+    // === LIFETIME ===
+    bool GpuTimer::create() {
+        // Zero bits: the context accepts timestamp queries but has no counter behind them
+        GLint bits = 0;
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits);
+        if (bits == 0) {
+            std::cerr << "GpuTimer: no GL_TIMESTAMP counter, GPU timing disabled" << std::endl;
+            return false;
+        }
+        for (Slot& slot : m_slots) glGenQueries(static_cast<GLsizei>(std::size(slot.queries)), slot.queries);
+        m_enabled = true;
+        calibrate();
+        return true;
+    }
+
+    void GpuTimer::destroy() {
+        if (!m_enabled) return;
+        for (Slot& slot : m_slots) {
+            glDeleteQueries(static_cast<GLsizei>(std::size(slot.queries)), slot.queries);
+            slot = Slot();
+        }
+        m_enabled = false;
+    }
+
+    void GpuTimer::calibrate() {
+        // The GL time once every command so far has reached the GPU; no wait
+        // for them to execute, so this pairs with "now" on the CPU side
+        GLint64 gpu = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpu);
+        m_clockOffset = static_cast<std::int64_t>(profiler::now()) - gpu;
+    }
+
+    std::uint64_t GpuTimer::toProfilerClock(std::uint64_t gpuTime) const {
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(gpuTime) + m_clockOffset);
+    }
+
+    // === RECORDING ===
+    void GpuTimer::beginFrame() {
+        if (!m_enabled) return;
+
+        // Oldest first; stop at the first frame the GPU has not finished
+        while (m_slots[m_oldest].pending && resolve(m_slots[m_oldest])) m_oldest = (m_oldest + 1) % kFrames;
+
+        Slot& slot = m_slots[m_current];
+        if (slot.pending) {
+            // Every slot is in flight: give the oldest up instead of waiting for it
+            slot.pending = false;
+            m_oldest = (m_current + 1) % kFrames;
+            std::lock_guard<std::mutex> lock(m_lock);
+            ++m_stats.dropped;
+        }
+
+        if (m_frames++ % kCalibrateFrames == 0) calibrate();
+        slot.passes = 0;
+        m_openCount = 0;
+        glQueryCounter(slot.queries[0], GL_TIMESTAMP);
+    }
+
+    void GpuTimer::endFrame() {
+        if (!m_enabled) return;
+        while (m_openCount > 0) endPass();
+        Slot& slot = m_slots[m_current];
+        glQueryCounter(slot.queries[1], GL_TIMESTAMP);
+        slot.pending = true;
+        m_current = (m_current + 1) % kFrames;
+    }
+
+    void GpuTimer::beginPass(const char* name) {
+        if (!m_enabled) return;
+        Slot& slot = m_slots[m_current];
+        std::size_t pass = slot.passes < kMaxPasses ? slot.passes++ : kMaxPasses;   // kMaxPasses: untimed
+        if (pass < kMaxPasses) {
+            slot.names[pass] = name;
+            glQueryCounter(slot.queries[2 + 2 * pass], GL_TIMESTAMP);
+        }
+        if (m_openCount < kMaxPasses) m_open[m_openCount++] = pass;
+    }
+
+    void GpuTimer::endPass() {
+        if (!m_enabled || m_openCount == 0) return;
+        std::size_t pass = m_open[--m_openCount];
+        if (pass < kMaxPasses) glQueryCounter(m_slots[m_current].queries[3 + 2 * pass], GL_TIMESTAMP);
+    }
+
+    // === READBACK ===
+    bool GpuTimer::resolve(Slot& slot) {
+        std::size_t count = 2 + 2 * slot.passes;
+        for (std::size_t i = 0; i < count; ++i) {
+            GLint available = 0;
+            glGetQueryObjectiv(slot.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) return false;
+        }
+
+        GLuint64 times[2 + 2 * kMaxPasses];
+        for (std::size_t i = 0; i < count; ++i) glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &times[i]);
+        slot.pending = false;
+
+        Pass passes[kMaxPasses];
+        for (std::size_t p = 0; p < slot.passes; ++p)
+            passes[p] = { slot.names[p], toProfilerClock(times[2 + 2 * p]), toProfilerClock(times[3 + 2 * p]) };
+        std::uint64_t frameBegin = toProfilerClock(times[0]), frameEnd = toProfilerClock(times[1]);
+
+        profiler::recordGpu("GpuFrame", frameBegin, frameEnd);
+        for (std::size_t p = 0; p < slot.passes; ++p) profiler::recordGpu(passes[p].name, passes[p].begin, passes[p].end);
+
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_frameTimes.add((frameEnd - frameBegin) / 1e6);
+        for (std::size_t p = 0; p < slot.passes; ++p) {
+            // Found by name, so a pass keeps its history when the passes before it change
+            for (PassHistory& history : m_history) {
+                if (!history.name) history.name = passes[p].name;
+                else if (history.name != passes[p].name && std::strcmp(history.name, passes[p].name) != 0) continue;
+                history.times.add(passes[p].milliseconds());
+                break;
+            }
+            m_latest[p] = passes[p];
+        }
+        m_latestCount = slot.passes;
+        ++m_stats.resolved;
+        return true;
+    }
+
+    FrameTimeStats::Summary GpuTimer::frameSummary() const {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return m_frameTimes.summary();
+    }
+
+    FrameTimeStats::Summary GpuTimer::passSummary(const char* name) const {
+        std::lock_guard<std::mutex> lock(m_lock);
+        for (const PassHistory& history : m_history)
+            if (history.name && std::strcmp(history.name, name) == 0) return history.times.summary();
+        return FrameTimeStats::Summary();
+    }
+
+    std::size_t GpuTimer::latestPasses(Pass* out, std::size_t capacity) const {
+        std::lock_guard<std::mutex> lock(m_lock);
+        std::size_t count = m_latestCount < capacity ? m_latestCount : capacity;
+        for (std::size_t i = 0; i < count; ++i) out[i] = m_latest[i];
+        return count;
+    }
+
+    GpuTimer::Stats GpuTimer::stats() const {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return m_stats;
+    }
+
+} // namespace engine
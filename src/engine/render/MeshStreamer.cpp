@@ -0,0 +1,262 @@
+// src/engine/render/MeshStreamer.cpp
+#include "engine/render/MeshStreamer.h"
+#include "engine/render/BatchRenderer.h"
+#include "engine/render/GLDevice.h"
+#include "engine/core/AssetArchive.h"
+#include "engine/core/Platform.h"
+#include "engine/core/Profiler.h"
+#include <glad/glad.h>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+namespace engine {
+
+    static_assert(sizeof(BatchRenderer::Vertex) == meshfile::kVertexStride, "mesh files store BatchRenderer::Vertex as-is");
+
+    namespace {
+
+        std::size_t alignUp(std::size_t value, std::size_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+    } // namespace
+
+    MeshStreamer::~MeshStreamer() {
+        stop();
+    }
+
+    bool MeshStreamer::start(BatchRenderer& batch, AssetArchive* archive, std::size_t ringBytes) {
+        stop();
+        m_batch = &batch;
+        m_archive = archive && archive->isOpen() ? archive : nullptr;
+        m_ringBytes = alignUp(ringBytes, meshfile::kAlignment);
+
+        m_ringMapped = static_cast<unsigned char*>(gldevice::createMappedBuffer(m_ringBytes, m_ringBuffer));
+        if (!m_ringMapped) {
+            std::cerr << "MeshStreamer: failed to map a " << m_ringBytes << " byte staging ring" << std::endl;
+            return false;
+        }
+
+        m_head = 0;
+        m_tail.store(0);
+        m_quit = false;
+        m_loader = std::thread([this] { loaderMain(); });
+        return true;
+    }
+
+    void MeshStreamer::stop() {
+        if (m_loader.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                m_quit = true;
+            }
+            m_wake.notify_all();
+            m_loader.join();
+        }
+
+        // The GPU may still be copying out of the ring
+        for (Retiring& retiring : m_retiring) {
+            GLsync fence = static_cast<GLsync>(retiring.fence);
+            while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED) {}
+            glDeleteSync(fence);
+        }
+        m_retiring.clear();
+
+        if (m_ringBuffer) {
+            glUnmapNamedBuffer(m_ringBuffer);
+            gldevice::deleteBuffer(m_ringBuffer);
+        }
+        m_ringMapped = nullptr;
+        m_requests.clear();
+        m_staged.clear();
+        m_inFlight = 0;
+    }
+
+    std::uint32_t MeshStreamer::request(const std::string& path) {
+        std::uint32_t mesh = m_batch->reserveMesh();
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_requests.push_back({ path, mesh });
+        }
+        ++m_inFlight;
+        m_wake.notify_all();
+        return mesh;
+    }
+
+    const MeshStreamer::MeshInfo* MeshStreamer::info(std::uint32_t mesh) const {
+        auto it = m_info.find(mesh);
+        return it == m_info.end() ? nullptr : &it->second;
+    }
+
+    // === LOADER THREAD ===
+    void MeshStreamer::loaderMain() {
+        profiler::setThreadName("MeshLoader");
+        for (;;) {
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_wake.wait(lock, [this] { return m_quit || !m_requests.empty(); });
+                if (m_quit) return;
+                request = std::move(m_requests.front());
+                m_requests.pop_front();
+            }
+
+            if (!load(request)) {
+                std::lock_guard<std::mutex> lock(m_lock);
+                if (m_quit) return;
+                m_staged.push_back(Staged{ request.mesh, true, 0, 0, 0, 0, 0, {} });
+            }
+        }
+    }
+
+    bool MeshStreamer::load(const Request& request) {
+        ENGINE_PROFILE_SCOPE("MeshStreamer::load");
+
+        // Archive entries and loose files are both mapped - the only copy is into the ring
+        std::string_view data;
+        MappedFile file;
+        if (!(m_archive && m_archive->find(request.path, data))) {
+            if (!file.open(request.path)) {
+                std::cerr << "MeshStreamer: cannot open " << request.path << std::endl;
+                return false;
+            }
+            data = std::string_view(file.data(), file.size());
+        }
+
+        meshfile::Header header;
+        bool valid = data.size() >= sizeof(header);
+        if (valid) std::memcpy(&header, data.data(), sizeof(header));
+        std::uint64_t vertexBytes = valid ? std::uint64_t(header.vertexCount) * meshfile::kVertexStride : 0;
+        std::uint64_t indexBytes = valid ? std::uint64_t(header.indexCount) * sizeof(std::uint32_t) : 0;
+        valid = valid && header.magic == meshfile::kMagic && header.version == meshfile::kVersion
+            && header.vertexStride == meshfile::kVertexStride
+            && sizeof(header) + std::uint64_t(header.submeshCount) * sizeof(meshfile::Submesh) <= data.size()
+            && header.vertexOffset + vertexBytes <= data.size()
+            && header.indexOffset + indexBytes <= data.size();
+        if (!valid) {
+            std::cerr << "MeshStreamer: " << request.path << " is not a valid mesh file" << std::endl;
+            return false;
+        }
+
+        std::size_t indexStart = alignUp(static_cast<std::size_t>(vertexBytes), meshfile::kAlignment);
+        std::size_t bytes = indexStart + static_cast<std::size_t>(indexBytes);
+        if (bytes > m_ringBytes) {
+            std::cerr << "MeshStreamer: " << request.path << " (" << bytes << " bytes) is larger than the staging ring" << std::endl;
+            return false;
+        }
+
+        std::uint64_t position;
+        if (!allocate(bytes, position)) return false;
+        std::size_t offset = static_cast<std::size_t>(position % m_ringBytes);
+        unsigned char* target = m_ringMapped + offset;
+
+        std::memcpy(target, data.data() + header.vertexOffset, static_cast<std::size_t>(vertexBytes));
+        // Indices are checked while they are copied; a bad one would read past the mesh on the GPU
+        const unsigned char* indexSource = reinterpret_cast<const unsigned char*>(data.data() + header.indexOffset);
+        std::uint32_t* indexTarget = reinterpret_cast<std::uint32_t*>(target + indexStart);
+        std::uint32_t maxIndex = 0;
+        for (std::uint32_t i = 0; i < header.indexCount; ++i) {
+            std::uint32_t index;
+            std::memcpy(&index, indexSource + i * sizeof(index), sizeof(index));
+            indexTarget[i] = index;
+            maxIndex = index > maxIndex ? index : maxIndex;
+        }
+
+        Staged staged{};
+        staged.mesh = request.mesh;
+        staged.failed = header.indexCount > 0 && maxIndex >= header.vertexCount;
+        staged.ringEnd = position + bytes;
+        staged.vertexOffset = offset;
+        staged.vertexCount = header.vertexCount;
+        staged.indexOffset = offset + indexStart;
+        staged.indexCount = header.indexCount;
+        staged.info.bounds = header.bounds;
+        const unsigned char* submeshes = reinterpret_cast<const unsigned char*>(data.data() + sizeof(header));
+        staged.info.submeshes.resize(header.submeshCount);
+        if (header.submeshCount) std::memcpy(staged.info.submeshes.data(), submeshes, header.submeshCount * sizeof(meshfile::Submesh));
+        if (staged.failed) std::cerr << "MeshStreamer: " << request.path << " has out-of-range indices" << std::endl;
+
+        // Even a rejected load owns ring space until pump() passes it
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_staged.push_back(std::move(staged));
+        return true;
+    }
+
+    bool MeshStreamer::allocate(std::size_t bytes, std::uint64_t& position) {
+        // Contiguous only: skip the tail end of the ring when the load would straddle the wrap
+        std::uint64_t start = (m_head + meshfile::kAlignment - 1) & ~std::uint64_t(meshfile::kAlignment - 1);
+        std::size_t offset = static_cast<std::size_t>(start % m_ringBytes);
+        if (offset + bytes > m_ringBytes) start += m_ringBytes - offset;
+        std::uint64_t end = start + bytes;
+
+        // An empty ring (tail caught up with head) always fits, skipped space included
+        auto fits = [&] { return end - m_tail.load() <= m_ringBytes || m_tail.load() == m_head; };
+        std::unique_lock<std::mutex> lock(m_lock);
+        if (!fits()) {
+            m_ringFullWaits.fetch_add(1, std::memory_order_relaxed);
+            m_wake.wait(lock, [&] { return m_quit || fits(); });
+        }
+        if (m_quit) return false;
+        m_head = end;
+        position = start;
+        return true;
+    }
+
+    // === GL THREAD ===
+    void MeshStreamer::retireFences() {
+        std::uint64_t tail = m_tail.load();
+        while (!m_retiring.empty()) {
+            GLsync fence = static_cast<GLsync>(m_retiring.front().fence);
+            GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            if (result == GL_TIMEOUT_EXPIRED) break;
+            glDeleteSync(fence);
+            tail = m_retiring.front().ringEnd;
+            m_retiring.pop_front();
+        }
+        if (tail == m_tail.load()) return;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_tail.store(tail);
+        }
+        m_wake.notify_all();
+    }
+
+    void MeshStreamer::pump(std::size_t byteBudget) {
+        ENGINE_PROFILE_SCOPE("MeshStreamer::pump");
+        if (!m_ringBuffer) return;
+        retireFences();
+        m_stats.ringFullWaits = m_ringFullWaits.load(std::memory_order_relaxed);
+
+        std::uint64_t ringEnd = 0;
+        std::size_t uploaded = 0;
+        for (;;) {
+            Staged staged;
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+                if (m_staged.empty()) break;
+                const Staged& next = m_staged.front();
+                std::size_t bytes = next.vertexCount * meshfile::kVertexStride + next.indexCount * sizeof(std::uint32_t);
+                if (uploaded && uploaded + bytes > byteBudget) break;
+                staged = std::move(m_staged.front());
+                m_staged.pop_front();
+            }
+            --m_inFlight;
+            if (staged.ringEnd) ringEnd = staged.ringEnd;
+
+            if (staged.failed || !m_batch->setMeshFromBuffer(staged.mesh, m_ringBuffer, staged.vertexOffset, staged.vertexCount, staged.indexOffset, staged.indexCount)) {
+                ++m_stats.failed;
+                continue;
+            }
+            std::size_t bytes = staged.vertexCount * meshfile::kVertexStride + staged.indexCount * sizeof(std::uint32_t);
+            uploaded += bytes;
+            m_stats.bytesUploaded += bytes;
+            ++m_stats.loaded;
+            m_info[staged.mesh] = std::move(staged.info);
+        }
+
+        // One fence covers every copy issued above; once it signals their ring space is free
+        if (ringEnd) m_retiring.push_back({ glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), ringEnd });
+    }
+
+} // namespace engine
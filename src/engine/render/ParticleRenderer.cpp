@@ -0,0 +1,110 @@
+// src/engine/render/ParticleRenderer.cpp
+#include "engine/render/ParticleRenderer.h"
+#include "engine/render/GLDevice.h"
+#include "engine/render/Shader.h"
+#include "engine/core/Profiler.h"
+#include <glad/glad.h>
+#include <iostream>
+
+namespace engine {
+
+    namespace {
+
+        constexpr GLuint kInstanceBinding = 0;
+        constexpr GLuint kInstanceLocation = 0;   // vec4: position, life fraction
+
+    } // namespace
+
+    ParticleRenderer::~ParticleRenderer() {
+        shutdown();
+    }
+
+    bool ParticleRenderer::initialize(std::size_t capacity) {
+        shutdown();
+        std::size_t bytes = capacity * sizeof(ParticleInstance) * kSections;
+        m_mapped = static_cast<ParticleInstance*>(gldevice::createMappedBuffer(bytes, m_buffer));
+        if (!m_mapped) {
+            std::cerr << "ParticleRenderer: failed to map " << bytes << " bytes" << std::endl;
+            return false;
+        }
+        m_capacity = capacity;
+
+        // Every section shares one binding at offset 0; baseInstance picks
+        // the section and chunk, so a draw never touches the VAO
+        m_vao = gldevice::createVertexArray();
+        glEnableVertexArrayAttrib(m_vao, kInstanceLocation);
+        glVertexArrayAttribFormat(m_vao, kInstanceLocation, 4, GL_FLOAT, GL_FALSE, 0);
+        glVertexArrayAttribBinding(m_vao, kInstanceLocation, kInstanceBinding);
+        glVertexArrayBindingDivisor(m_vao, kInstanceBinding, 1);
+        glVertexArrayVertexBuffer(m_vao, kInstanceBinding, m_buffer, 0, sizeof(ParticleInstance));
+
+        for (std::atomic<bool>& free : m_free) free.store(true, std::memory_order_relaxed);
+        m_stats = Stats();
+        return true;
+    }
+
+    void ParticleRenderer::shutdown() {
+        if (!m_buffer) return;
+        for (void*& fence : m_fences) {
+            if (!fence) continue;
+            glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+        glUnmapNamedBuffer(m_buffer);
+        gldevice::deleteBuffer(m_buffer);
+        gldevice::deleteVertexArray(m_vao);
+        m_mapped = nullptr;
+        m_capacity = 0;
+    }
+
+    // === WRITER ===
+    int ParticleRenderer::acquire() {
+        for (int section = 0; section < kSections; ++section) {
+            bool expected = true;
+            // Acquire: the GL thread's release in reclaim() orders the GPU's
+            // finished reads before our writes
+            if (m_free[section].compare_exchange_strong(expected, false, std::memory_order_acquire)) return section;
+        }
+        ++m_stats.starved;
+        return -1;
+    }
+
+    // === GL THREAD ===
+    void ParticleRenderer::reclaim() {
+        for (int section = 0; section < kSections; ++section) {
+            GLsync fence = static_cast<GLsync>(m_fences[section]);
+            if (!fence) continue;
+            GLenum result = glClientWaitSync(fence, 0, 0);   // poll only
+            if (result == GL_TIMEOUT_EXPIRED) continue;
+            if (result == GL_WAIT_FAILED) std::cerr << "ParticleRenderer: glClientWaitSync failed" << std::endl;
+            glDeleteSync(fence);
+            m_fences[section] = nullptr;
+            release(section);
+        }
+    }
+
+    void ParticleRenderer::draw(Shader& shader, int section, const std::uint32_t* counts, std::size_t chunkCount) {
+        ENGINE_PROFILE_SCOPE("ParticleRenderer::draw");
+        m_stats.instances = 0;
+        m_stats.drawCalls = 0;
+
+        shader.bind();
+        gldevice::bindVertexArray(m_vao);
+        GLuint sectionBase = static_cast<GLuint>(static_cast<std::size_t>(section) * m_capacity);
+        for (std::size_t c = 0; c < chunkCount; ++c) {
+            if (!counts[c]) continue;
+            // Four strip vertices from gl_VertexID, one quad per instance
+            glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(counts[c]),
+                                              sectionBase + static_cast<GLuint>(c * ParticleSystem::kChunkSize));
+            m_stats.instances += counts[c];
+            ++m_stats.drawCalls;
+        }
+        m_fences[section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    void ParticleRenderer::release(int section) {
+        m_free[section].store(true, std::memory_order_release);
+    }
+
+} // namespace engine
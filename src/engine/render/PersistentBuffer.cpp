@@ -0,0 +1,62 @@
+// src/engine/render/PersistentBuffer.cpp
+#include "engine/render/PersistentBuffer.h"
+#include "engine/render/GLDevice.h"
+#include <glad/glad.h>
+#include <iostream>
+
+namespace engine {
+
+    PersistentBuffer::~PersistentBuffer() {
+        destroy();
+    }
+
+    bool PersistentBuffer::create(std::size_t sectionBytes, std::size_t alignment) {
+        destroy();
+        if (alignment == 0) alignment = 1;
+        m_sectionBytes = (sectionBytes + alignment - 1) / alignment * alignment;
+
+        m_mapped = static_cast<unsigned char*>(gldevice::createMappedBuffer(m_sectionBytes * kSections, m_buffer));
+        if (!m_mapped) {
+            std::cerr << "PersistentBuffer: failed to map " << m_sectionBytes * kSections << " bytes" << std::endl;
+            return false;
+        }
+        m_current = kSections - 1;
+        return true;
+    }
+
+    void PersistentBuffer::destroy() {
+        if (!m_buffer) return;
+        for (unsigned i = 0; i < kSections; ++i) waitFence(i);
+        glUnmapNamedBuffer(m_buffer);
+        gldevice::deleteBuffer(m_buffer);
+        m_mapped = nullptr;
+    }
+
+    void PersistentBuffer::waitFence(unsigned section) {
+        GLsync fence = static_cast<GLsync>(m_fences[section]);
+        if (!fence) return;
+
+        GLenum result = glClientWaitSync(fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED) {
+            ++m_stalls;
+            do {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);   // 1 ms
+            } while (result == GL_TIMEOUT_EXPIRED);
+        }
+        if (result == GL_WAIT_FAILED) std::cerr << "PersistentBuffer: glClientWaitSync failed" << std::endl;
+
+        glDeleteSync(fence);
+        m_fences[section] = nullptr;
+    }
+
+    void* PersistentBuffer::beginSection() {
+        m_current = (m_current + 1) % kSections;
+        waitFence(m_current);
+        return m_mapped + m_current * m_sectionBytes;
+    }
+
+    void PersistentBuffer::endSection() {
+        m_fences[m_current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+} // namespace engine
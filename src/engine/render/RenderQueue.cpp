@@ -0,0 +1,87 @@
+// src/engine/render/RenderQueue.cpp
+#include "engine/render/RenderQueue.h"
+#include "engine/render/BatchRenderer.h"
+#include "engine/render/Shader.h"
+#include "engine/core/Profiler.h"
+
+namespace engine {
+
+    // === SORT ===
+    void RenderQueue::sort() {
+        ENGINE_PROFILE_SCOPE("RenderQueue::sort");
+        std::size_t count = m_packets.size();
+        m_stats = Stats();
+        m_stats.packets = count;
+        m_batches.clear();
+        if (count == 0) return;
+
+        // LSD radix over 8-bit digits. One read builds every digit's histogram;
+        // a digit where all keys agree (unused shader/material bits, a single
+        // mesh) would be a pure copy and is skipped.
+        constexpr unsigned kDigits = 8;
+        std::size_t histogram[kDigits][256] = {};
+        for (const DrawPacket& packet : m_packets) {
+            for (unsigned d = 0; d < kDigits; ++d) ++histogram[d][(packet.key >> (d * 8)) & 0xFF];
+        }
+
+        m_scratch.resize(count);
+        DrawPacket* from = m_packets.data();
+        DrawPacket* to = m_scratch.data();
+        for (unsigned d = 0; d < kDigits; ++d) {
+            std::size_t* buckets = histogram[d];
+            if (buckets[(from[0].key >> (d * 8)) & 0xFF] == count) continue;
+
+            std::size_t offset = 0;
+            for (unsigned b = 0; b < 256; ++b) {
+                std::size_t n = buckets[b];
+                buckets[b] = offset;
+                offset += n;
+            }
+            for (std::size_t i = 0; i < count; ++i) to[buckets[(from[i].key >> (d * 8)) & 0xFF]++] = from[i];
+            std::swap(from, to);
+            ++m_stats.sortPasses;
+        }
+        if (from != m_packets.data()) m_packets.swap(m_scratch);
+
+        // Batches: runs of equal pass + shader + material
+        for (std::size_t i = 0; i < count; ++i) {
+            std::uint64_t key = m_packets[i].key;
+            if (!m_batches.empty()) {
+                const DrawBatch& last = m_batches.back();
+                std::uint64_t previous = m_packets[last.first].key;
+                if (sortkey::pass(key) == last.pass && sortkey::shader(key) == sortkey::shader(previous)
+                    && sortkey::material(key) == sortkey::material(previous)) {
+                    ++m_batches.back().count;
+                    continue;
+                }
+            }
+            m_batches.push_back({ static_cast<std::uint32_t>(i), 1, sortkey::pass(key), sortkey::shader(key), sortkey::material(key) });
+        }
+        m_stats.batches = m_batches.size();
+    }
+
+    // === EXECUTE ===
+    void RenderQueue::execute(BatchRenderer& batch, const math::Mat4* mvps, Shader* const* shaders, std::size_t shaderCount) {
+        ENGINE_PROFILE_SCOPE("RenderQueue::execute");
+        if (!batch.beginPackets(mvps, m_packets.data(), m_packets.size(), m_batches.data(), m_batches.size())) return;
+
+        std::uint32_t boundShader = ~0u, material = ~0u;
+        for (std::size_t b = 0; b < m_batches.size(); ++b) {
+            const DrawBatch& draw = m_batches[b];
+            if (draw.shader >= shaderCount || !shaders[draw.shader]) continue;
+            if (draw.shader != boundShader) {
+                shaders[draw.shader]->bind();
+                boundShader = draw.shader;
+                ++m_stats.shaderBinds;
+            }
+            // No material state exists yet; the id only groups draws
+            if (draw.material != material) {
+                material = draw.material;
+                ++m_stats.materialChanges;
+            }
+            batch.drawBatch(b);
+        }
+        batch.endPackets();
+    }
+
+} // namespace engine
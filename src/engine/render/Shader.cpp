@@ -1,44 +1,50 @@
 #include "engine/render/Shader.h"
+#include "engine/render/GLDevice.h"
+#include "engine/render/ShaderCache.h"
+#include "engine/render/UniformBuffer.h"
+#include "engine/core/Profiler.h"
 #include <glad/glad.h>
+#include <chrono>
 #include <fstream>
-#include <sstream>
 #include <iostream>
-#include <sys/stat.h>
 
 namespace engine {
 
+    namespace {
+
+        constexpr GLenum kCompletionStatus = 0x91B1;   // GL_COMPLETION_STATUS_KHR
+
+        std::string injectDefines(std::string_view source, const std::string& defines) {
+            // #version must stay the first line
+            std::size_t versionEnd = source.rfind("#version", 0) == 0 ? source.find('\n') : std::string_view::npos;
+            std::string result;
+            result.reserve(source.size() + defines.size() + 2);
+            if (versionEnd == std::string_view::npos) return result.append(defines).append("\n").append(source);
+            return result.append(source.substr(0, versionEnd + 1)).append(defines).append("\n").append(source.substr(versionEnd + 1));
+        }
+
+    } // namespace
+
     std::string Shader::readFile(const std::string& path) {
-        std::ifstream file(path);
+        // Loose-file path (development / hot reload); packed builds use loadFromSource
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
         if (!file.is_open()) {
             std::cerr << "Failed to open shader: " << path << std::endl;
             return "";
         }
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        return buffer.str();
+        std::string contents(static_cast<std::size_t>(file.tellg()), '\0');
+        file.seekg(0);
+        file.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+        return contents;
     }
 
-    long Shader::getFileTime(const std::string& path) {
-        struct stat result;
-        if (stat(path.c_str(), &result) == 0) {
-            return result.st_mtime;
-        }
-        return 0;
-    }
-
-    unsigned int Shader::compileShader(unsigned int type, const std::string& source) {
+    unsigned int Shader::compileShader(unsigned int type, std::string_view source) {
+        // No status query here - that would wait for the compile; finishBuild() checks it
         unsigned int id = glCreateShader(type);
-        const char* src = source.c_str();
-        glShaderSource(id, 1, &src, nullptr);
+        const char* src = source.data();
+        GLint length = static_cast<GLint>(source.size());
+        glShaderSource(id, 1, &src, &length);
         glCompileShader(id);
-
-        int success;
-        glGetShaderiv(id, GL_COMPILE_STATUS, &success);
-        if (!success) {
-            char infoLog[512];
-            glGetShaderInfoLog(id, 512, nullptr, infoLog);
-            std::cerr << "Shader compilation failed:\n" << infoLog << std::endl;
-        }
         return id;
     }
 
@@ -64,78 +70,196 @@ namespace engine {
         return true;
     }
 
-    bool Shader::loadFromFile(const std::string& vertexPath, const std::string& fragmentPath) {
+    void Shader::startBuild(std::string_view vertexCode, std::string_view fragmentCode, PendingBuild& build) {
+        // Without defines the sources go to the driver as-is, straight from the caller's memory
+        std::string vertexWithDefines, fragmentWithDefines;
+        if (!m_defines.empty()) {
+            vertexWithDefines = injectDefines(vertexCode, m_defines);
+            fragmentWithDefines = injectDefines(fragmentCode, m_defines);
+            vertexCode = vertexWithDefines;
+            fragmentCode = fragmentWithDefines;
+        }
+
+        build = PendingBuild();
+        build.program = glCreateProgram();
+        if (s_cache) {
+            build.key = s_cache->key(vertexCode, fragmentCode, m_defines);
+            if (s_cache->load(build.key, build.program)) return;
+        }
+
+        build.start = std::chrono::steady_clock::now();
+        build.vertex = compileShader(GL_VERTEX_SHADER, vertexCode);
+        build.fragment = compileShader(GL_FRAGMENT_SHADER, fragmentCode);
+
+        glAttachShader(build.program, build.vertex);
+        glAttachShader(build.program, build.fragment);
+        if (s_cache) glProgramParameteri(build.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(build.program);
+    }
+
+    bool Shader::buildReady(const PendingBuild& build) const {
+        if (!s_parallelCompile || !build.vertex) return true;
+        int done = GL_FALSE;
+        glGetProgramiv(build.program, kCompletionStatus, &done);
+        return done == GL_TRUE;
+    }
+
+    unsigned int Shader::finishBuild(PendingBuild& build) {
+        PendingBuild done = build;
+        build = PendingBuild();
+        unsigned int program = done.program;
+        bool fromSource = done.vertex != 0;
+        bool ok = true;
+        if (fromSource) {
+            // Check both stages so an edit that breaks each one reports both logs
+            ok = checkCompileErrors(done.vertex, "VERTEX");
+            ok = checkCompileErrors(done.fragment, "FRAGMENT") && ok;
+        }
+        ok = ok && checkCompileErrors(program, "PROGRAM");
+
+        if (fromSource) {
+            glDeleteShader(done.vertex);
+            glDeleteShader(done.fragment);
+        }
+        if (!ok) {
+            gldevice::deleteProgram(program);
+            return 0;
+        }
+
+        if (fromSource && s_cache) {
+            // With parallel compile this includes frames spent waiting; still an upper bound worth recording
+            s_cache->store(done.key, program, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - done.start).count());
+        }
+        return program;
+    }
+
+    void Shader::discardBuild(PendingBuild& build) {
+        if (!build.program) return;
+        if (build.vertex) glDeleteShader(build.vertex);
+        if (build.fragment) glDeleteShader(build.fragment);
+        gldevice::deleteProgram(build.program);
+        build = PendingBuild();
+    }
+
+    void Shader::adoptProgram(unsigned int program) {
+        // Swap only after a successful link; the old program served every frame until now
+        gldevice::deleteProgram(m_program);
+        m_program = program;
+
+        // Shared per-frame block: one buffer bound once serves every program
+        unsigned int frameBlock = glGetUniformBlockIndex(m_program, kFrameUniformBlockName);
+        if (frameBlock != GL_INVALID_INDEX) glUniformBlockBinding(m_program, frameBlock, kFrameUniformBinding);
+        resolveUniforms();
+    }
+
+    bool Shader::loadFromFile(const std::string& vertexPath, const std::string& fragmentPath, const std::string& defines) {
         m_vertexPath = vertexPath;
         m_fragmentPath = fragmentPath;
+        m_defines = defines;
 
         std::string vertexCode = readFile(vertexPath);
         std::string fragmentCode = readFile(fragmentPath);
         if (vertexCode.empty() || fragmentCode.empty()) return false;
+        return buildNow(vertexCode, fragmentCode);
+    }
 
-        unsigned int vertex = compileShader(GL_VERTEX_SHADER, vertexCode);
-        unsigned int fragment = compileShader(GL_FRAGMENT_SHADER, fragmentCode);
+    bool Shader::loadFromSource(std::string_view vertexSource, std::string_view fragmentSource, const std::string& defines) {
+        m_vertexPath.clear();
+        m_fragmentPath.clear();
+        m_defines = defines;
+        return buildNow(vertexSource, fragmentSource);
+    }
 
-        m_program = glCreateProgram();
-        glAttachShader(m_program, vertex);
-        glAttachShader(m_program, fragment);
-        glLinkProgram(m_program);
+    bool Shader::buildNow(std::string_view vertexCode, std::string_view fragmentCode) {
+        discardBuild(m_pending);
 
-        glDeleteShader(vertex);
-        glDeleteShader(fragment);
+        // Synchronous: start and immediately finish (the status queries wait for the driver)
+        PendingBuild build;
+        startBuild(vertexCode, fragmentCode, build);
+        unsigned int program = finishBuild(build);
+        if (!program) return false;
+        adoptProgram(program);
+        return true;
+    }
 
-        if (!checkCompileErrors(m_program, "PROGRAM")) {
-            return false;
-        }
+    void Shader::beginReload() {
+        // A save during an in-flight build supersedes it
+        discardBuild(m_pending);
+        if (m_vertexPath.empty()) return;   // loaded from memory, nothing to re-read
+
+        std::string vertexCode = readFile(m_vertexPath);
+        std::string fragmentCode = readFile(m_fragmentPath);
+        // Editors can report a save before the new contents land; the next event retries
+        if (vertexCode.empty() || fragmentCode.empty()) return;
+
+        std::cout << "Hot-reloading shader..." << std::endl;
+        startBuild(vertexCode, fragmentCode, m_pending);
+    }
 
-        m_vertexTime = getFileTime(vertexPath);
-        m_fragmentTime = getFileTime(fragmentPath);
+    bool Shader::pollReload() {
+        ENGINE_PROFILE_SCOPE("Shader::pollReload");
+        if (!m_pending.program || !buildReady(m_pending)) return false;
 
+        unsigned int program = finishBuild(m_pending);
+        if (!program) {
+            std::cerr << "Shader reload failed; keeping the previous program" << std::endl;
+            return false;
+        }
+        adoptProgram(program);
         return true;
     }
 
     Shader::~Shader() {
-        if (m_program) glDeleteProgram(m_program);
+        discardBuild(m_pending);
+        gldevice::deleteProgram(m_program);
     }
 
     void Shader::bind() const {
-        glUseProgram(m_program);
+        gldevice::useProgram(m_program);
     }
 
     void Shader::unbind() const {
-        glUseProgram(0);
+        gldevice::useProgram(0);
     }
 
-    int Shader::getUniformLocation(const std::string& name) {
-        if (m_uniformLocationCache.find(name) != m_uniformLocationCache.end()) {
-            return m_uniformLocationCache[name];
+    UniformHandle Shader::uniform(std::string_view name) {
+        for (std::size_t i = 0; i < m_uniforms.size(); ++i) {
+            if (m_uniforms[i].name == name) return UniformHandle{ static_cast<int>(i) };
         }
-        int location = glGetUniformLocation(m_program, name.c_str());
-        if (location == -1) {
+
+        int index = static_cast<int>(m_uniforms.size());
+        m_uniforms.push_back({ std::pmr::string(name, m_uniforms.get_allocator()), -1 });
+        UniformSlot& slot = m_uniforms.back();
+        slot.location = glGetUniformLocation(m_program, slot.name.c_str());
+        if (slot.location == -1) {
             std::cerr << "Warning: uniform '" << name << "' doesn't exist!" << std::endl;
         }
-        m_uniformLocationCache[name] = location;
-        return location;
+        return UniformHandle{ index };
     }
 
-    void Shader::setMat4(const std::string& name, const float* value) {
-        glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, value);
+    int Shader::getUniformLocation(std::string_view name) {
+        return m_uniforms[uniform(name).index].location;
     }
 
-    void Shader::setFloat(const std::string& name, float value) {
-        glUniform1f(getUniformLocation(name), value);
+    void Shader::resolveUniforms() {
+        // Relinking can move every location; handles keep pointing at the same slot
+        for (UniformSlot& slot : m_uniforms) slot.location = glGetUniformLocation(m_program, slot.name.c_str());
     }
 
-    bool Shader::needsReload() {
-        return getFileTime(m_vertexPath) > m_vertexTime || getFileTime(m_fragmentPath) > m_fragmentTime;
+    void Shader::setMat4(UniformHandle handle, const float* value) {
+        if (handle.valid()) glProgramUniformMatrix4fv(m_program, m_uniforms[handle.index].location, 1, GL_FALSE, value);
     }
 
-    void Shader::reloadIfNeeded() {
-        if (needsReload()) {
-            std::cout << "Hot-reloading shader..." << std::endl;
-            unsigned int old = m_program;
-            loadFromFile(m_vertexPath, m_fragmentPath);
-            if (old) glDeleteProgram(old);
-        }
+    void Shader::setFloat(UniformHandle handle, float value) {
+        if (handle.valid()) glProgramUniform1f(m_program, m_uniforms[handle.index].location, value);
+    }
+
+    void Shader::setMat4(std::string_view name, const float* value) {
+        glProgramUniformMatrix4fv(m_program, getUniformLocation(name), 1, GL_FALSE, value);
+    }
+
+    void Shader::setFloat(std::string_view name, float value) {
+        glProgramUniform1f(m_program, getUniformLocation(name), value);
     }
 
 }  // namespace engine
\ No newline at end of file
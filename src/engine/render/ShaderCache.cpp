@@ -0,0 +1,167 @@
+// src/engine/render/ShaderCache.cpp
+#include "engine/render/ShaderCache.h"
+#include <glad/glad.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace engine {
+
+    namespace {
+
+        constexpr std::uint32_t kMagic = 0x48435350;   // "PSCH"
+        constexpr std::uint32_t kVersion = 1;
+
+        struct FileHeader {
+            std::uint32_t magic;
+            std::uint32_t version;
+            std::uint64_t key;          // guards against hash-named file collisions
+            std::uint32_t format;       // GLenum binary format
+            std::uint32_t length;
+            double compileMs;           // what a cache miss cost when this entry was made
+        };
+
+        // FNV-1a, 64 bit; fields are separated so "ab"+"c" != "a"+"bc"
+        void hashAppend(std::uint64_t& hash, std::string_view text) {
+            for (unsigned char c : text) {
+                hash ^= c;
+                hash *= 0x100000001B3ull;
+            }
+            hash ^= 0xFF;
+            hash *= 0x100000001B3ull;
+        }
+
+        const char* glString(GLenum name) {
+            const GLubyte* value = glGetString(name);
+            return value ? reinterpret_cast<const char*>(value) : "";
+        }
+
+    } // namespace
+
+    ShaderCache::ShaderCache(std::string directory) : m_directory(std::move(directory)) {}
+
+    bool ShaderCache::enabled() {
+        if (m_enabled < 0) {
+            GLint formats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            m_enabled = formats > 0 ? 1 : 0;
+            m_driver = std::string(glString(GL_VENDOR)) + "|" + glString(GL_RENDERER) + "|" + glString(GL_VERSION);
+            if (m_enabled) {
+                std::error_code error;
+                std::filesystem::create_directories(m_directory, error);
+            }
+            else {
+                std::cout << "Shader cache disabled: driver reports no program binary formats\n";
+            }
+        }
+        return m_enabled == 1;
+    }
+
+    std::uint64_t ShaderCache::key(std::string_view vertexSource, std::string_view fragmentSource, std::string_view defines) {
+        enabled();
+        std::uint64_t hash = 0xCBF29CE484222325ull;
+        hashAppend(hash, m_driver);
+        hashAppend(hash, defines);
+        hashAppend(hash, vertexSource);
+        hashAppend(hash, fragmentSource);
+        return hash;
+    }
+
+    std::string ShaderCache::pathFor(std::uint64_t key) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+        return (std::filesystem::path(m_directory) / name).string();
+    }
+
+    bool ShaderCache::load(std::uint64_t key, unsigned int program) {
+        if (!enabled()) {
+            ++m_stats.misses;
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::string path = pathFor(key);
+        std::ifstream file(path, std::ios::binary);
+        FileHeader header{};
+        if (!file.is_open() || !file.read(reinterpret_cast<char*>(&header), sizeof(header))
+            || header.magic != kMagic || header.version != kVersion || header.key != key) {
+            ++m_stats.misses;
+            return false;
+        }
+
+        // A corrupt length must not size the buffer: it can't exceed what the file holds
+        std::error_code sizeError;
+        std::uintmax_t fileSize = std::filesystem::file_size(path, sizeError);
+        if (sizeError || header.length > fileSize - sizeof(header)) {
+            ++m_stats.misses;
+            return false;
+        }
+
+        std::vector<char> binary(header.length);
+        if (!file.read(binary.data(), header.length)) {
+            ++m_stats.misses;
+            return false;
+        }
+        file.close();
+
+        glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(header.length));
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (!linked) {
+            // Driver changed its mind (e.g. same version string, new build) - drop the entry
+            ++m_stats.rejected;
+            ++m_stats.misses;
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            return false;
+        }
+
+        double loadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        ++m_stats.hits;
+        m_stats.loadMs += loadMs;
+        m_stats.savedMs += header.compileMs - loadMs;
+        return true;
+    }
+
+    void ShaderCache::store(std::uint64_t key, unsigned int program, double compileMs) {
+        if (!enabled()) return;
+
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0) return;
+
+        std::vector<char> binary(static_cast<std::size_t>(length));
+        GLenum format = 0;
+        glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+        FileHeader header{ kMagic, kVersion, key, format, static_cast<std::uint32_t>(length), compileMs };
+        // Write-then-rename so a crash mid-write never leaves a truncated entry
+        std::string path = pathFor(key);
+        std::string temp = path + ".tmp";
+        std::error_code error;
+        {
+            std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) return;
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(binary.data(), length);
+            file.flush();
+            if (!file.good()) {
+                // Disk full or similar - never publish a short entry
+                file.close();
+                std::filesystem::remove(temp, error);
+                return;
+            }
+        }
+        std::filesystem::rename(temp, path, error);
+    }
+
+    void ShaderCache::printStats() const {
+        std::printf("Shader cache: %u hits, %u misses (%u rejected), %.1f ms loading, ~%.1f ms compile time saved\n",
+            m_stats.hits, m_stats.misses, m_stats.rejected, m_stats.loadMs, m_stats.savedMs);
+    }
+
+} // namespace engine
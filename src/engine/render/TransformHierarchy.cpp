@@ -0,0 +1,151 @@
+// src/engine/render/TransformHierarchy.cpp
+#include "engine/render/TransformHierarchy.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Profiler.h"
+#include <algorithm>
+
+namespace engine {
+
+    namespace {
+
+        bool same(const math::Vec3& a, const math::Vec3& b) {
+            return a.x == b.x && a.y == b.y && a.z == b.z;
+        }
+
+        bool same(const math::Quat& a, const math::Quat& b) {
+            return a.x == b.x && a.y == b.y && a.z == b.z && a.w == b.w;
+        }
+
+    } // namespace
+
+    // === STRUCTURE ===
+    TransformHierarchy::Node TransformHierarchy::create(Node parent, const math::Vec3& position, const math::Quat& rotation, const math::Vec3& scale) {
+        Node node;
+        if (!m_freeNodes.empty()) {
+            node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else {
+            node = static_cast<Node>(m_indexOf.size());
+            m_indexOf.push_back(0);
+        }
+
+        // Roots go at the end; children right after the parent's current subtree
+        std::uint32_t parentIndex = kNoNode;
+        std::size_t at = size();
+        if (parent != kNoNode) {
+            parentIndex = m_indexOf[parent];
+            at = parentIndex + m_subtreeSize[parentIndex];
+            for (std::uint32_t a = parentIndex; a != kNoNode; a = m_parent[a]) ++m_subtreeSize[a];
+            for (std::size_t i = at; i < size(); ++i)
+                if (m_parent[i] != kNoNode && m_parent[i] >= at) ++m_parent[i];
+        }
+
+        m_parent.insert(m_parent.begin() + at, parentIndex);
+        m_subtreeSize.insert(m_subtreeSize.begin() + at, 1u);
+        m_position.insert(m_position.begin() + at, position);
+        m_rotation.insert(m_rotation.begin() + at, rotation);
+        m_scale.insert(m_scale.begin() + at, scale);
+        m_world.insert(m_world.begin() + at, math::Mat4());
+        m_dirty.insert(m_dirty.begin() + at, std::uint8_t(1));
+        m_rebuilt.insert(m_rebuilt.begin() + at, std::uint8_t(0));
+        m_nodeAt.insert(m_nodeAt.begin() + at, node);
+        renumber(at);
+        m_anyDirty.store(true, std::memory_order_relaxed);
+        return node;
+    }
+
+    void TransformHierarchy::destroy(Node node) {
+        std::size_t first = m_indexOf[node];
+        std::size_t count = m_subtreeSize[first];
+        std::size_t end = first + count;
+        for (std::uint32_t a = m_parent[first]; a != kNoNode; a = m_parent[a]) m_subtreeSize[a] -= static_cast<std::uint32_t>(count);
+        for (std::size_t i = first; i < end; ++i) m_freeNodes.push_back(m_nodeAt[i]);
+
+        auto eraseRange = [first, end](auto& v) { v.erase(v.begin() + first, v.begin() + end); };
+        eraseRange(m_parent);
+        eraseRange(m_subtreeSize);
+        eraseRange(m_position);
+        eraseRange(m_rotation);
+        eraseRange(m_scale);
+        eraseRange(m_world);
+        eraseRange(m_dirty);
+        eraseRange(m_rebuilt);
+        eraseRange(m_nodeAt);
+
+        // A whole subtree went, so nothing left can have had a parent inside it
+        for (std::size_t i = first; i < size(); ++i)
+            if (m_parent[i] != kNoNode && m_parent[i] >= end) m_parent[i] -= static_cast<std::uint32_t>(count);
+        renumber(first);
+    }
+
+    void TransformHierarchy::renumber(std::size_t from) {
+        for (std::size_t i = from; i < size(); ++i) m_indexOf[m_nodeAt[i]] = static_cast<std::uint32_t>(i);
+    }
+
+    // === LOCALS ===
+    void TransformHierarchy::setLocal(Node node, const math::Vec3& position, const math::Quat& rotation, const math::Vec3& scale) {
+        std::uint32_t i = m_indexOf[node];
+        if (same(m_position[i], position) && same(m_rotation[i], rotation) && same(m_scale[i], scale)) return;
+        m_position[i] = position;
+        m_rotation[i] = rotation;
+        m_scale[i] = scale;
+        m_dirty[i] = 1;
+        if (!m_anyDirty.load(std::memory_order_relaxed)) m_anyDirty.store(true, std::memory_order_relaxed);
+    }
+
+    // === PROPAGATION ===
+    std::size_t TransformHierarchy::nextRoot(std::size_t index) const {
+        while (index < size() && m_parent[index] != kNoNode) ++index;
+        return index;
+    }
+
+    void TransformHierarchy::updateRange(std::size_t begin, std::size_t end) {
+        std::size_t rebuilt = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            std::uint32_t parent = m_parent[i];
+            bool rebuild = m_dirty[i] || (parent != kNoNode && m_rebuilt[parent]);
+            m_rebuilt[i] = rebuild;
+            m_dirty[i] = 0;
+            if (!rebuild) continue;
+
+            if (parent == kNoNode) {
+                math::composeTRS(m_world[i].m, m_position[i], m_rotation[i], m_scale[i]);
+            }
+            else {
+                math::Mat4 local;
+                math::composeTRS(local.m, m_position[i], m_rotation[i], m_scale[i]);
+                math::mul(m_world[i].m, local.m, m_world[parent].m);   // local, then the parent's world
+            }
+            ++rebuilt;
+        }
+        m_recomputed.fetch_add(rebuilt, std::memory_order_relaxed);
+    }
+
+    void TransformHierarchy::update(JobSystem* jobs) {
+        ENGINE_PROFILE_SCOPE("TransformHierarchy::update");
+        m_stats.recomputed = 0;
+        if (!m_anyDirty.load(std::memory_order_relaxed)) return;
+        m_anyDirty.store(false, std::memory_order_relaxed);
+        m_recomputed.store(0, std::memory_order_relaxed);
+
+        std::size_t count = size();
+        if (!jobs || count <= kChunkSize) {
+            updateRange(0, count);
+        }
+        else {
+            // Chunk c covers the root subtrees starting in [c*K, (c+1)*K), so
+            // neighbouring chunks meet at the same root and never share a subtree
+            std::size_t chunks = (count + kChunkSize - 1) / kChunkSize;
+            jobs->parallelFor(chunks, 1, [this, count](std::size_t first, std::size_t last) {
+                for (std::size_t c = first; c < last; ++c) {
+                    std::size_t begin = c == 0 ? 0 : nextRoot(c * kChunkSize);
+                    std::size_t end = nextRoot(std::min((c + 1) * kChunkSize, count));
+                    if (begin < end) updateRange(begin, end);
+                }
+            });
+        }
+        m_stats.recomputed = m_recomputed.load(std::memory_order_relaxed);
+    }
+
+} // namespace engine
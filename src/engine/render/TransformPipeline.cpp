@@ -0,0 +1,121 @@
+// src/engine/render/TransformPipeline.cpp
+#include "engine/render/TransformPipeline.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Profiler.h"
+
+namespace engine {
+
+    std::size_t TransformPipeline::add(const math::Vec3& position, const math::Quat& rotation, const math::Vec3& scale) {
+        std::size_t index = size();
+        m_posX.push_back(position.x); m_posY.push_back(position.y); m_posZ.push_back(position.z);
+        m_rotX.push_back(rotation.x); m_rotY.push_back(rotation.y); m_rotZ.push_back(rotation.z); m_rotW.push_back(rotation.w);
+        m_scaleX.push_back(scale.x); m_scaleY.push_back(scale.y); m_scaleZ.push_back(scale.z);
+        m_world.emplace_back();
+        m_mvp.emplace_back();
+        return index;
+    }
+
+    void TransformPipeline::reserve(std::size_t count) {
+        for (auto* stream : { &m_posX, &m_posY, &m_posZ, &m_rotX, &m_rotY, &m_rotZ, &m_rotW, &m_scaleX, &m_scaleY, &m_scaleZ })
+            stream->reserve(count);
+        m_world.reserve(count);
+        m_mvp.reserve(count);
+    }
+
+    void TransformPipeline::resize(std::size_t count) {
+        for (auto* stream : { &m_posX, &m_posY, &m_posZ, &m_rotX, &m_rotY, &m_rotZ, &m_rotW, &m_scaleX, &m_scaleY, &m_scaleZ })
+            stream->resize(count);
+        m_world.resize(count);
+        m_mvp.resize(count);
+    }
+
+    void TransformPipeline::clear() {
+        for (auto* stream : { &m_posX, &m_posY, &m_posZ, &m_rotX, &m_rotY, &m_rotZ, &m_rotW, &m_scaleX, &m_scaleY, &m_scaleZ })
+            stream->clear();
+        m_world.clear();
+        m_mvp.clear();
+    }
+
+    void TransformPipeline::setPosition(std::size_t index, const math::Vec3& position) {
+        m_posX[index] = position.x; m_posY[index] = position.y; m_posZ[index] = position.z;
+    }
+
+    void TransformPipeline::setRotation(std::size_t index, const math::Quat& rotation) {
+        m_rotX[index] = rotation.x; m_rotY[index] = rotation.y; m_rotZ[index] = rotation.z; m_rotW[index] = rotation.w;
+    }
+
+    void TransformPipeline::setScale(std::size_t index, const math::Vec3& scale) {
+        m_scaleX[index] = scale.x; m_scaleY[index] = scale.y; m_scaleZ[index] = scale.z;
+    }
+
+    template <typename SlotOf>
+    void TransformPipeline::updateRange(std::size_t begin, std::size_t end, const math::Mat4& viewProj, SlotOf slotOf) {
+        // Straight SoA loop - with the identity mapping each stream is read linearly, which the compiler vectorizes
+        const float* px = m_posX.data(); const float* py = m_posY.data(); const float* pz = m_posZ.data();
+        const float* qx = m_rotX.data(); const float* qy = m_rotY.data(); const float* qz = m_rotZ.data(); const float* qw = m_rotW.data();
+        const float* sx = m_scaleX.data(); const float* sy = m_scaleY.data(); const float* sz = m_scaleZ.data();
+        math::Mat4* world = m_world.data();
+
+        for (std::size_t i = begin; i < end; ++i) {
+            std::size_t s = slotOf(i);
+            float xx = qx[s] * qx[s], yy = qy[s] * qy[s], zz = qz[s] * qz[s];
+            float xy = qx[s] * qy[s], xz = qx[s] * qz[s], yz = qy[s] * qz[s];
+            float wx = qw[s] * qx[s], wy = qw[s] * qy[s], wz = qw[s] * qz[s];
+
+            float* m = world[i].m;
+            m[0] = (1 - 2 * (yy + zz)) * sx[s]; m[1] = 2 * (xy + wz) * sx[s];       m[2] = 2 * (xz - wy) * sx[s];        m[3] = 0.0f;
+            m[4] = 2 * (xy - wz) * sy[s];       m[5] = (1 - 2 * (xx + zz)) * sy[s]; m[6] = 2 * (yz + wx) * sy[s];        m[7] = 0.0f;
+            m[8] = 2 * (xz + wy) * sz[s];       m[9] = 2 * (yz - wx) * sz[s];       m[10] = (1 - 2 * (xx + yy)) * sz[s]; m[11] = 0.0f;
+            m[12] = px[s];                      m[13] = py[s];                      m[14] = pz[s];                       m[15] = 1.0f;
+        }
+
+        // mul(out, world, viewProj) composes world then viewProj, i.e. viewProj * world
+        math::mulBatch(m_mvp.data() + begin, world + begin, viewProj, end - begin);
+    }
+
+    void TransformPipeline::update(const math::Mat4& viewProj, JobSystem* jobs) {
+        ENGINE_PROFILE_SCOPE("TransformPipeline::update");
+
+        auto identity = [](std::size_t i) { return i; };
+        if (!jobs) {
+            updateRange(0, size(), viewProj, identity);
+            return;
+        }
+        jobs->parallelFor(size(), kChunkSize, [this, &viewProj, identity](std::size_t begin, std::size_t end) {
+            updateRange(begin, end, viewProj, identity);
+        });
+    }
+
+    void TransformPipeline::update(const math::Mat4& viewProj, const std::uint32_t* slots, std::size_t count, JobSystem* jobs) {
+        ENGINE_PROFILE_SCOPE("TransformPipeline::update");
+
+        // Packed output never outgrows the slot streams, which size the output arrays
+        auto slotOf = [slots](std::size_t i) { return static_cast<std::size_t>(slots[i]); };
+        if (!jobs) {
+            updateRange(0, count, viewProj, slotOf);
+            return;
+        }
+        jobs->parallelFor(count, kChunkSize, [this, &viewProj, slotOf](std::size_t begin, std::size_t end) {
+            updateRange(begin, end, viewProj, slotOf);
+        });
+    }
+
+    void TransformPipeline::update(const math::Mat4& viewProj, const math::Mat4* worlds, const std::uint32_t* indices, std::size_t count,
+                                   JobSystem* jobs) {
+        ENGINE_PROFILE_SCOPE("TransformPipeline::update");
+
+        // Grown only, so a steady frame keeps its storage
+        if (m_world.size() < count) m_world.resize(count);
+        if (m_mvp.size() < count) m_mvp.resize(count);
+        auto gather = [this, &viewProj, worlds, indices](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) m_world[i] = worlds[indices[i]];
+            math::mulBatch(m_mvp.data() + begin, m_world.data() + begin, viewProj, end - begin);
+        };
+        if (!jobs) {
+            gather(0, count);
+            return;
+        }
+        jobs->parallelFor(count, kChunkSize, gather);
+    }
+
+} // namespace engine
@@ -0,0 +1,24 @@
+// src/engine/render/UniformBuffer.cpp
+#include "engine/render/UniformBuffer.h"
+#include "engine/render/GLDevice.h"
+#include <glad/glad.h>
+#include <cstring>
+
+namespace engine {
+
+    bool UniformBuffer::create(unsigned binding, std::size_t bytes) {
+        GLint alignment = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        m_binding = binding;
+        m_bytes = bytes;
+        return m_buffer.create(bytes, static_cast<std::size_t>(alignment));
+    }
+
+    void UniformBuffer::update(const void* data, std::size_t bytes) {
+        if (!m_buffer.valid()) return;
+        if (bytes > m_bytes) bytes = m_bytes;
+        std::memcpy(m_buffer.beginSection(), data, bytes);
+        gldevice::bindUniformBuffer(m_binding, m_buffer.buffer(), m_buffer.sectionOffset(), m_bytes);
+    }
+
+} // namespace engine
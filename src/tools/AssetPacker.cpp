@@ -0,0 +1,50 @@
+// src/tools/AssetPacker.cpp
+// Build-time tool: packs every file under a directory into one archive.
+//   asset_packer <assets dir> <output.pak> [--lz4]
+#include "engine/core/AssetArchive.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || (argc == 4 && std::strcmp(argv[3], "--lz4") != 0) || argc > 4) {
+        std::cerr << "Usage: " << argv[0] << " <assets dir> <output.pak> [--lz4]\n";
+        return 1;
+    }
+    fs::path root = argv[1];
+    bool compress = argc == 4;
+
+    std::vector<engine::AssetArchiveInput> inputs;
+    std::error_code error;
+    for (fs::recursive_directory_iterator it(root, error), end; !error && it != end; it.increment(error)) {
+        if (!it->is_regular_file()) continue;
+        std::string name = fs::relative(it->path(), root).generic_string();
+        if (it->path().filename().string()[0] == '.') continue;   // .gitkeep and friends
+
+        std::ifstream file(it->path(), std::ios::binary | std::ios::ate);
+        engine::AssetArchiveInput input;
+        input.name = name;
+        input.data.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(input.data.data(), static_cast<std::streamsize>(input.data.size()))) {
+            std::cerr << "Cannot read " << it->path() << "\n";
+            return 1;
+        }
+        inputs.push_back(std::move(input));
+    }
+    if (error) {
+        std::cerr << "Cannot walk " << root << ": " << error.message() << "\n";
+        return 1;
+    }
+
+    // Directory order is filesystem dependent; sort so the archive is reproducible
+    std::sort(inputs.begin(), inputs.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+
+    if (!engine::packAssetArchive(argv[2], inputs, compress)) return 1;
+    std::cout << "Packed " << inputs.size() << " assets into " << argv[2] << "\n";
+    return 0;
+}
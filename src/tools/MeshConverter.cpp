@@ -0,0 +1,207 @@
+// src/tools/MeshConverter.cpp
+// Offline tool: converts a Wavefront OBJ into the engine's .emesh layout.
+//   mesh_converter <input.obj> <output.emesh>
+// Vertex colour comes from the "v x y z r g b" extension when present,
+// otherwise from the normal (n * 0.5 + 0.5), otherwise white.
+#include "engine/render/MeshFormat.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace engine;
+
+namespace {
+
+    struct Vertex {
+        float position[3];
+        float color[3];
+    };
+    static_assert(sizeof(Vertex) == meshfile::kVertexStride, "must match BatchRenderer::Vertex");
+
+    struct ObjData {
+        std::vector<float> positions;   // xyz
+        std::vector<float> colors;      // rgb per position
+        std::vector<char> colored;      // per position: colour given in the file
+        std::vector<float> normals;     // xyz
+    };
+
+    void emptyBounds(meshfile::Bounds& b) {
+        for (int i = 0; i < 3; ++i) {
+            b.min[i] = FLT_MAX;
+            b.max[i] = -FLT_MAX;
+        }
+    }
+
+    void growBounds(meshfile::Bounds& b, const float* p) {
+        for (int i = 0; i < 3; ++i) {
+            b.min[i] = std::min(b.min[i], p[i]);
+            b.max[i] = std::max(b.max[i], p[i]);
+        }
+    }
+
+    // OBJ indices are 1-based, negative ones count back from the end
+    bool resolveIndex(long index, std::size_t count, std::size_t& out) {
+        if (index > 0 && static_cast<std::size_t>(index) <= count) out = static_cast<std::size_t>(index - 1);
+        else if (index < 0 && static_cast<std::size_t>(-index) <= count) out = count - static_cast<std::size_t>(-index);
+        else return false;
+        return true;
+    }
+
+    std::uint64_t alignUp(std::uint64_t value) {
+        return (value + meshfile::kAlignment - 1) & ~std::uint64_t(meshfile::kAlignment - 1);
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input.obj> <output.emesh>\n";
+        return 1;
+    }
+    std::ifstream input(argv[1]);
+    if (!input.is_open()) {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return 1;
+    }
+
+    ObjData obj;
+    std::vector<Vertex> vertices;
+    std::vector<std::uint32_t> indices;
+    std::vector<meshfile::Submesh> submeshes(1);
+    submeshes[0].firstIndex = 0;
+    emptyBounds(submeshes[0].bounds);
+
+    // (position, normal) pair -> output vertex, so shared corners are stored once
+    std::unordered_map<std::uint64_t, std::uint32_t> vertexIds;
+    std::vector<std::uint32_t> face;
+    std::string line, keyword, corner;
+    std::size_t lineNumber = 0;
+
+    while (std::getline(input, line)) {
+        ++lineNumber;
+        std::istringstream in(line);
+        if (!(in >> keyword) || keyword[0] == '#') continue;
+
+        if (keyword == "v") {
+            float p[6];
+            int count = 0;
+            while (count < 6 && in >> p[count]) ++count;
+            if (count < 3) {
+                std::cerr << argv[1] << ":" << lineNumber << ": bad vertex\n";
+                return 1;
+            }
+            obj.positions.insert(obj.positions.end(), p, p + 3);
+            obj.colored.push_back(count == 6);
+            if (count == 6) obj.colors.insert(obj.colors.end(), p + 3, p + 6);
+            else obj.colors.insert(obj.colors.end(), { 1.0f, 1.0f, 1.0f });
+        }
+        else if (keyword == "vn") {
+            float n[3] = {};
+            in >> n[0] >> n[1] >> n[2];
+            obj.normals.insert(obj.normals.end(), n, n + 3);
+        }
+        else if (keyword == "g" || keyword == "o" || keyword == "usemtl") {
+            if (submeshes.back().indexCount) {
+                meshfile::Submesh next{};
+                next.firstIndex = static_cast<std::uint32_t>(indices.size());
+                emptyBounds(next.bounds);
+                submeshes.push_back(next);
+            }
+        }
+        else if (keyword == "f") {
+            face.clear();
+            std::size_t positionCount = obj.positions.size() / 3, normalCount = obj.normals.size() / 3;
+            while (in >> corner) {
+                // v, v/vt, v//vn or v/vt/vn - texture coordinates are not used
+                long v = std::strtol(corner.c_str(), nullptr, 10), vn = 0;
+                std::size_t slash = corner.find('/');
+                if (slash != std::string::npos) {
+                    std::size_t second = corner.find('/', slash + 1);
+                    if (second != std::string::npos) vn = std::strtol(corner.c_str() + second + 1, nullptr, 10);
+                }
+
+                std::size_t position = 0, normal = 0;
+                bool hasNormal = vn != 0;
+                if (!resolveIndex(v, positionCount, position) || (hasNormal && !resolveIndex(vn, normalCount, normal))) {
+                    std::cerr << argv[1] << ":" << lineNumber << ": index out of range\n";
+                    return 1;
+                }
+
+                std::uint64_t key = (std::uint64_t(position) << 32) | (hasNormal ? normal + 1 : 0);
+                auto found = vertexIds.find(key);
+                if (found == vertexIds.end()) {
+                    Vertex out;
+                    std::memcpy(out.position, &obj.positions[position * 3], sizeof(out.position));
+                    if (!obj.colored[position] && hasNormal) {
+                        for (int i = 0; i < 3; ++i) out.color[i] = obj.normals[normal * 3 + i] * 0.5f + 0.5f;
+                    }
+                    else {
+                        std::memcpy(out.color, &obj.colors[position * 3], sizeof(out.color));   // given, or white
+                    }
+                    found = vertexIds.emplace(key, static_cast<std::uint32_t>(vertices.size())).first;
+                    vertices.push_back(out);
+                }
+                face.push_back(found->second);
+            }
+
+            // Fan-triangulate polygons
+            meshfile::Submesh& submesh = submeshes.back();
+            for (std::size_t i = 2; i < face.size(); ++i) {
+                for (std::uint32_t id : { face[0], face[i - 1], face[i] }) {
+                    indices.push_back(id);
+                    growBounds(submesh.bounds, vertices[id].position);
+                }
+                submesh.indexCount += 3;
+            }
+        }
+    }
+
+    if (!submeshes.back().indexCount) submeshes.pop_back();
+    if (indices.empty()) {
+        std::cerr << argv[1] << ": no faces\n";
+        return 1;
+    }
+
+    meshfile::Header header{};
+    header.magic = meshfile::kMagic;
+    header.version = meshfile::kVersion;
+    header.vertexStride = meshfile::kVertexStride;
+    header.vertexCount = static_cast<std::uint32_t>(vertices.size());
+    header.indexCount = static_cast<std::uint32_t>(indices.size());
+    header.submeshCount = static_cast<std::uint32_t>(submeshes.size());
+    header.vertexOffset = alignUp(sizeof(header) + submeshes.size() * sizeof(meshfile::Submesh));
+    header.indexOffset = alignUp(header.vertexOffset + vertices.size() * sizeof(Vertex));
+    emptyBounds(header.bounds);
+    for (const meshfile::Submesh& submesh : submeshes) {
+        growBounds(header.bounds, submesh.bounds.min);
+        growBounds(header.bounds, submesh.bounds.max);
+    }
+
+    std::ofstream output(argv[2], std::ios::binary | std::ios::trunc);
+    if (!output.is_open()) {
+        std::cerr << "Cannot write " << argv[2] << "\n";
+        return 1;
+    }
+    const char zeros[meshfile::kAlignment] = {};
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(submeshes.data()), static_cast<std::streamsize>(submeshes.size() * sizeof(meshfile::Submesh)));
+    output.write(zeros, static_cast<std::streamsize>(header.vertexOffset - sizeof(header) - submeshes.size() * sizeof(meshfile::Submesh)));
+    output.write(reinterpret_cast<const char*>(vertices.data()), static_cast<std::streamsize>(vertices.size() * sizeof(Vertex)));
+    output.write(zeros, static_cast<std::streamsize>(header.indexOffset - header.vertexOffset - vertices.size() * sizeof(Vertex)));
+    output.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indices.size() * sizeof(std::uint32_t)));
+    if (!output) {
+        std::cerr << "Write to " << argv[2] << " failed\n";
+        return 1;
+    }
+
+    std::cout << argv[1] << ": " << vertices.size() << " vertices, " << indices.size() / 3 << " triangles, "
+        << submeshes.size() << " submesh(es) -> " << argv[2] << "\n";
+    return 0;
+}
@@ -0,0 +1,229 @@
+// tests/bench/Bench.cpp
+#include "Bench.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace engine::bench {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        double elapsedNs(Clock::time_point start) {
+            return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        }
+
+        // === JSON READING ===
+        // Only the subset writeJson emits: one array of flat objects with
+        // string, number and bool values
+        class Reader {
+        public:
+            explicit Reader(const std::string& text) : m_text(text) {}
+
+            bool parse(std::vector<Result>& out) {
+                if (!expect('{') || !key("benchmarks") || !expect('[')) return false;
+                if (peek() == ']') return expect(']') && expect('}');
+                do {
+                    Result result;
+                    if (!object(result)) return false;
+                    out.push_back(std::move(result));
+                } while (accept(','));
+                return expect(']') && expect('}');
+            }
+
+        private:
+            bool object(Result& result) {
+                if (!expect('{')) return false;
+                do {
+                    std::string name;
+                    if (!string(name) || !expect(':')) return false;
+                    if (name == "name") { if (!string(result.name)) return false; }
+                    else if (name == "skipped") { if (!boolean(result.skipped)) return false; }
+                    else {
+                        double value = 0.0;
+                        if (!number(value)) return false;
+                        if (name == "ns_per_op") result.nsPerOp = value;
+                        else if (name == "min_ns") result.minNs = value;
+                        else if (name == "samples") result.samples = static_cast<std::uint32_t>(value);
+                        else if (name == "ops") result.ops = static_cast<std::uint64_t>(value);
+                    }
+                } while (accept(','));
+                return expect('}') && !result.name.empty();
+            }
+
+            bool key(const char* name) {
+                std::string found;
+                return string(found) && found == name && expect(':');
+            }
+
+            bool string(std::string& out) {
+                if (!expect('"')) return false;
+                std::size_t end = m_text.find('"', m_pos);
+                if (end == std::string::npos) return false;
+                out.assign(m_text, m_pos, end - m_pos);
+                m_pos = end + 1;
+                return true;
+            }
+
+            bool number(double& out) {
+                skipSpace();
+                const char* begin = m_text.c_str() + m_pos;
+                char* end = nullptr;
+                out = std::strtod(begin, &end);
+                if (end == begin) return false;
+                m_pos += static_cast<std::size_t>(end - begin);
+                return true;
+            }
+
+            bool boolean(bool& out) {
+                skipSpace();
+                for (const char* word : { "true", "false" }) {
+                    std::size_t length = std::strlen(word);
+                    if (m_text.compare(m_pos, length, word) == 0) {
+                        out = word[0] == 't';
+                        m_pos += length;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void skipSpace() {
+                while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos]))) ++m_pos;
+            }
+
+            char peek() {
+                skipSpace();
+                return m_pos < m_text.size() ? m_text[m_pos] : '\0';
+            }
+
+            bool accept(char c) {
+                if (peek() != c) return false;
+                ++m_pos;
+                return true;
+            }
+
+            bool expect(char c) { return accept(c); }
+
+            const std::string& m_text;
+            std::size_t m_pos = 0;
+        };
+
+    } // namespace
+
+    void keep(const void* data) {
+        static std::atomic<const void*> sink{ nullptr };
+        sink.store(data, std::memory_order_relaxed);
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    // === RUNNER ===
+    bool Runner::enabled(const std::string& name) const {
+        return m_options.filter.empty() || name.find(m_options.filter) != std::string::npos;
+    }
+
+    void Runner::run(const std::string& name, const std::function<void(std::uint64_t)>& body) {
+        if (!enabled(name)) return;
+
+        // Calibrate; this doubles as the warm-up
+        double target = m_options.sampleSeconds * 1e9;
+        std::uint64_t ops = 1;
+        for (;;) {
+            Clock::time_point start = Clock::now();
+            body(ops);
+            if (elapsedNs(start) >= target || ops >= (1ull << 40)) break;
+            ops *= 2;
+        }
+
+        std::vector<double> perOp;
+        perOp.reserve(m_options.samples);
+        for (std::uint32_t s = 0; s < m_options.samples; ++s) {
+            Clock::time_point start = Clock::now();
+            body(ops);
+            perOp.push_back(elapsedNs(start) / static_cast<double>(ops));
+        }
+        std::sort(perOp.begin(), perOp.end());
+
+        Result result;
+        result.name = name;
+        result.nsPerOp = perOp[perOp.size() / 2];
+        result.minNs = perOp.front();
+        result.samples = m_options.samples;
+        result.ops = ops * m_options.samples;
+        print(result);
+        m_results.push_back(std::move(result));
+    }
+
+    void Runner::record(const std::string& name, double totalNs, std::uint64_t ops) {
+        if (!enabled(name) || ops == 0) return;
+        Result result;
+        result.name = name;
+        result.nsPerOp = result.minNs = totalNs / static_cast<double>(ops);
+        result.samples = 1;
+        result.ops = ops;
+        print(result);
+        m_results.push_back(std::move(result));
+    }
+
+    void Runner::skip(const std::string& name, const char* reason) {
+        if (!enabled(name)) return;
+        Result result;
+        result.name = name;
+        result.skipped = true;
+        std::printf("%-32s skipped (%s)\n", name.c_str(), reason);
+        m_results.push_back(std::move(result));
+    }
+
+    void Runner::print(const Result& result) const {
+        std::printf("%-32s %12.2f ns/op   min %12.2f   %llu ops\n", result.name.c_str(), result.nsPerOp,
+                    result.minNs, static_cast<unsigned long long>(result.ops));
+        std::fflush(stdout);
+    }
+
+    // === JSON ===
+    bool writeJson(const std::string& path, const std::vector<Result>& results) {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file) {
+            std::cerr << "Failed to write " << path << std::endl;
+            return false;
+        }
+        file << "{\n  \"benchmarks\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            char line[512];
+            std::snprintf(line, sizeof(line),
+                          "    { \"name\": \"%s\", \"ns_per_op\": %.4f, \"min_ns\": %.4f, \"samples\": %u, \"ops\": %llu, \"skipped\": %s }%s\n",
+                          r.name.c_str(), r.nsPerOp, r.minNs, r.samples, static_cast<unsigned long long>(r.ops),
+                          r.skipped ? "true" : "false", i + 1 < results.size() ? "," : "");
+            file << line;
+        }
+        file << "  ]\n}\n";
+        return static_cast<bool>(file);
+    }
+
+    bool readJson(const std::string& path, std::vector<Result>& out) {
+        std::ifstream file(path);
+        if (!file) {
+            std::cerr << "Failed to open " << path << std::endl;
+            return false;
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string text = buffer.str();
+        out.clear();
+        if (!Reader(text).parse(out)) {
+            std::cerr << path << " is not engine_bench JSON" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+} // namespace engine::bench
@@ -0,0 +1,63 @@
+// tests/bench/Bench.h
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Micro-benchmark harness for engine_bench, and the JSON both it and
+// bench_compare speak:
+//
+//   { "benchmarks": [
+//       { "name": "math/mul", "ns_per_op": 9.81, "min_ns": 9.62, "samples": 15, "ops": 4194304, "skipped": false },
+//       ... ] }
+//
+// ns_per_op is the median over samples - what the comparison looks at;
+// min_ns is there for eyeballing noise.
+namespace engine::bench {
+
+    struct Result {
+        std::string name;
+        double nsPerOp = 0.0;
+        double minNs = 0.0;
+        std::uint32_t samples = 0;
+        std::uint64_t ops = 0;
+        bool skipped = false;
+    };
+
+    struct Options {
+        double sampleSeconds = 0.02;     // each sample runs the body at least this long
+        std::uint32_t samples = 15;
+        std::string filter;              // substring of the benchmark name; empty = all
+    };
+
+    class Runner {
+    public:
+        explicit Runner(const Options& options) : m_options(options) {}
+
+        bool enabled(const std::string& name) const;
+
+        // body(n) performs n operations. The repetition count is doubled until
+        // one call takes sampleSeconds, then that many are timed per sample.
+        void run(const std::string& name, const std::function<void(std::uint64_t)>& body);
+        // For work that cannot be repeated cheaply: one pre-timed sample
+        void record(const std::string& name, double totalNs, std::uint64_t ops);
+        void skip(const std::string& name, const char* reason);
+
+        const std::vector<Result>& results() const { return m_results; }
+
+    private:
+        void print(const Result& result) const;
+
+        Options m_options;
+        std::vector<Result> m_results;
+    };
+
+    // Keeps a value observable so the optimizer cannot drop the work producing it
+    void keep(const void* data);
+
+    bool writeJson(const std::string& path, const std::vector<Result>& results);
+    // Reads what writeJson produced; false (with an error printed) on anything else
+    bool readJson(const std::string& path, std::vector<Result>& out);
+
+} // namespace engine::bench
@@ -0,0 +1,68 @@
+// tests/bench/BenchCompare.cpp
+#include "Bench.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// bench_compare BASELINE.json CURRENT.json [--threshold PERCENT]
+//
+// Prints each benchmark's change against the baseline and exits 1 when any
+// got slower by more than the threshold (default 10%). Benchmarks skipped
+// on either side, or new in CURRENT, are listed but never fail the run; one
+// that disappeared from CURRENT does.
+int main(int argc, char* argv[]) {
+    using engine::bench::Result;
+
+    const char* paths[2] = { nullptr, nullptr };
+    int pathCount = 0;
+    double threshold = 10.0;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) threshold = std::atof(argv[++i]);
+        else if (pathCount < 2 && argv[i][0] != '-') paths[pathCount++] = argv[i];
+        else pathCount = 3;
+    }
+    if (pathCount != 2 || threshold <= 0.0) {
+        std::cerr << "Usage: bench_compare BASELINE.json CURRENT.json [--threshold PERCENT]" << std::endl;
+        return 2;
+    }
+
+    std::vector<Result> baseline, current;
+    if (!engine::bench::readJson(paths[0], baseline) || !engine::bench::readJson(paths[1], current)) return 2;
+
+    auto find = [](const std::vector<Result>& results, const std::string& name) -> const Result* {
+        for (const Result& r : results)
+            if (r.name == name) return &r;
+        return nullptr;
+    };
+
+    int regressions = 0;
+    std::printf("%-32s %12s %12s %9s\n", "benchmark", "baseline ns", "current ns", "delta");
+    for (const Result& base : baseline) {
+        const Result* now = find(current, base.name);
+        if (!now) {
+            std::printf("%-32s %12.2f %12s %9s  MISSING\n", base.name.c_str(), base.nsPerOp, "-", "-");
+            ++regressions;
+            continue;
+        }
+        if (base.skipped || now->skipped || base.nsPerOp <= 0.0) {
+            std::printf("%-32s %12s %12s %9s  skipped\n", base.name.c_str(), "-", "-", "-");
+            continue;
+        }
+        double delta = (now->nsPerOp - base.nsPerOp) / base.nsPerOp * 100.0;
+        bool regressed = delta > threshold;
+        if (regressed) ++regressions;
+        std::printf("%-32s %12.2f %12.2f %+8.1f%%%s\n", base.name.c_str(), base.nsPerOp, now->nsPerOp, delta,
+                    regressed ? "  REGRESSED" : "");
+    }
+    for (const Result& now : current) {
+        if (!find(baseline, now.name)) std::printf("%-32s %12s %12.2f %9s  new\n", now.name.c_str(), "-", now.nsPerOp, "-");
+    }
+
+    if (regressions > 0) {
+        std::printf("%d benchmark(s) regressed past %.1f%%\n", regressions, threshold);
+        return 1;
+    }
+    std::printf("No regressions past %.1f%%\n", threshold);
+    return 0;
+}
@@ -0,0 +1,359 @@
+// tests/bench/Benchmarks.cpp
+#define SDL_MAIN_HANDLED
+#include "Bench.h"
+#include "engine/core/Components.h"
+#include "engine/core/Engine.h"
+#include "engine/core/EngineConfig.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Replay.h"
+#include "engine/core/Systems.h"
+#include "engine/ecs/Snapshot.h"
+#include "engine/math/Math.h"
+#include "engine/particles/ParticleSystem.h"
+#include "engine/physics/Broadphase.h"
+#include "engine/render/Shader.h"
+#include <SDL.h>
+#include <glad/glad.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// engine_bench: micro-benchmarks for the hot paths of the engine.
+//
+//   engine_bench [--json FILE] [--quick] [--filter TEXT] [--assets DIR]
+//
+// --quick takes fewer, shorter samples (the ctest smoke run); timings from
+// it are not meant for comparison. Results go to stdout and, with --json,
+// to FILE for bench_compare.
+namespace {
+
+    using namespace engine;
+    using engine::bench::keep;
+    using engine::bench::Runner;
+
+    // === MATH ===
+    void mathBenchmarks(Runner& runner) {
+        math::Mat4 a = math::perspective(1.0f, 1.5f, 0.1f, 100.0f);
+        math::Mat4 b = math::lookAt(math::Vec3(3, 4, 5), math::Vec3(0, 0, 0), math::Vec3(0, 1, 0));
+        math::Mat4 out;
+
+        runner.run("math/mul", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                math::mul(out.m, a.m, b.m);
+                a.m[12] = out.m[0] * 1e-9f;   // feed the result back so iterations cannot be folded
+            }
+            keep(&out);
+        });
+
+        // One model matrix per entity times the shared viewProj, as TransformPipeline does
+        constexpr std::size_t kBatch = 1024;
+        std::vector<math::Mat4> models(kBatch), mvps(kBatch);
+        for (std::size_t i = 0; i < kBatch; ++i)
+            models[i] = math::translate(math::Mat4(), math::Vec3(float(i), 0.5f * float(i), -float(i)));
+        runner.run("math/mulBatch_1024", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                math::mulBatch(mvps.data(), models.data(), a, kBatch);
+                keep(mvps.data());
+            }
+        });
+
+        runner.run("math/lookAt", [&](std::uint64_t n) {
+            math::Vec3 eye(3, 4, 5);
+            for (std::uint64_t i = 0; i < n; ++i) {
+                out = math::lookAt(eye, math::Vec3(0, 0, 0), math::Vec3(0, 1, 0));
+                eye.x += out.m[14] * 1e-9f;
+            }
+            keep(&out);
+        });
+
+        runner.run("math/perspective", [&](std::uint64_t n) {
+            float fov = 1.0f;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                out = math::perspective(fov, 1.5f, 0.1f, 100.0f);
+                fov += out.m[0] * 1e-9f;
+            }
+            keep(&out);
+        });
+    }
+
+    // === PARTICLES ===
+    // One ParticleSystem::update() of a 1M pool held near full by a fountain,
+    // so every step emits, integrates, kills and compacts, split over all
+    // workers and streamed to an instance array as it would be to the mapped
+    // buffer. Once per SIMD level the CPU supports.
+    void particleBenchmarks(Runner& runner) {
+        constexpr std::size_t kParticles = 1 << 20;
+        constexpr float kDt = 1.0f / 60.0f;
+        JobSystem jobs;
+        ParticleSystem particles;
+        particles.create(kParticles);
+        ParticleEmitter fountain;
+        fountain.velocity = math::Vec3(0.0f, 6.0f, 0.0f);
+        fountain.velocityJitter = 1.5f;
+        fountain.lifeMin = 1.0f;
+        fountain.lifeMax = 2.0f;
+        fountain.rate = 0.9f * kParticles / 1.5f;   // 90% full on average
+        particles.addEmitter(fountain);
+        // Cache-line aligned like a mapped buffer, so streamed lines fill whole
+        struct alignas(64) Line { ParticleInstance instances[4]; };
+        std::vector<Line> lines(particles.capacity() / 4);
+        ParticleInstance* out = lines.front().instances;
+
+        math::SimdLevel active = math::simdLevel();
+        for (math::SimdLevel level : { math::SimdLevel::Scalar, math::SimdLevel::SSE2, math::SimdLevel::AVX2, math::SimdLevel::NEON }) {
+            std::string name = std::string("particles/update_1M_") + math::simdLevelName(level);
+            if (!runner.enabled(name) || !math::setSimdLevel(level)) continue;
+            // Two simulated seconds reach the steady state before timing
+            for (int i = 0; i < 120; ++i) particles.update(kDt, &jobs, out);
+            runner.run(name, [&](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) particles.update(kDt, &jobs, out);
+                keep(out);
+            });
+        }
+        math::setSimdLevel(active);
+    }
+
+    // === BROADPHASE ===
+    // 1k to 500k bodies at one density, a few overlaps each, on every
+    // worker. Each op updates against the other of two slightly shifted
+    // copies of the scene, so sweep-and-prune pays for the re-sort real
+    // motion causes rather than seeing the same order every time.
+    void broadphaseBenchmarks(Runner& runner) {
+        JobSystem jobs;
+        for (std::size_t bodies : { 1000, 10000, 100000, 500000 }) {
+            std::string suffix = "_" + std::to_string(bodies / 1000) + "k";
+            std::string sapName = "broadphase/sap" + suffix;
+            std::string hashName = "broadphase/hash" + suffix;
+            if (!runner.enabled(sapName) && !runner.enabled(hashName)) continue;
+
+            unsigned state = 12345u;
+            auto next = [&state] {   // [0, 1)
+                state = state * 1664525u + 1013904223u;
+                return static_cast<float>(state >> 8) / static_cast<float>(1u << 24);
+            };
+            float world = std::cbrt(static_cast<float>(bodies) * 4.0f);   // one body per 4 units^3
+            std::vector<math::Aabb> frames[2] = { std::vector<math::Aabb>(bodies), std::vector<math::Aabb>(bodies) };
+            for (std::size_t i = 0; i < bodies; ++i) {
+                math::Vec3 center(next() * world, next() * world, next() * world);
+                float half = 0.25f + 0.5f * next();
+                frames[0][i] = { math::Vec3(center.x - half, center.y - half, center.z - half),
+                                 math::Vec3(center.x + half, center.y + half, center.z + half) };
+                float dx = (next() - 0.5f) * 0.05f, dy = (next() - 0.5f) * 0.05f;
+                frames[1][i] = { math::Vec3(frames[0][i].min.x + dx, frames[0][i].min.y + dy, frames[0][i].min.z),
+                                 math::Vec3(frames[0][i].max.x + dx, frames[0][i].max.y + dy, frames[0][i].max.z) };
+            }
+
+            SweepAndPrune sap;
+            runner.run(sapName, [&](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) sap.update(frames[i & 1].data(), bodies, &jobs);
+                keep(sap.pairs().data());
+            });
+            SpatialHashGrid grid;
+            runner.run(hashName, [&](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) grid.update(frames[i & 1].data(), bodies, &jobs);
+                keep(grid.pairs().data());
+            });
+        }
+    }
+
+    // === REPLAY ===
+    // 10k spinning renderables laid out like --entities 10000, every one of
+    // them changing every tick - the worst case for deltas. capture and
+    // delta are the per-tick cost of recording, before the write; seek
+    // rebuilds a tick from a recorded stream, alternating between far-apart
+    // ticks so none of them starts from the tick before.
+    void replayBenchmarks(Runner& runner) {
+        if (!runner.enabled("replay/capture_10k") && !runner.enabled("replay/delta_10k") && !runner.enabled("replay/seek_10k"))
+            return;
+        constexpr std::uint64_t kTicks = 30;
+        JobSystem jobs;
+        ecs::World world;
+        for (std::uint32_t i = 0; i < 10000; ++i) {
+            Spin spin;
+            spin.axis = math::Vec3(0.0f, 1.0f, 0.0f);
+            spin.degreesPerSecond = 30.0f + (i % 7) * 20.0f;
+            math::Vec3 position((i % 100) * 2.5f - 125.0f, (i / 100) * 2.5f - 125.0f, -10.0f);
+            world.create(Position{ position }, Rotation{}, PreviousTransform{ position, math::Quat() }, Scale{}, spin,
+                         SceneNode{ i }, Renderable{});
+        }
+        std::size_t bytes = ecs::columnBytes(world);
+        std::uint64_t layout = ecs::layoutHash(world);
+        std::vector<std::byte> states[2] = { std::vector<std::byte>(bytes), std::vector<std::byte>(bytes) };
+        std::vector<std::byte> delta(maxDeltaBytes(bytes));
+
+        const std::string path = (std::filesystem::temp_directory_path() / "engine_bench.estate").string();
+        StateRecorder recorder;
+        if (!recorder.open(path, bytes, layout)) return;
+        for (std::uint64_t tick = 0; tick <= kTicks; ++tick) {
+            if (tick > 0) {
+                snapshotSystem(world, jobs);
+                spinSystem(world, 1.0f / 60.0f, jobs);
+            }
+            ecs::saveColumns(world, states[tick & 1].data());
+            recorder.write(tick, InputState{}, states[tick & 1].data());
+        }
+        recorder.close();
+
+        // The world is at tick kTicks already, so the captures rewrite the same bytes
+        runner.run("replay/capture_10k", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) ecs::saveColumns(world, states[kTicks & 1].data());
+            keep(states[kTicks & 1].data());
+        });
+        runner.run("replay/delta_10k", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) encodeDelta(states[(kTicks - 1) & 1].data(), states[kTicks & 1].data(), bytes, delta.data());
+            keep(delta.data());
+        });
+        StateReplay replay;
+        if (replay.open(path, bytes, layout)) {
+            runner.run("replay/seek_10k", [&](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i) replay.seek((i * 17) % (kTicks + 1));
+                keep(replay.state());
+            });
+        }
+        std::filesystem::remove(path);
+    }
+
+    // === SHADER ===
+    void shaderFileBenchmark(Runner& runner, const std::string& assets) {
+        const std::string path = assets + "/shaders/vertex.glsl";
+        if (!runner.enabled("shader/readFile")) return;
+        if (Shader::readFile(path).empty()) {
+            runner.skip("shader/readFile", "vertex.glsl not found, see --assets");
+            return;
+        }
+        runner.run("shader/readFile", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) {
+                std::string source = Shader::readFile(path);
+                keep(source.data());
+            }
+        });
+    }
+
+    // Eight plain uniforms; the engine's own shaders only use the FrameData block
+    const char* kUniformVertex = R"(#version 450 core
+uniform mat4 u_model;
+uniform mat4 u_view;
+uniform mat4 u_projection;
+uniform float u_time;
+void main() { gl_Position = u_projection * u_view * u_model * vec4(u_time); }
+)";
+    const char* kUniformFragment = R"(#version 450 core
+uniform float u_exposure;
+uniform float u_gamma;
+uniform float u_fade;
+uniform float u_tint;
+out vec4 color;
+void main() { color = vec4(u_exposure, u_gamma, u_fade, u_tint); }
+)";
+
+    // Needs a real GL context, so a hidden window; reported as skipped when
+    // the machine cannot give us one. Runs before the engine benchmark
+    // because both own SDL's lifetime.
+    void uniformBenchmark(Runner& runner) {
+        const char* name = "shader/uniformLookup";
+        if (!runner.enabled(name)) return;
+        if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+            runner.skip(name, "no video");
+            return;
+        }
+
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 5);
+        SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+        SDL_Window* window = SDL_CreateWindow("engine_bench", 0, 0, 64, 64, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+        SDL_GLContext context = window ? SDL_GL_CreateContext(window) : nullptr;
+        if (!context || !gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress)) {
+            runner.skip(name, "no GL 4.5 context");
+        }
+        else {
+            Shader shader;
+            if (!shader.loadFromSource(kUniformVertex, kUniformFragment)) {
+                runner.skip(name, "shader did not build");
+            }
+            else {
+                // Resolved once like any caller would; the benchmark is the
+                // name lookup after that, worst case the last one registered
+                const char* names[] = { "u_model", "u_view", "u_projection", "u_time",
+                                        "u_exposure", "u_gamma", "u_fade", "u_tint" };
+                for (const char* uniform : names) shader.uniform(uniform);
+                runner.run(name, [&](std::uint64_t n) {
+                    int sum = 0;
+                    for (std::uint64_t i = 0; i < n; ++i) sum += shader.uniform("u_tint").index;
+                    keep(&sum);
+                });
+            }
+        }
+
+        if (context) SDL_GL_DeleteContext(context);
+        if (window) SDL_DestroyWindow(window);
+        SDL_Quit();
+    }
+
+    // === FRAME ===
+    // A full headless engine: simulation, systems and CPU render prep for
+    // the default scene plus extra entities, no GL. One sample; startup and
+    // shutdown are outside the timing.
+    void frameBenchmark(Runner& runner, bool quick) {
+        const char* name = "frame/headlessTick";
+        if (!runner.enabled(name)) return;
+
+        EngineConfig config;
+        config.display = DisplayMode::Headless;
+        config.ticks = quick ? 60 : 2000;
+        config.extraEntities = 2000;
+
+        Engine engine;
+        if (!engine.initialize(config)) {
+            runner.skip(name, "engine failed to initialize");
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        engine.run();
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        engine.shutdown();
+        runner.record(name, ns, config.ticks);
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    SDL_SetMainReady();
+
+    engine::bench::Options options;
+    std::string jsonPath, assets = "assets";
+    bool quick = false;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(arg, "--json") == 0 && hasValue) jsonPath = argv[++i];
+        else if (std::strcmp(arg, "--filter") == 0 && hasValue) options.filter = argv[++i];
+        else if (std::strcmp(arg, "--assets") == 0 && hasValue) assets = argv[++i];
+        else if (std::strcmp(arg, "--quick") == 0) quick = true;
+        else {
+            std::cerr << "Usage: engine_bench [--json FILE] [--quick] [--filter TEXT] [--assets DIR]" << std::endl;
+            return 2;
+        }
+    }
+    if (quick) {
+        options.sampleSeconds = 0.002;
+        options.samples = 3;
+    }
+
+    std::cout << "engine_bench (SIMD: " << engine::math::simdLevelName(engine::math::simdLevel()) << ")" << std::endl;
+    Runner runner(options);
+    mathBenchmarks(runner);
+    particleBenchmarks(runner);
+    broadphaseBenchmarks(runner);
+    replayBenchmarks(runner);
+    shaderFileBenchmark(runner, assets);
+    uniformBenchmark(runner);
+    frameBenchmark(runner, quick);
+
+    if (!jsonPath.empty() && !engine::bench::writeJson(jsonPath, runner.results())) return 1;
+    return 0;
+}
@@ -0,0 +1,87 @@
+// tests/unit/AssetArchiveTests.cpp
+#include "Test.h"
+#include "engine/core/AssetArchive.h"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace engine;
+
+namespace {
+
+    // Offsets into the archive format (see AssetArchive.cpp)
+    constexpr std::size_t kEntryCountOffset = 12;
+    constexpr std::size_t kSlotsOffset = 40;
+    constexpr std::size_t kSlotSize = 48;
+    constexpr std::size_t kSlotOffsetField = 8;
+    constexpr std::size_t kSlotNameLengthField = 36;
+
+    std::vector<char> readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void writeFile(const std::string& path, const std::vector<char>& bytes) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    template <typename T>
+    void poke(std::vector<char>& bytes, std::size_t offset, T value) {
+        std::memcpy(bytes.data() + offset, &value, sizeof(value));
+    }
+
+} // namespace
+
+// === VALIDATION ===
+ENGINE_TEST(AssetArchiveRejectsCorruptTables) {
+    const std::string path = (std::filesystem::temp_directory_path() / "engine_archive_test.pak").string();
+    std::vector<AssetArchiveInput> inputs = { { "a.txt", { 'a', 'b', 'c' } }, { "shaders/b.glsl", { 'x' } } };
+    CHECK(packAssetArchive(path, inputs, false));
+    const std::vector<char> good = readFile(path);
+    const std::size_t slotCount = 8;
+
+    AssetArchive archive;
+    CHECK(archive.open(path));
+    std::string_view view;
+    CHECK(archive.find("a.txt", view) && view == "abc");
+    CHECK(!archive.find("missing", view));
+    archive.close();
+
+    // Every slot in use: a miss would probe forever
+    std::vector<char> full = good;
+    for (std::size_t i = 0; i < slotCount; ++i) {
+        std::size_t slot = kSlotsOffset + i * kSlotSize;
+        std::uint32_t nameLength;
+        std::memcpy(&nameLength, full.data() + slot + kSlotNameLengthField, sizeof(nameLength));
+        if (!nameLength) poke<std::uint32_t>(full, slot + kSlotNameLengthField, 1);
+    }
+    poke<std::uint32_t>(full, kEntryCountOffset, static_cast<std::uint32_t>(slotCount));
+    writeFile(path, full);
+    CHECK(!archive.open(path));
+
+    // Header count disagrees with the table
+    std::vector<char> miscounted = good;
+    poke<std::uint32_t>(miscounted, kEntryCountOffset, 3);
+    writeFile(path, miscounted);
+    CHECK(!archive.open(path));
+
+    // offset + size wraps around
+    std::vector<char> wrapped = good;
+    for (std::size_t i = 0; i < slotCount; ++i) {
+        std::size_t slot = kSlotsOffset + i * kSlotSize;
+        std::uint32_t nameLength;
+        std::memcpy(&nameLength, wrapped.data() + slot + kSlotNameLengthField, sizeof(nameLength));
+        if (nameLength) poke<std::uint64_t>(wrapped, slot + kSlotOffsetField, ~std::uint64_t(0) - 1);
+    }
+    writeFile(path, wrapped);
+    CHECK(!archive.open(path));
+
+    writeFile(path, good);
+    CHECK(archive.open(path));
+    archive.close();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,109 @@
+// tests/unit/BroadphaseTests.cpp
+#include "Test.h"
+#include "TestUtil.h"
+#include "engine/core/JobSystem.h"
+#include "engine/math/Math.h"
+#include "engine/physics/Broadphase.h"
+#include <algorithm>
+#include <vector>
+
+using namespace engine;
+using engine::test::Lcg;
+using engine::test::forEachSimdLevel;
+
+namespace {
+
+    // Boxes of mixed size scattered through a cube, dense enough for a few overlaps each
+    std::vector<math::Aabb> randomBoxes(std::size_t count, float worldSize, Lcg& rng) {
+        std::vector<math::Aabb> boxes(count);
+        for (math::Aabb& box : boxes) {
+            math::Vec3 center(rng.unit() * worldSize, rng.unit() * worldSize, rng.unit() * worldSize);
+            math::Vec3 half(0.2f + rng.unit(), 0.2f + rng.unit(), 0.2f + rng.unit());
+            box.min = math::Vec3(center.x - half.x, center.y - half.y, center.z - half.z);
+            box.max = math::Vec3(center.x + half.x, center.y + half.y, center.z + half.z);
+        }
+        return boxes;
+    }
+
+    std::vector<BodyPair> bruteForce(const std::vector<math::Aabb>& boxes) {
+        std::vector<BodyPair> pairs;
+        for (std::uint32_t a = 0; a < boxes.size(); ++a)
+            for (std::uint32_t b = a + 1; b < boxes.size(); ++b) {
+                const math::Aabb& p = boxes[a];
+                const math::Aabb& q = boxes[b];
+                if (p.min.x <= q.max.x && p.max.x >= q.min.x && p.min.y <= q.max.y && p.max.y >= q.min.y
+                    && p.min.z <= q.max.z && p.max.z >= q.min.z)
+                    pairs.push_back({ a, b });
+            }
+        return pairs;
+    }
+
+    std::vector<BodyPair> sorted(std::vector<BodyPair> pairs) {
+        std::sort(pairs.begin(), pairs.end(), [](const BodyPair& x, const BodyPair& y) { return x.a < y.a || (x.a == y.a && x.b < y.b); });
+        return pairs;
+    }
+
+} // namespace
+
+// === CORRECTNESS ===
+ENGINE_TEST(BroadphasesFindExactlyTheOverlappingPairs) {
+    Lcg rng(777u);
+    std::vector<math::Aabb> boxes = randomBoxes(3000, 25.0f, rng);
+    // Touching exactly still counts
+    boxes[0] = { math::Vec3(100, 100, 100), math::Vec3(101, 101, 101) };
+    boxes[1] = { math::Vec3(101, 100, 100), math::Vec3(102, 101, 101) };
+    std::vector<BodyPair> expected = bruteForce(boxes);
+    CHECK(expected.size() > boxes.size());
+
+    forEachSimdLevel([&](math::SimdLevel) {
+        SweepAndPrune sap;
+        sap.update(boxes.data(), boxes.size(), nullptr);
+        CHECK(sorted(sap.pairs()) == expected);
+    });
+    SpatialHashGrid grid;
+    grid.update(boxes.data(), boxes.size(), nullptr);
+    CHECK(sorted(grid.pairs()) == expected);
+}
+
+ENGINE_TEST(SpatialHashHandlesBodiesLargerThanTheGrid) {
+    Lcg rng(777u);
+    std::vector<math::Aabb> boxes = randomBoxes(500, 20.0f, rng);
+    boxes.push_back({ math::Vec3(-5, -5, -5), math::Vec3(12, 30, 8) });   // spans far more than kMaxCellsPerBody
+    boxes.push_back({ math::Vec3(10, 10, 10), math::Vec3(25, 25, 25) });
+
+    SpatialHashGrid grid;
+    grid.update(boxes.data(), boxes.size(), nullptr);
+    CHECK(grid.stats().largeBodies == 2);
+    CHECK(sorted(grid.pairs()) == bruteForce(boxes));
+}
+
+// === DETERMINISM ===
+ENGINE_TEST(BroadphasePairListsIgnoreThreadsAndHistory) {
+    Lcg rng(777u);
+    std::vector<math::Aabb> boxes = randomBoxes(20000, 120.0f, rng);
+    JobSystem jobs(4);
+
+    SweepAndPrune serial, threaded, incremental;
+    serial.update(boxes.data(), boxes.size(), nullptr);
+    threaded.update(boxes.data(), boxes.size(), &jobs);
+    CHECK(threaded.pairs() == serial.pairs());
+
+    // Drift every box a little; the incrementally sorted run must match a fresh one
+    incremental.update(boxes.data(), boxes.size(), &jobs);
+    for (math::Aabb& box : boxes) {
+        float dx = (rng.unit() - 0.5f) * 0.02f;
+        box.min.x += dx;
+        box.max.x += dx;
+    }
+    incremental.update(boxes.data(), boxes.size(), &jobs);
+    SweepAndPrune fresh;
+    fresh.update(boxes.data(), boxes.size(), nullptr);
+    CHECK(incremental.pairs() == fresh.pairs());
+    CHECK(incremental.stats().fullSorts == 1);
+
+    SpatialHashGrid gridSerial, gridThreaded;
+    gridSerial.update(boxes.data(), boxes.size(), nullptr);
+    gridThreaded.update(boxes.data(), boxes.size(), &jobs);
+    CHECK(gridThreaded.pairs() == gridSerial.pairs());
+    CHECK(sorted(gridSerial.pairs()) == sorted(fresh.pairs()));
+}
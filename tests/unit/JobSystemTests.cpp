@@ -0,0 +1,50 @@
+// tests/unit/JobSystemTests.cpp
+#include "Test.h"
+#include "engine/core/JobSystem.h"
+#include "engine/core/Memory.h"
+#include <algorithm>
+#include <vector>
+
+using namespace engine;
+
+// === FRAME HEAP ===
+// Engine::endFrame() asserts a steady frame makes no heap allocations; the
+// main thread pumps its lane on every spin of wait(), so that must not allocate
+ENGINE_TEST(MainThreadParallelForDoesNotAllocate) {
+    JobSystem jobs(4);
+    memory::markFrameThread();
+
+    std::vector<int> values(4096, 0);
+    int mainLaneRuns = 0;
+    auto frame = [&] {
+        jobs.parallelFor(values.size(), 64, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) ++values[i];
+        });
+        JobCounter counter;
+        jobs.runOnMainThread([&mainLaneRuns] { ++mainLaneRuns; }, &counter);
+        jobs.wait(counter);
+    };
+
+    frame();   // first use of this thread's job pool
+    std::uint64_t before = memory::frameHeapAllocations();
+    for (int i = 0; i < 100; ++i) frame();
+    CHECK(memory::frameHeapAllocations() == before);
+    CHECK(mainLaneRuns == 101);
+    CHECK(std::all_of(values.begin(), values.end(), [](int v) { return v == 101; }));
+}
+
+// A main-lane job that waits pumps the lane again from inside the first pump
+ENGINE_TEST(MainLaneJobsMayWaitOnTheMainLane) {
+    JobSystem jobs(2);
+    int order = 0, outer = 0, inner = 0;
+    JobCounter counter;
+    jobs.runOnMainThread([&] {
+        JobCounter nested;
+        jobs.runOnMainThread([&] { inner = ++order; }, &nested);
+        jobs.wait(nested);
+        outer = ++order;
+    }, &counter);
+    jobs.wait(counter);
+    CHECK(inner == 1);
+    CHECK(outer == 2);
+}
@@ -0,0 +1,214 @@
+// tests/unit/MathTests.cpp
+#include "Test.h"
+#include "TestUtil.h"
+#include "engine/math/Math.h"
+#include <vector>
+
+// Reference values below are worked out by hand, not captured from the
+// code, so a change in convention (handedness, depth range, mul order)
+// fails here before it shows up as a subtly wrong frame.
+using namespace engine::math;
+using engine::test::Lcg;
+using engine::test::forEachSimdLevel;
+
+namespace {
+
+    constexpr float kPi = 3.14159265358979f;
+    constexpr double kEps = 1e-5;
+
+    void checkMat(const float* actual, const float* expected, double tolerance = kEps) {
+        for (int i = 0; i < 16; ++i) CHECK_NEAR(actual[i], expected[i], tolerance);
+    }
+
+    void checkVec(const Vec3& actual, float x, float y, float z, double tolerance = kEps) {
+        CHECK_NEAR(actual.x, x, tolerance);
+        CHECK_NEAR(actual.y, y, tolerance);
+        CHECK_NEAR(actual.z, z, tolerance);
+    }
+
+    Mat4 randomMat(Lcg& rng) {
+        Mat4 m;
+        for (float& v : m.m) v = rng.signedUnit();
+        return m;
+    }
+
+} // namespace
+
+// === MATRICES ===
+ENGINE_TEST(MulIdentity) {
+    Lcg rng;
+    Mat4 a = randomMat(rng), identity, out;
+    mul(out.m, identity.m, a.m);
+    checkMat(out.m, a.m, 0.0);
+    mul(out.m, a.m, identity.m);
+    checkMat(out.m, a.m, 0.0);
+}
+
+ENGINE_TEST(MulAppliesLeftOperandFirst) {
+    Mat4 move = translate(Mat4(), Vec3(1, 2, 3));
+    Mat4 grow = scale(Mat4(), Vec3(2, 2, 2));
+    Mat4 out;
+
+    mul(out.m, move.m, grow.m);   // move, then grow: 2 * (p + t)
+    checkVec(transformPoint(out.m, Vec3(0, 0, 0)), 2, 4, 6);
+
+    mul(out.m, grow.m, move.m);   // grow, then move: 2p + t
+    checkVec(transformPoint(out.m, Vec3(1, 1, 1)), 3, 4, 5);
+}
+
+ENGINE_TEST(TransposeSwapsRowsAndColumns) {
+    Mat4 m, out;
+    for (int i = 0; i < 16; ++i) m.m[i] = static_cast<float>(i);
+    transpose(out.m, m.m);
+    for (int row = 0; row < 4; ++row)
+        for (int col = 0; col < 4; ++col) CHECK(out.m[col * 4 + row] == m.m[row * 4 + col]);
+}
+
+ENGINE_TEST(InverseUndoesTransform) {
+    Mat4 m, inv, product;
+    composeTRS(m.m, Vec3(4, -2, 7), quatFromAxisAngle(Vec3(1, 2, 3), 0.7f), Vec3(0.5f, 2, 3));
+    CHECK(inverse(inv.m, m.m));
+    mul(product.m, m.m, inv.m);
+    checkMat(product.m, Mat4().m, 1e-5);
+    checkVec(transformPoint(inv.m, transformPoint(m.m, Vec3(1, 2, 3))), 1, 2, 3, 1e-4);
+}
+
+ENGINE_TEST(InverseRejectsSingular) {
+    Mat4 flat = scale(Mat4(), Vec3(1, 0, 1));
+    Mat4 out;
+    out.m[0] = 42.0f;
+    CHECK(!inverse(out.m, flat.m));
+    CHECK(out.m[0] == 42.0f);   // left untouched
+}
+
+// === PROJECTION / VIEW ===
+ENGINE_TEST(PerspectiveMatchesGlConvention) {
+    // fov 90 deg: f = 1 / tan(45 deg) = 1
+    Mat4 p = perspective(kPi * 0.5f, 2.0f, 1.0f, 3.0f);
+    float expected[16] = {
+        0.5f, 0, 0, 0,
+        0, 1, 0, 0,
+        0, 0, -2, -1,   // (far + near) / (near - far), then -1 into w
+        0, 0, -3, 0     // 2 * far * near / (near - far)
+    };
+    checkMat(p.m, expected);
+
+    // Near and far planes land on NDC depth -1 and +1
+    for (float z : { -1.0f, -3.0f }) {
+        Vec3 clip = transformPoint(p.m, Vec3(0, 0, z));
+        float w = -z;
+        CHECK_NEAR(clip.z / w, z == -1.0f ? -1.0 : 1.0, kEps);
+    }
+}
+
+ENGINE_TEST(LookAtDownNegativeZ) {
+    // Eye on +z looking at the origin is a pure translation by -eye
+    Mat4 view = lookAt(Vec3(0, 0, 5), Vec3(0, 0, 0), Vec3(0, 1, 0));
+    Mat4 expected = translate(Mat4(), Vec3(0, 0, -5));
+    checkMat(view.m, expected.m);
+    checkVec(transformPoint(view.m, Vec3(0, 0, 5)), 0, 0, 0);
+}
+
+ENGINE_TEST(LookAtFromSide) {
+    // Eye on +x looking at the origin: world -z is to the right, the origin 3 ahead
+    Mat4 view = lookAt(Vec3(3, 0, 0), Vec3(0, 0, 0), Vec3(0, 1, 0));
+    checkVec(transformPoint(view.m, Vec3(0, 0, 0)), 0, 0, -3);
+    checkVec(transformPoint(view.m, Vec3(0, 0, -1)), 1, 0, -3);
+    checkVec(transformPoint(view.m, Vec3(0, 1, 0)), 0, 1, -3);
+}
+
+// === QUATERNIONS / TRS ===
+ENGINE_TEST(QuatFromAxisAngle) {
+    Quat q = quatFromAxisAngle(Vec3(0, 0, 5), kPi * 0.5f);   // axis gets normalized
+    CHECK_NEAR(q.x, 0.0, kEps);
+    CHECK_NEAR(q.y, 0.0, kEps);
+    CHECK_NEAR(q.z, 0.70710678, kEps);
+    CHECK_NEAR(q.w, 0.70710678, kEps);
+}
+
+ENGINE_TEST(ComposeTrsScalesRotatesThenTranslates) {
+    Mat4 m;
+    composeTRS(m.m, Vec3(1, 2, 3), quatFromAxisAngle(Vec3(0, 0, 1), kPi * 0.5f), Vec3(2, 2, 2));
+    // (1,0,0) -> scale (2,0,0) -> 90 deg about z (0,2,0) -> translate (1,4,3)
+    checkVec(transformPoint(m.m, Vec3(1, 0, 0)), 1, 4, 3);
+    checkVec(transformPoint(m.m, Vec3(0, 0, 1)), 1, 2, 5);
+}
+
+ENGINE_TEST(LerpAndNlerp) {
+    checkVec(lerp(Vec3(0, 0, 0), Vec3(2, 4, 6), 0.25f), 0.5f, 1.0f, 1.5f);
+
+    // Halfway from identity to 90 deg about z is exactly 45 deg about z
+    Quat quarter = quatFromAxisAngle(Vec3(0, 0, 1), kPi * 0.5f);
+    Quat flipped(-quarter.x, -quarter.y, -quarter.z, -quarter.w);
+    for (const Quat& target : { quarter, flipped }) {   // -q is the same rotation; still the short way
+        Quat q = nlerp(Quat(), target, 0.5f);
+        CHECK_NEAR(q.x, 0.0, kEps);
+        CHECK_NEAR(q.y, 0.0, kEps);
+        CHECK_NEAR(q.z, 0.38268343, kEps);
+        CHECK_NEAR(q.w, 0.92387953, kEps);
+    }
+}
+
+// === CULLING ===
+ENGINE_TEST(FrustumTest8KnownBoxes) {
+    Frustum frustum = extractFrustum(perspective(kPi * 0.5f, 1.0f, 1.0f, 10.0f));   // camera at origin down -z
+    struct Box { Vec3 center; float extent; } lanes[kFrustumLanes] = {
+        { Vec3(0, 0, -5), 0.5f },     // inside
+        { Vec3(0, 0, 5), 0.5f },      // behind the camera
+        { Vec3(100, 0, -5), 0.5f },   // far to the right
+        { Vec3(0, 0, -20), 0.5f },    // beyond the far plane
+        { Vec3(0, 0, -1), 0.5f },     // straddles the near plane
+        { Vec3(4.8f, 0, -5), 0.5f },  // straddles the right plane
+        { Vec3(0, -8, -5), 0.5f },    // below
+        { Vec3(0, 0, -9.8f), 0.5f },  // straddles the far plane
+    };
+    alignas(32) float boxes[6 * kFrustumLanes];
+    for (std::size_t lane = 0; lane < kFrustumLanes; ++lane) {
+        const float* c = &lanes[lane].center.x;
+        for (int axis = 0; axis < 3; ++axis) {
+            boxes[axis * kFrustumLanes + lane] = c[axis] - lanes[lane].extent;
+            boxes[(axis + 3) * kFrustumLanes + lane] = c[axis] + lanes[lane].extent;
+        }
+    }
+
+    unsigned expected = 0b10110001u;
+    forEachSimdLevel([&](SimdLevel) { CHECK(frustumTest8(frustum, boxes) == expected); });
+}
+
+// === SIMD DISPATCH ===
+ENGINE_TEST(BatchKernelsMatchScalarAtEveryLevel) {
+    // Every count up to 19 exercises the vector body and each tail length
+    constexpr std::size_t kMax = 19;
+    Lcg rng;
+    std::vector<Mat4> a(kMax), b(kMax), out(kMax), reference(kMax);
+    std::vector<Vec3> points(kMax), moved(kMax);
+    for (std::size_t i = 0; i < kMax; ++i) {
+        a[i] = randomMat(rng);
+        b[i] = randomMat(rng);
+        points[i] = Vec3(rng.signedUnit(), rng.signedUnit(), rng.signedUnit());
+    }
+    Mat4 shared = randomMat(rng);
+
+    forEachSimdLevel([&](SimdLevel) {
+        for (std::size_t count = 0; count <= kMax; ++count) {
+            mulBatch(out.data(), a.data(), b.data(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                scalar::mul(reference[i].m, a[i].m, b[i].m);
+                checkMat(out[i].m, reference[i].m, 1e-5);
+            }
+
+            mulBatch(out.data(), a.data(), shared, count);
+            for (std::size_t i = 0; i < count; ++i) {
+                scalar::mul(reference[i].m, a[i].m, shared.m);
+                checkMat(out[i].m, reference[i].m, 1e-5);
+            }
+
+            transformPointBatch(moved.data(), shared, points.data(), count);
+            for (std::size_t i = 0; i < count; ++i) {
+                Vec3 p = scalar::transformPoint(shared.m, points[i]);
+                checkVec(moved[i], p.x, p.y, p.z);
+            }
+        }
+    });
+    CHECK(verifySimdKernels());
+}
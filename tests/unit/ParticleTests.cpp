@@ -0,0 +1,110 @@
+// tests/unit/ParticleTests.cpp
+#include "Test.h"
+#include "TestUtil.h"
+#include "engine/math/Math.h"
+#include "engine/particles/ParticleSystem.h"
+#include <vector>
+
+using namespace engine;
+using engine::test::forEachSimdLevel;
+
+namespace {
+
+    constexpr float kDt = 1.0f / 60.0f;
+
+    std::size_t totalCount(const ParticleSystem& particles) {
+        std::size_t total = 0;
+        for (std::size_t c = 0; c < particles.chunkCount(); ++c) total += particles.chunkCounts()[c];
+        return total;
+    }
+
+} // namespace
+
+// === LIFETIME ===
+ENGINE_TEST(ParticleCountsAddUpAndSurvivorsStayPacked) {
+    ParticleSystem particles;
+    CHECK(particles.create(3 * ParticleSystem::kChunkSize - 100));
+    CHECK(particles.capacity() == 3 * ParticleSystem::kChunkSize);
+
+    ParticleEmitter emitter;
+    emitter.positionJitter = 1.0f;
+    emitter.velocityJitter = 2.0f;
+    emitter.lifeMin = 0.1f;
+    emitter.lifeMax = 0.5f;
+    emitter.rate = 60000.0f;
+    particles.addEmitter(emitter);
+
+    std::vector<ParticleInstance> out(particles.capacity());
+    std::size_t alive = 0;
+    for (int step = 0; step < 60; ++step) {
+        particles.update(kDt, nullptr, out.data());
+        const ParticleSystem::Stats& stats = particles.stats();
+        CHECK(stats.alive == alive + stats.emitted - stats.killed);
+        CHECK(stats.alive == totalCount(particles));
+        alive = stats.alive;
+
+        // Each chunk's survivors sit at its front, all still alive
+        for (std::size_t c = 0; c < particles.chunkCount(); ++c)
+            for (std::uint32_t i = 0; i < particles.chunkCounts()[c]; ++i) {
+                float life = out[c * ParticleSystem::kChunkSize + i].life;
+                CHECK(life > 0.0f && life <= 1.0f);
+            }
+    }
+    CHECK(alive > 0);
+    CHECK(particles.stats().killed > 0);
+    CHECK(particles.stats().dropped == 0);
+}
+
+ENGINE_TEST(ParticlePoolFullDropsEmissions) {
+    ParticleSystem particles;
+    particles.create(ParticleSystem::kChunkSize);
+    ParticleEmitter emitter;
+    emitter.rate = 1e6f;
+    emitter.lifeMin = emitter.lifeMax = 10.0f;
+    particles.addEmitter(emitter);
+
+    particles.update(kDt, nullptr, nullptr);
+    CHECK(particles.stats().alive == particles.capacity());
+    CHECK(particles.stats().dropped > 0);
+}
+
+// === SIMD ===
+// Without jitter every particle of an emission is identical and every
+// lifetime is the same, so each level must reproduce the scalar run
+ENGINE_TEST(ParticleSimdLevelsMatchScalar) {
+    auto simulate = [](std::vector<ParticleInstance>& out, std::vector<std::uint32_t>& counts) {
+        ParticleSystem particles;
+        particles.create(2 * ParticleSystem::kChunkSize);
+        ParticleEmitter emitter;
+        emitter.position = math::Vec3(1.0f, 2.0f, 3.0f);
+        emitter.velocity = math::Vec3(0.5f, 6.0f, -0.25f);
+        emitter.lifeMin = emitter.lifeMax = 0.5f;
+        emitter.rate = 6003.0f;   // odd batch sizes exercise the vector tails
+        particles.addEmitter(emitter);
+
+        out.assign(particles.capacity(), ParticleInstance{});
+        for (int step = 0; step < 45; ++step) particles.update(kDt, nullptr, out.data());
+        counts.assign(particles.chunkCounts(), particles.chunkCounts() + particles.chunkCount());
+    };
+
+    std::vector<ParticleInstance> expected, actual;
+    std::vector<std::uint32_t> expectedCounts, actualCounts;
+    // Scalar comes first and is the reference for the others
+    forEachSimdLevel([&](math::SimdLevel level) {
+        if (level == math::SimdLevel::Scalar) {
+            simulate(expected, expectedCounts);
+            return;
+        }
+        simulate(actual, actualCounts);
+        CHECK(actualCounts == expectedCounts);
+        for (std::size_t c = 0; c < expectedCounts.size(); ++c)
+            for (std::uint32_t i = 0; i < expectedCounts[c]; ++i) {
+                const ParticleInstance& a = actual[c * ParticleSystem::kChunkSize + i];
+                const ParticleInstance& e = expected[c * ParticleSystem::kChunkSize + i];
+                CHECK_NEAR(a.x, e.x, 1e-4);
+                CHECK_NEAR(a.y, e.y, 1e-4);
+                CHECK_NEAR(a.z, e.z, 1e-4);
+                CHECK_NEAR(a.life, e.life, 1e-5);
+            }
+    });
+}
@@ -0,0 +1,134 @@
+// tests/unit/ReplayTests.cpp
+#include "Test.h"
+#include "TestUtil.h"
+#include "engine/core/Components.h"
+#include "engine/core/Replay.h"
+#include "engine/ecs/Snapshot.h"
+#include "engine/ecs/World.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace engine;
+using engine::test::Lcg;
+
+namespace {
+
+    std::vector<std::byte> randomBytes(std::size_t count, Lcg& rng) {
+        std::vector<std::byte> bytes(count);
+        for (std::byte& b : bytes) b = static_cast<std::byte>(rng.bits());
+        return bytes;
+    }
+
+} // namespace
+
+// === DELTAS ===
+ENGINE_TEST(DeltaTurnsOneStateIntoTheOtherAndBack) {
+    Lcg rng(4242u);
+    const std::size_t size = 10007;   // not a whole number of words
+    std::vector<std::byte> from = randomBytes(size, rng);
+    std::vector<std::byte> to = from;
+    for (std::size_t i : { std::size_t(0), std::size_t(9), std::size_t(64), std::size_t(65), std::size_t(4000), size - 1 })
+        to[i] ^= std::byte{ 0x5A };
+    for (int i = 0; i < 50; ++i) to[rng.bits() % size] ^= std::byte{ 1 };
+
+    std::vector<std::byte> delta(maxDeltaBytes(size));
+    std::size_t bytes = encodeDelta(from.data(), to.data(), size, delta.data());
+    CHECK(bytes > 0 && bytes < size / 4);
+
+    std::vector<std::byte> state = from;
+    CHECK(applyDelta(delta.data(), bytes, state.data(), size));
+    CHECK(state == to);
+    CHECK(applyDelta(delta.data(), bytes, state.data(), size));
+    CHECK(state == from);
+
+    CHECK(encodeDelta(from.data(), from.data(), size, delta.data()) == 0);
+    // Nothing in common still fits the worst case
+    std::vector<std::byte> other = randomBytes(size, rng);
+    bytes = encodeDelta(from.data(), other.data(), size, delta.data());
+    CHECK(bytes <= maxDeltaBytes(size));
+    CHECK(applyDelta(delta.data(), bytes, state.data(), size));
+    CHECK(state == other);
+    // Truncated or aimed past the end: rejected
+    CHECK(!applyDelta(delta.data(), bytes, state.data(), size - 100));
+}
+
+// === COLUMNS ===
+ENGINE_TEST(WorldColumnsSaveAndLoad) {
+    ecs::World world;
+    std::vector<ecs::Entity> spinners;
+    for (int i = 0; i < 1000; ++i)
+        spinners.push_back(world.create(Position{ math::Vec3(float(i), 0.0f, 0.0f) }, Spin{}));
+    ecs::Entity camera = world.create(Position{ math::Vec3(0.0f, 0.0f, 5.0f) }, CameraLook{}, PlayerControlled{});
+
+    std::uint64_t layout = ecs::layoutHash(world);
+    // Tags hold no state: positions, spins and the look only
+    std::size_t bytes = ecs::columnBytes(world);
+    CHECK(bytes == 1000 * (sizeof(Position) + sizeof(Spin)) + sizeof(Position) + sizeof(CameraLook));
+    std::vector<std::byte> saved(bytes);
+    ecs::saveColumns(world, saved.data());
+
+    world.each<Spin>([](Spin& spin) { spin.angle += 45.0f; });
+    world.get<Position>(camera)->value.z = -3.0f;
+    ecs::loadColumns(world, saved.data());
+    CHECK(world.get<Position>(camera)->value.z == 5.0f);
+    CHECK(world.get<Spin>(spinners[500])->angle == 0.0f);
+    CHECK(world.get<Position>(spinners[999])->value.x == 999.0f);
+
+    CHECK(ecs::layoutHash(world) == layout);
+    world.destroy(spinners[10]);
+    CHECK(ecs::layoutHash(world) != layout);
+}
+
+// === STREAM ===
+ENGINE_TEST(StateStreamSeeksToAnyTick) {
+    const std::string path = (std::filesystem::temp_directory_path() / "engine_replay_test.estate").string();
+    const std::size_t size = 4096;
+    const std::uint64_t layout = 77;
+    const std::uint64_t firstTick = 100, ticks = 400;
+
+    // A few words change every tick, the rest now and then
+    Lcg rng(4242u);
+    std::vector<std::byte> state = randomBytes(size, rng);
+    std::vector<std::vector<std::byte>> expected;
+    StateRecorder recorder;
+    CHECK(recorder.open(path, size, layout));
+    for (std::uint64_t t = firstTick; t <= firstTick + ticks; ++t) {
+        if (t > firstTick) {
+            for (int i = 0; i < 16; ++i) state[i] ^= static_cast<std::byte>(t);
+            if (t % 7 == 0) state[rng.bits() % size] ^= std::byte{ 0xFF };
+        }
+        InputState input;
+        input.buttons = static_cast<std::uint32_t>(t);
+        input.mouseDX = -static_cast<std::int32_t>(t);
+        recorder.write(t, input, state.data());
+        expected.push_back(state);
+    }
+    recorder.close();
+    CHECK(recorder.stats().records == ticks + 1);
+    CHECK(recorder.stats().keyframes > 1);
+    // A writer that died mid-record leaves a torn tail
+    {
+        std::ofstream torn(path, std::ios::binary | std::ios::app);
+        torn.write("partial", 7);
+    }
+
+    StateReplay replay;
+    CHECK(!replay.open(path, size + 1, layout));
+    CHECK(!replay.open(path, size, layout + 1));
+    CHECK(replay.open(path, size, layout));
+    CHECK(replay.firstTick() == firstTick);
+    CHECK(replay.lastTick() == firstTick + ticks);
+    CHECK(replay.input(firstTick + 5).buttons == firstTick + 5);
+    CHECK(replay.input(firstTick + 5).mouseDX == -static_cast<std::int32_t>(firstTick + 5));
+
+    // Forward, backward, across keyframes and one tick at a time
+    for (std::uint64_t t : { 100, 101, 350, 349, 120, 500, 499, 250, 251, 252, 100, 500 }) {
+        CHECK(replay.seek(t));
+        CHECK(std::memcmp(replay.state(), expected[t - firstTick].data(), size) == 0);
+    }
+    CHECK(!replay.seek(firstTick - 1));
+    CHECK(!replay.seek(firstTick + ticks + 1));
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,47 @@
+// tests/unit/Test.h
+#pragma once
+#include <cmath>
+
+// Just enough test harness for the engine: self-registering test functions
+// and non-fatal checks. A failed check reports file, line and values, and
+// the test keeps going so one run shows every mismatch.
+//
+//   ENGINE_TEST(MathMulIdentity) {
+//       CHECK(a == b);
+//       CHECK_NEAR(x, 1.0, 1e-6);
+//   }
+namespace engine::test {
+
+    struct TestCase {
+        const char* name;
+        void (*run)();
+        TestCase* next;
+    };
+
+    // Links the test into the list run by TestMain.cpp
+    struct Registrar {
+        explicit Registrar(TestCase& test);
+    };
+
+    void fail(const char* file, int line, const char* expression);
+    void failNear(const char* file, int line, const char* expression, double actual, double expected);
+
+} // namespace engine::test
+
+#define ENGINE_TEST(name)                                                        \
+    static void name();                                                          \
+    static ::engine::test::TestCase name##Case{ #name, &name, nullptr };         \
+    static ::engine::test::Registrar name##Registrar(name##Case);                \
+    static void name()
+
+#define CHECK(condition)                                                         \
+    do {                                                                         \
+        if (!(condition)) ::engine::test::fail(__FILE__, __LINE__, #condition);  \
+    } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance)                                  \
+    do {                                                                         \
+        double actualValue = (actual), expectedValue = (expected);               \
+        if (!(std::fabs(actualValue - expectedValue) <= (tolerance)))            \
+            ::engine::test::failNear(__FILE__, __LINE__, #actual, actualValue, expectedValue); \
+    } while (0)
@@ -0,0 +1,54 @@
+// tests/unit/TestMain.cpp
+#include "Test.h"
+#include <cstdio>
+#include <cstring>
+
+namespace engine::test {
+
+    namespace {
+
+        TestCase* g_tests = nullptr;
+        TestCase** g_tail = &g_tests;
+        int g_failures = 0;
+
+    } // namespace
+
+    Registrar::Registrar(TestCase& test) {
+        // Appended, so tests run in the order they appear in each file
+        *g_tail = &test;
+        g_tail = &test.next;
+    }
+
+    void fail(const char* file, int line, const char* expression) {
+        std::printf("  %s:%d: CHECK(%s) failed\n", file, line, expression);
+        ++g_failures;
+    }
+
+    void failNear(const char* file, int line, const char* expression, double actual, double expected) {
+        std::printf("  %s:%d: %s = %.9g, expected %.9g\n", file, line, expression, actual, expected);
+        ++g_failures;
+    }
+
+    int failures() { return g_failures; }
+    TestCase* firstTest() { return g_tests; }
+
+} // namespace engine::test
+
+// engine_tests [FILTER]: runs every test whose name contains FILTER
+int main(int argc, char* argv[]) {
+    using namespace engine::test;
+    const char* filter = argc > 1 ? argv[1] : "";
+
+    int run = 0, failed = 0;
+    for (TestCase* test = firstTest(); test; test = test->next) {
+        if (!std::strstr(test->name, filter)) continue;
+        int before = failures();
+        test->run();
+        ++run;
+        bool ok = failures() == before;
+        if (!ok) ++failed;
+        std::printf("[%s] %s\n", ok ? "  OK  " : " FAIL ", test->name);
+    }
+    std::printf("%d test(s), %d failed\n", run, failed);
+    return failed == 0 && run > 0 ? 0 : 1;
+}
@@ -0,0 +1,33 @@
+// tests/unit/TestUtil.h
+#pragma once
+#include "engine/math/Math.h"
+
+// Fixtures shared by the unit tests
+namespace engine::test {
+
+    // Deterministic pseudo-random numbers; the same seed gives the same run everywhere
+    struct Lcg {
+        unsigned state;
+
+        explicit Lcg(unsigned seed = 12345u) : state(seed) {}
+
+        unsigned bits() {   // 24 random bits
+            state = state * 1664525u + 1013904223u;
+            return state >> 8;
+        }
+        float unit() { return static_cast<float>(bits()) / static_cast<float>(1u << 24); }   // [0, 1)
+        float signedUnit() { return unit() * 2.0f - 1.0f; }                                   // [-1, 1)
+    };
+
+    // Runs body once per SIMD level this CPU supports, restoring the active one
+    template <typename Body>
+    void forEachSimdLevel(Body body) {
+        math::SimdLevel active = math::simdLevel();
+        for (math::SimdLevel level : { math::SimdLevel::Scalar, math::SimdLevel::SSE2, math::SimdLevel::AVX2, math::SimdLevel::NEON }) {
+            if (!math::setSimdLevel(level)) continue;
+            body(level);
+        }
+        math::setSimdLevel(active);
+    }
+
+} // namespace engine::test